@@ -32,7 +32,8 @@ public class BCClientPlugin : ModuleRules
             new string[]
                 {
                     "JsonUtilities",
-                    "HTTP"
+                    "HTTP",
+                    "Sockets"
                 });
 
         PublicDependencyModuleNames.AddRange(
@@ -44,6 +45,15 @@ public class BCClientPlugin : ModuleRules
                     "Json"
                 });
 
+        // localhost stand-in for the dispatcher used for offline testing, see BCLocalDispatcher.h
+        bool bWithLocalDispatcher = Target.Configuration != UnrealTargetConfiguration.Shipping &&
+            (Target.Platform == UnrealTargetPlatform.Win64 || Target.Platform == UnrealTargetPlatform.Mac || Target.Platform == UnrealTargetPlatform.Linux);
+        if (bWithLocalDispatcher)
+        {
+            PublicDependencyModuleNames.Add("HTTPServer");
+        }
+        PublicDefinitions.Add("WITH_BC_LOCAL_DISPATCHER=" + (bWithLocalDispatcher ? "1" : "0"));
+
         // win64
         PublicDefinitions.Add("PLATFORM_UWP=0");
         if (Target.Platform == UnrealTargetPlatform.Win64 || Target.Platform == UnrealTargetPlatform.Win32)
@@ -0,0 +1,256 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCCommsMetrics.h"
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "JsonUtil.h"
+
+DECLARE_STATS_GROUP(TEXT("BrainCloud"), STATGROUP_BrainCloud, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bundles Sent"), STAT_BrainCloudBundlesSent, STATGROUP_BrainCloud);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Messages Sent"), STAT_BrainCloudMessagesSent, STATGROUP_BrainCloud);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Request Bytes"), STAT_BrainCloudRequestBytes, STATGROUP_BrainCloud);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Response Bytes"), STAT_BrainCloudResponseBytes, STATGROUP_BrainCloud);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Retries"), STAT_BrainCloudRetries, STATGROUP_BrainCloud);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Errors"), STAT_BrainCloudErrors, STATGROUP_BrainCloud);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Server Latency (ms)"), STAT_BrainCloudServerLatency, STATGROUP_BrainCloud);
+
+CSV_DEFINE_CATEGORY(BrainCloud, true);
+
+void BCLatencyHistogram::Add(double seconds)
+{
+	int32 bucket = 0;
+	while (bucket < NumBuckets - 1 && seconds > GetBucketLimit(bucket))
+		++bucket;
+
+	Buckets[bucket]++;
+	Count++;
+	TotalSeconds += seconds;
+	MaxSeconds = FMath::Max(MaxSeconds, seconds);
+}
+
+void BCLatencyHistogram::Merge(const BCLatencyHistogram &other)
+{
+	for (int32 bucket = 0; bucket < NumBuckets; ++bucket)
+		Buckets[bucket] += other.Buckets[bucket];
+	Count += other.Count;
+	TotalSeconds += other.TotalSeconds;
+	MaxSeconds = FMath::Max(MaxSeconds, other.MaxSeconds);
+}
+
+double BCLatencyHistogram::GetPercentile(double percentile) const
+{
+	if (Count == 0)
+		return 0.0;
+
+	uint32 target = (uint32)FMath::CeilToInt(percentile * Count);
+	uint32 seen = 0;
+	for (int32 bucket = 0; bucket < NumBuckets - 1; ++bucket)
+	{
+		seen += Buckets[bucket];
+		if (seen >= target)
+			return FMath::Min(GetBucketLimit(bucket), MaxSeconds);
+	}
+	return MaxSeconds;
+}
+
+double BCLatencyHistogram::GetBucketLimit(int32 bucket)
+{
+	return (double)(1 << bucket) / 1000.0;
+}
+
+void BCOperationMetrics::Merge(const BCOperationMetrics &other)
+{
+	Calls += other.Calls;
+	Errors += other.Errors;
+	Retries += other.Retries;
+	RequestBytes += other.RequestBytes;
+	ResponseBytes += other.ResponseBytes;
+	QueueLatency.Merge(other.QueueLatency);
+	ServerLatency.Merge(other.ServerLatency);
+	CallbackLatency.Merge(other.CallbackLatency);
+}
+
+void BCCommsMetrics::Reset()
+{
+	FScopeLock Lock(&_mutex);
+	_operations.Empty();
+	_bundles = BCBundleMetrics();
+}
+
+void BCCommsMetrics::RecordBundleSent(int32 messageCount, int32 maxMessages, int32 bodyBytes)
+{
+	if (!_isEnabled)
+		return;
+
+	{
+		FScopeLock Lock(&_mutex);
+		_bundles.BundlesSent++;
+		_bundles.MessagesSent += messageCount;
+		_bundles.RequestBytes += bodyBytes;
+		_bundles.TotalFillRatio += maxMessages > 0 ? FMath::Min(1.0, (double)messageCount / maxMessages) : 1.0;
+	}
+
+	INC_DWORD_STAT(STAT_BrainCloudBundlesSent);
+	INC_DWORD_STAT_BY(STAT_BrainCloudMessagesSent, messageCount);
+	INC_DWORD_STAT_BY(STAT_BrainCloudRequestBytes, bodyBytes);
+	CSV_CUSTOM_STAT(BrainCloud, BundlesSent, 1, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(BrainCloud, MessagesSent, messageCount, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(BrainCloud, RequestBytes, bodyBytes, ECsvCustomStatOp::Accumulate);
+}
+
+void BCCommsMetrics::RecordSent(const FString &service, const FString &operation, double queueSeconds, int32 requestBytes)
+{
+	if (!_isEnabled)
+		return;
+
+	FScopeLock Lock(&_mutex);
+	BCOperationMetrics &metrics = FindOrAdd(service, operation);
+	metrics.Calls++;
+	metrics.RequestBytes += requestBytes;
+	metrics.QueueLatency.Add(queueSeconds);
+}
+
+void BCCommsMetrics::RecordBundleRetry()
+{
+	if (!_isEnabled)
+		return;
+
+	{
+		FScopeLock Lock(&_mutex);
+		_bundles.BundlesRetried++;
+	}
+
+	INC_DWORD_STAT(STAT_BrainCloudRetries);
+	CSV_CUSTOM_STAT(BrainCloud, Retries, 1, ECsvCustomStatOp::Accumulate);
+}
+
+void BCCommsMetrics::RecordRetry(const FString &service, const FString &operation)
+{
+	if (!_isEnabled)
+		return;
+
+	FScopeLock Lock(&_mutex);
+	FindOrAdd(service, operation).Retries++;
+}
+
+void BCCommsMetrics::RecordResponse(const FString &service, const FString &operation, double serverSeconds, int32 responseBytes)
+{
+	if (!_isEnabled)
+		return;
+
+	{
+		FScopeLock Lock(&_mutex);
+		BCOperationMetrics &metrics = FindOrAdd(service, operation);
+		metrics.ResponseBytes += responseBytes;
+		metrics.ServerLatency.Add(serverSeconds);
+		_bundles.ResponseBytes += responseBytes;
+	}
+
+	INC_DWORD_STAT_BY(STAT_BrainCloudResponseBytes, responseBytes);
+	SET_FLOAT_STAT(STAT_BrainCloudServerLatency, serverSeconds * 1000.0);
+	CSV_CUSTOM_STAT(BrainCloud, ResponseBytes, responseBytes, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(BrainCloud, ServerLatencyMs, (float)(serverSeconds * 1000.0), ECsvCustomStatOp::Max);
+}
+
+void BCCommsMetrics::RecordCallback(const FString &service, const FString &operation, double callbackSeconds, bool isError)
+{
+	if (!_isEnabled)
+		return;
+
+	{
+		FScopeLock Lock(&_mutex);
+		BCOperationMetrics &metrics = FindOrAdd(service, operation);
+		metrics.CallbackLatency.Add(callbackSeconds);
+		if (isError)
+			metrics.Errors++;
+	}
+
+	if (isError)
+	{
+		INC_DWORD_STAT(STAT_BrainCloudErrors);
+		CSV_CUSTOM_STAT(BrainCloud, Errors, 1, ECsvCustomStatOp::Accumulate);
+	}
+}
+
+TArray<BCOperationMetrics> BCCommsMetrics::GetOperationMetrics()
+{
+	FScopeLock Lock(&_mutex);
+	TArray<BCOperationMetrics> result;
+	_operations.GenerateValueArray(result);
+	return result;
+}
+
+BCBundleMetrics BCCommsMetrics::GetBundleMetrics()
+{
+	FScopeLock Lock(&_mutex);
+	return _bundles;
+}
+
+static TSharedRef<FJsonObject> HistogramToJson(const BCLatencyHistogram &histogram)
+{
+	TSharedRef<FJsonObject> json = MakeShareable(new FJsonObject());
+	json->SetNumberField(TEXT("count"), histogram.Count);
+	json->SetNumberField(TEXT("avgMs"), histogram.GetAverage() * 1000.0);
+	json->SetNumberField(TEXT("p50Ms"), histogram.GetPercentile(0.5) * 1000.0);
+	json->SetNumberField(TEXT("p90Ms"), histogram.GetPercentile(0.9) * 1000.0);
+	json->SetNumberField(TEXT("p99Ms"), histogram.GetPercentile(0.99) * 1000.0);
+	json->SetNumberField(TEXT("maxMs"), histogram.MaxSeconds * 1000.0);
+
+	TArray<TSharedPtr<FJsonValue>> buckets;
+	for (int32 i = 0; i < BCLatencyHistogram::NumBuckets; ++i)
+		buckets.Add(MakeShareable(new FJsonValueNumber(histogram.Buckets[i])));
+	json->SetArrayField(TEXT("buckets"), buckets);
+	return json;
+}
+
+FString BCCommsMetrics::ToJsonString()
+{
+	TArray<BCOperationMetrics> operations = GetOperationMetrics();
+	BCBundleMetrics bundles = GetBundleMetrics();
+
+	TSharedRef<FJsonObject> root = MakeShareable(new FJsonObject());
+
+	TSharedRef<FJsonObject> bundlesJson = MakeShareable(new FJsonObject());
+	bundlesJson->SetNumberField(TEXT("bundlesSent"), bundles.BundlesSent);
+	bundlesJson->SetNumberField(TEXT("bundlesRetried"), bundles.BundlesRetried);
+	bundlesJson->SetNumberField(TEXT("messagesSent"), bundles.MessagesSent);
+	bundlesJson->SetNumberField(TEXT("requestBytes"), (double)bundles.RequestBytes);
+	bundlesJson->SetNumberField(TEXT("responseBytes"), (double)bundles.ResponseBytes);
+	bundlesJson->SetNumberField(TEXT("averageFillRatio"), bundles.GetAverageFillRatio());
+	root->SetObjectField(TEXT("bundles"), bundlesJson);
+
+	TArray<TSharedPtr<FJsonValue>> operationsJson;
+	for (const BCOperationMetrics &metrics : operations)
+	{
+		TSharedRef<FJsonObject> json = MakeShareable(new FJsonObject());
+		json->SetStringField(TEXT("service"), metrics.Service);
+		json->SetStringField(TEXT("operation"), metrics.Operation);
+		json->SetNumberField(TEXT("calls"), metrics.Calls);
+		json->SetNumberField(TEXT("errors"), metrics.Errors);
+		json->SetNumberField(TEXT("retries"), metrics.Retries);
+		json->SetNumberField(TEXT("requestBytes"), (double)metrics.RequestBytes);
+		json->SetNumberField(TEXT("responseBytes"), (double)metrics.ResponseBytes);
+		json->SetObjectField(TEXT("queueLatency"), HistogramToJson(metrics.QueueLatency));
+		json->SetObjectField(TEXT("serverLatency"), HistogramToJson(metrics.ServerLatency));
+		json->SetObjectField(TEXT("callbackLatency"), HistogramToJson(metrics.CallbackLatency));
+		operationsJson.Add(MakeShareable(new FJsonValueObject(json)));
+	}
+	root->SetArrayField(TEXT("operations"), operationsJson);
+
+	return JsonUtil::jsonValueToString(root);
+}
+
+BCOperationMetrics &BCCommsMetrics::FindOrAdd(const FString &service, const FString &operation)
+{
+	FString key = service + TEXT(".") + operation;
+	BCOperationMetrics *metrics = _operations.Find(key);
+	if (metrics == nullptr)
+	{
+		metrics = &_operations.Add(key);
+		metrics->Service = service;
+		metrics->Operation = operation;
+	}
+	return *metrics;
+}
@@ -0,0 +1,117 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCCommsThread.h"
+
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+
+#include "BrainCloudClient.h"
+#include "BrainCloudComms.h"
+#include "BrainCloudRTTComms.h"
+#include "BrainCloudRelayComms.h"
+
+BCCommsThread *BCCommsThread::s_instance = nullptr;
+FCriticalSection BCCommsThread::s_instanceMutex;
+
+void BCCommsThread::AddClient(BrainCloudClient *client)
+{
+	FScopeLock instanceLock(&s_instanceMutex);
+	if (s_instance == nullptr)
+		s_instance = new BCCommsThread();
+
+	FScopeLock clientsLock(&s_instance->_clientsMutex);
+	s_instance->_clients.Add(client);
+}
+
+void BCCommsThread::RemoveClient(BrainCloudClient *client)
+{
+	FScopeLock instanceLock(&s_instanceMutex);
+	if (s_instance == nullptr)
+		return;
+
+	bool isEmpty = false;
+	{
+		FScopeLock clientsLock(&s_instance->_clientsMutex);
+		s_instance->_clients.Remove(client);
+		isEmpty = s_instance->_clients.Num() == 0;
+	}
+
+	// the thread may be part way through updating it, it won't pick it up again
+	while (s_instance->_updatingClient.Load() == client)
+		FPlatformProcess::Sleep(0.0f);
+
+	if (isEmpty)
+	{
+		delete s_instance;
+		s_instance = nullptr;
+	}
+}
+
+BCCommsThread::BCCommsThread()
+{
+	_wakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	_thread = FRunnableThread::Create(this, TEXT("BrainCloudComms"), 0, TPri_Normal);
+}
+
+BCCommsThread::~BCCommsThread()
+{
+	if (_thread != nullptr)
+	{
+		_thread->Kill(true);
+		delete _thread;
+		_thread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(_wakeEvent);
+	_wakeEvent = nullptr;
+}
+
+uint32 BCCommsThread::Run()
+{
+	TArray<BrainCloudClient *> clients;
+	while (!_stopping)
+	{
+		{
+			FScopeLock Lock(&_clientsMutex);
+			clients.Reset();
+			for (BrainCloudClient *client : _clients)
+				clients.Add(client);
+		}
+
+		for (BrainCloudClient *client : clients)
+		{
+			// skip clients removed since the copy was taken
+			{
+				FScopeLock Lock(&_clientsMutex);
+				if (!_clients.Contains(client))
+					continue;
+				_updatingClient = client;
+			}
+
+			UpdateClient(client);
+			_updatingClient = nullptr;
+		}
+
+		_wakeEvent->Wait(FTimespan::FromSeconds(_updateInterval));
+	}
+	return 0;
+}
+
+void BCCommsThread::UpdateClient(BrainCloudClient *client)
+{
+	if (client->_brainCloudComms)
+		client->_brainCloudComms->UpdateNetwork();
+
+	if (client->_brainCloudRTTComms)
+		client->_brainCloudRTTComms->ServiceSockets();
+
+	if (client->_brainCloudRelayComms)
+		client->_brainCloudRelayComms->ServiceSockets();
+}
+
+void BCCommsThread::Stop()
+{
+	_stopping = true;
+	_wakeEvent->Trigger();
+}
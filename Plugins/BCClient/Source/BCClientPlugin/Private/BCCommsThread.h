@@ -0,0 +1,56 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Templates/Atomic.h"
+
+class BrainCloudClient;
+
+/**
+ * Worker used when BrainCloudClient::SINGLE_THREADED is false.
+ *
+ * Drives the network side of the rest, rtt and relay comms (building and
+ * signing packets, polling http requests, parsing responses, servicing the
+ * websockets) off the game thread. Anything which calls back into user code
+ * is queued and dispatched from runCallbacks.
+ *
+ * One thread is shared by every threaded client in the process, it is
+ * created with the first client added and destroyed with the last one
+ * removed. None of the comms updates block, so a single thread keeps up
+ * with a large number of clients.
+ */
+class BCCommsThread : public FRunnable
+{
+  public:
+	// once RemoveClient returns the thread no longer touches the client
+	static void AddClient(BrainCloudClient *client);
+	static void RemoveClient(BrainCloudClient *client);
+
+	virtual ~BCCommsThread();
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	void SetUpdateInterval(float seconds) { _updateInterval = seconds; }
+
+  private:
+	BCCommsThread();
+	void UpdateClient(BrainCloudClient *client);
+
+	static BCCommsThread *s_instance;
+	static FCriticalSection s_instanceMutex;
+
+	// guards the client set, it is not held while a client is updated so
+	// adding and removing clients never waits on a whole pass
+	FCriticalSection _clientsMutex;
+	TSet<BrainCloudClient *> _clients;
+	// the client being updated, RemoveClient waits for it to be done with
+	TAtomic<BrainCloudClient *> _updatingClient{nullptr};
+	FRunnableThread *_thread = nullptr;
+	FEvent *_wakeEvent = nullptr;
+	FThreadSafeBool _stopping;
+	float _updateInterval = 0.005f;
+};
@@ -22,44 +22,46 @@ BCFileUploader::~BCFileUploader()
 
 bool BCFileUploader::UploadFile(FString &filePath, FString &sessionId, FString &fileUploadId, FString &uploadUrl)
 {
+    _uploadId = fileUploadId;
+    _filePath = filePath;
+    _sessionId = sessionId;
+    _uploadUrl = uploadUrl;
+
     if (!FPaths::FileExists(filePath))
     {
-        UE_LOG(LogBrainCloudComms, Error, TEXT("Failed uploading file at '%s': File not found\n"), *filePath);
+        FString message = FString::Printf(TEXT("Failed uploading file at '%s': File not found"), *filePath);
+        ReportError(HttpCode::CLIENT_NETWORK_ERROR, ReasonCodes::CLIENT_UPLOAD_FILE_UNKNOWN, message);
+        UE_LOG(LogBrainCloudComms, Error, TEXT("%s"), *message);
         return false;
     }
 
-    _uploadId = fileUploadId;
-
-    TArray<uint8> fileData;
-    FFileHelper::LoadFileToArray(fileData, *filePath);
-    _totalBytesToTransfer = fileData.Num();
+    _totalBytesToTransfer = (int32)IFileManager::Get().FileSize(*filePath);
     _fileName = FPaths::GetCleanFilename(filePath);
 
-    bool useMultipart = false;
-    if (useMultipart)
-    {
-        FString boundary = FGuid::NewGuid().ToString();
-        TArray<uint8> payload = CreateContent(boundary, sessionId, fileUploadId, _fileName, fileData);
+    _request = FHttpModule::Get().CreateRequest();
+    FString url = uploadUrl;
+    url += "?uploadId=" + _uploadId;
+    url += "&sessionId=" + sessionId;
 
-        _request = FHttpModule::Get().CreateRequest();
+    _request->SetURL(url);
+    _request->SetVerb(TEXT("PUT"));
+    _request->SetHeader(TEXT("Content-Type"), "application/octet-stream");
 
-        _request->SetURL(uploadUrl);
-        _request->SetVerb(TEXT("POST"));
-        _request->SetHeader(TEXT("Content-Type"), FString::Printf(TEXT("multipart/form-data; boundary=%s"), *boundary));
-        _request->SetContent(payload);
-    }
-    else
+    // the body is read from disk in small pieces as it is sent, so the
+    // memory used doesn't grow with the size of the file
+    #if ENGINE_MINOR_VERSION > 25
+    if (!_request->SetContentAsStreamedFile(filePath))
     {
-        _request = FHttpModule::Get().CreateRequest();
-        FString url = uploadUrl;
-        url += "?uploadId=" + _uploadId;
-        url += "&sessionId=" + sessionId;
-
-        _request->SetURL(url);
-        _request->SetVerb(TEXT("PUT"));
-        _request->SetHeader(TEXT("Content-Type"), "application/octet-stream");
-        _request->SetContent(fileData);
+        FString message = FString::Printf(TEXT("Failed uploading file at '%s': File could not be opened"), *filePath);
+        ReportError(HttpCode::CLIENT_NETWORK_ERROR, ReasonCodes::CLIENT_UPLOAD_FILE_UNKNOWN, message);
+        UE_LOG(LogBrainCloudComms, Error, TEXT("%s"), *message);
+        return false;
     }
+    #else
+    TArray<uint8> fileData;
+    FFileHelper::LoadFileToArray(fileData, *filePath);
+    _request->SetContent(fileData);
+    #endif
 
     _request->OnProcessRequestComplete().BindRaw(this, &BCFileUploader::OnProcessRequestComplete);
     _request->OnRequestProgress().BindRaw(this, &BCFileUploader::OnRequestProgress);
@@ -74,12 +76,31 @@ bool BCFileUploader::UploadFile(FString &filePath, FString &sessionId, FString &
     return true;
 }
 
+bool BCFileUploader::RestartUpload()
+{
+    _status = UPLOAD_STATUS_PENDING;
+    _response.Empty();
+    _statusCode = 0;
+    _reasonCode = 0;
+    _canRetry = false;
+    _bytesTransferred = -1;
+    _progress = -1.0f;
+    _timeUnderTransferRate = 0.0;
+
+    if (_isLoggingEnabled)
+        UE_LOG(LogBrainCloudComms, Log, TEXT("Restarting upload of '%s'\n"), *_fileName);
+    return UploadFile(_filePath, _sessionId, _uploadId, _uploadUrl);
+}
+
 void BCFileUploader::CancelUpload()
 {
-    _request->CancelRequest();
+    // may not have been started yet, see BCUploadScheduler
+    if (_request.IsValid())
+        _request->CancelRequest();
 
     FString message = FString::Printf(TEXT("Upload of %s canceled by user"), *_fileName);
     ReportError(HttpCode::CLIENT_NETWORK_ERROR, ReasonCodes::CLIENT_UPLOAD_FILE_CANCELLED, message);
+    _canRetry = false;
 
     if (_isLoggingEnabled)
         UE_LOG(LogBrainCloudComms, Log, TEXT("Upload of %s canceled by user"), *_fileName);
@@ -87,6 +108,10 @@ void BCFileUploader::CancelUpload()
 
 void BCFileUploader::OnProcessRequestComplete(FHttpRequestPtr request, FHttpResponsePtr response, bool bWasSuccessful)
 {
+    // cancelled or timed out, the error has been reported already
+    if (_status == UPLOAD_STATUS_COMPLETE_FAILED)
+        return;
+
     if (bWasSuccessful)
     {
         _response = response->GetContentAsString();
@@ -97,6 +122,7 @@ void BCFileUploader::OnProcessRequestComplete(FHttpRequestPtr request, FHttpResp
     {
         _status = UPLOAD_STATUS_COMPLETE_FAILED;
         _reasonCode = ReasonCodes::CLIENT_UPLOAD_FILE_UNKNOWN;
+        _canRetry = true;
     }
 }
 
@@ -115,49 +141,13 @@ void BCFileUploader::OnRequestProgress(FHttpRequestPtr request, int32 bytesSent,
     {
         FString message = FString::Printf(TEXT("Upload of %s timed out"), *_fileName);
         ReportError(HttpCode::CLIENT_NETWORK_ERROR, ReasonCodes::CLIENT_UPLOAD_FILE_TIMED_OUT, message);
+        _canRetry = true;
 
         UE_LOG(LogBrainCloudComms, Error, TEXT("%s"), *message);
         _request->CancelRequest();
     }
 }
 
-TArray<uint8> BCFileUploader::CreateContent(FString &boundary, FString &sessionId, FString &fileUploadId, FString &fileName, TArray<uint8> &data)
-{
-    FString boundaryLine = FString::Printf(TEXT("--%s\r\n"), *boundary);
-
-    FString content = boundaryLine;
-    content += TEXT("Content-Disposition: form-data; name=\"sessionId\"\r\n\r\n");
-    content += FString::Printf(TEXT("%s\r\n"), *sessionId);
-
-    content += boundaryLine;
-    content += TEXT("Content-Disposition: form-data; name=\"uploadId\"\r\n\r\n");
-    content += FString::Printf(TEXT("%s\r\n"), *fileUploadId);
-
-    content += boundaryLine;
-    content += TEXT("Content-Disposition: form-data; name=\"fileSize\"\r\n\r\n");
-    content += FString::Printf(TEXT("%d\r\n"), data.Num());
-
-    content += boundaryLine;
-    content += FString::Printf(TEXT("Content-Disposition: form-data; name=\"uploadFile\"; filename=\"%s\"\r\n"), *fileName);
-    content += TEXT("Content-Type: application/octet-stream\r\n\r\n");
-
-    FTCHARToUTF8 Converter(*content);
-    TArray<uint8> payload;
-    payload.SetNum(Converter.Length());
-    FMemory::Memcpy(payload.GetData(), (uint8 *)(ANSICHAR *)Converter.Get(), payload.Num());
-
-    FString finalLine = FString::Printf(TEXT("\r\n--%s--"), *boundary);
-    FTCHARToUTF8 NewConverter(*finalLine);
-    TArray<uint8> finalPayload;
-    finalPayload.SetNum(NewConverter.Length());
-    FMemory::Memcpy(finalPayload.GetData(), (uint8 *)(ANSICHAR *)NewConverter.Get(), finalPayload.Num());
-
-    payload.Append(data);
-    payload.Append(finalPayload);
-
-    return payload;
-}
-
 void BCFileUploader::ReportError(int32 statusCode, int32 reasonCode, FString &statusMessage)
 {
     _statusCode = statusCode;
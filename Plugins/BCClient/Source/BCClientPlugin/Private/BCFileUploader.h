@@ -18,7 +18,11 @@ public:
   ~BCFileUploader();
 
   bool UploadFile(FString &filePath, FString &sessionId, FString &fileUploadId, FString &uploadUrl);
+  // sends the file again from the start, the server takes no partial uploads
+  bool RestartUpload();
   void CancelUpload();
+  // failed on the network rather than being refused or cancelled
+  bool CanRetry() { return _canRetry; }
 
   void EnableLogging(bool loggingEnabled) { _isLoggingEnabled = loggingEnabled; }
   void SetUploadLowTransferRateTimeout(int32 timeoutSecs) { _lowTransferRateTimeout = timeoutSecs; }
@@ -38,7 +42,6 @@ public:
   void OnRequestProgress(FHttpRequestPtr request, int32 bytesSent, int32 bytesReceived);
 
 private:
-  TArray<uint8> CreateContent(FString &boundary, FString &sessionId, FString &fileUploadId, FString &fileName, TArray<uint8> &data);
   void ReportError(int32 statusCode, int32 reasonCode, FString &statusMessage);
 
   bool _isLoggingEnabled = false;
@@ -62,6 +65,10 @@ private:
 
   FString _fileName;
   FString _uploadId;
+  FString _filePath;
+  FString _sessionId;
+  FString _uploadUrl;
+  bool _canRetry = false;
   
   #if ENGINE_MINOR_VERSION > 25
   TSharedPtr<IHttpRequest,ESPMode::ThreadSafe> _request;
@@ -0,0 +1,240 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCJsonWriter.h"
+
+void BCJsonWriter::BeginObject()
+{
+	BeginValue();
+	_buffer.Add('{');
+	_scopes.Push(false);
+}
+
+void BCJsonWriter::EndObject()
+{
+	_scopes.Pop(false);
+	_buffer.Add('}');
+}
+
+void BCJsonWriter::BeginArray()
+{
+	BeginValue();
+	_buffer.Add('[');
+	_scopes.Push(false);
+}
+
+void BCJsonWriter::EndArray()
+{
+	_scopes.Pop(false);
+	_buffer.Add(']');
+}
+
+void BCJsonWriter::WriteKey(const TCHAR *key)
+{
+	BeginValue();
+	_buffer.Add('"');
+	AppendEscaped(key, FCString::Strlen(key));
+	_buffer.Add('"');
+	_buffer.Add(':');
+	_afterKey = true;
+}
+
+void BCJsonWriter::WriteString(const FString &value)
+{
+	WriteString(*value, value.Len());
+}
+
+void BCJsonWriter::WriteString(const TCHAR *value, int32 len)
+{
+	BeginValue();
+	_buffer.Add('"');
+	AppendEscaped(value, len);
+	_buffer.Add('"');
+}
+
+void BCJsonWriter::WriteNumber(double value)
+{
+	BeginValue();
+
+	// same format as TJsonWriter, 17 digits keeps large integers exact
+	ANSICHAR number[64];
+	int32 len = FCStringAnsi::Snprintf(number, sizeof(number), "%.17g", value);
+	AppendAscii(number, FMath::Clamp(len, 0, (int32)sizeof(number) - 1));
+}
+
+void BCJsonWriter::WriteBool(bool value)
+{
+	BeginValue();
+	if (value)
+		AppendAscii("true", 4);
+	else
+		AppendAscii("false", 5);
+}
+
+void BCJsonWriter::WriteNull()
+{
+	BeginValue();
+	AppendAscii("null", 4);
+}
+
+void BCJsonWriter::WriteRawValue(const uint8 *data, int32 len)
+{
+	BeginValue();
+	_buffer.Append(data, len);
+}
+
+void BCJsonWriter::WriteValue(const TSharedPtr<FJsonValue> &value)
+{
+	if (!value.IsValid())
+	{
+		WriteNull();
+		return;
+	}
+
+	switch (value->Type)
+	{
+	case EJson::String:
+		WriteString(value->AsString());
+		break;
+	case EJson::Number:
+		WriteNumber(value->AsNumber());
+		break;
+	case EJson::Boolean:
+		WriteBool(value->AsBool());
+		break;
+	case EJson::Array:
+	{
+		BeginArray();
+		for (const TSharedPtr<FJsonValue> &element : value->AsArray())
+			WriteValue(element);
+		EndArray();
+		break;
+	}
+	case EJson::Object:
+		WriteObject(value->AsObject());
+		break;
+	case EJson::Null:
+	case EJson::None:
+	default:
+		WriteNull();
+		break;
+	}
+}
+
+void BCJsonWriter::WriteObject(const TSharedPtr<FJsonObject> &object)
+{
+	if (!object.IsValid())
+	{
+		WriteNull();
+		return;
+	}
+
+	BeginObject();
+	for (const TPair<FString, TSharedPtr<FJsonValue>> &field : object->Values)
+	{
+		WriteKey(*field.Key);
+		WriteValue(field.Value);
+	}
+	EndObject();
+}
+
+void BCJsonWriter::BeginValue()
+{
+	if (_afterKey)
+	{
+		_afterKey = false;
+		return;
+	}
+
+	if (_scopes.Num() > 0)
+	{
+		if (_scopes.Last())
+			_buffer.Add(',');
+		_scopes.Last() = true;
+	}
+}
+
+void BCJsonWriter::AppendAscii(const ANSICHAR *str, int32 len)
+{
+	_buffer.Append(reinterpret_cast<const uint8 *>(str), len);
+}
+
+void BCJsonWriter::AppendEscaped(const TCHAR *str, int32 len)
+{
+	static const ANSICHAR hexDigits[] = "0123456789abcdef";
+
+	for (int32 i = 0; i < len; ++i)
+	{
+		uint32 c = (uint32)str[i];
+
+		if (c < 0x80)
+		{
+			switch (c)
+			{
+			case '"':
+				AppendAscii("\\\"", 2);
+				break;
+			case '\\':
+				AppendAscii("\\\\", 2);
+				break;
+			case '\n':
+				AppendAscii("\\n", 2);
+				break;
+			case '\r':
+				AppendAscii("\\r", 2);
+				break;
+			case '\t':
+				AppendAscii("\\t", 2);
+				break;
+			case '\b':
+				AppendAscii("\\b", 2);
+				break;
+			case '\f':
+				AppendAscii("\\f", 2);
+				break;
+			default:
+				if (c < 0x20)
+				{
+					ANSICHAR escaped[6] = {'\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF]};
+					AppendAscii(escaped, 6);
+				}
+				else
+				{
+					_buffer.Add((uint8)c);
+				}
+				break;
+			}
+			continue;
+		}
+
+		// utf16 builds hand us surrogate pairs, join them back into one code point
+		if (c >= 0xD800 && c <= 0xDBFF && i + 1 < len)
+		{
+			uint32 low = (uint32)str[i + 1];
+			if (low >= 0xDC00 && low <= 0xDFFF)
+			{
+				c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+				++i;
+			}
+		}
+
+		if (c < 0x800)
+		{
+			_buffer.Add((uint8)(0xC0 | (c >> 6)));
+			_buffer.Add((uint8)(0x80 | (c & 0x3F)));
+		}
+		else if (c < 0x10000)
+		{
+			_buffer.Add((uint8)(0xE0 | (c >> 12)));
+			_buffer.Add((uint8)(0x80 | ((c >> 6) & 0x3F)));
+			_buffer.Add((uint8)(0x80 | (c & 0x3F)));
+		}
+		else
+		{
+			_buffer.Add((uint8)(0xF0 | (c >> 18)));
+			_buffer.Add((uint8)(0x80 | ((c >> 12) & 0x3F)));
+			_buffer.Add((uint8)(0x80 | ((c >> 6) & 0x3F)));
+			_buffer.Add((uint8)(0x80 | (c & 0x3F)));
+		}
+	}
+}
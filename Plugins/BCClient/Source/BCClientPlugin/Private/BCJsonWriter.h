@@ -0,0 +1,46 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <Json.h>
+
+/**
+ * Forward only json writer which appends utf8 straight into a byte buffer.
+ *
+ * Used to build request bodies without going through an FJsonObject tree and
+ * an FString, so the result can be handed to the http request as is.
+ * Already serialized values (ie. a ServerCall payload) can be spliced in with
+ * WriteRawValue.
+ */
+class BCJsonWriter
+{
+  public:
+	BCJsonWriter(TArray<uint8> &buffer) : _buffer(buffer) {}
+
+	void BeginObject();
+	void EndObject();
+	void BeginArray();
+	void EndArray();
+
+	void WriteKey(const TCHAR *key);
+	void WriteString(const FString &value);
+	void WriteString(const TCHAR *value, int32 len);
+	void WriteNumber(double value);
+	void WriteBool(bool value);
+	void WriteNull();
+	void WriteRawValue(const uint8 *data, int32 len);
+
+	void WriteValue(const TSharedPtr<FJsonValue> &value);
+	void WriteObject(const TSharedPtr<FJsonObject> &object);
+
+  private:
+	void BeginValue();
+	void AppendAscii(const ANSICHAR *str, int32 len);
+	void AppendEscaped(const TCHAR *str, int32 len);
+
+	TArray<uint8> &_buffer;
+
+	// one entry per open object / array, true once it holds a value
+	TArray<bool, TInlineAllocator<16>> _scopes;
+	bool _afterKey = false;
+};
@@ -0,0 +1,340 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCLocalDispatcher.h"
+
+#if WITH_BC_LOCAL_DISPATCHER
+
+#include "HttpServerModule.h"
+#include "IHttpRouter.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "Containers/Ticker.h"
+#include "Misc/SecureHash.h"
+#include "JsonUtil.h"
+#include "HttpCodes.h"
+#include "ReasonCodes.h"
+
+namespace
+{
+	// the answered bundles kept around for retries
+	const int32 MaxAnsweredPackets = 64;
+}
+
+BCLocalResponse BCLocalResponse::Error(int32 status, int32 reasonCode, const FString &statusMessage)
+{
+	BCLocalResponse response;
+	response.Status = status;
+	response.ReasonCode = reasonCode;
+	response.StatusMessage = statusMessage;
+	return response;
+}
+
+BCLocalDispatcher::BCLocalDispatcher(uint32 port, const FString &secretKey)
+	: _port(port), _secretKey(secretKey), _random(0), _alive(MakeShareable(new bool(false)))
+{
+}
+
+BCLocalDispatcher::~BCLocalDispatcher()
+{
+	Stop();
+}
+
+bool BCLocalDispatcher::Start()
+{
+	if (IsRunning())
+		return true;
+
+	_router = FHttpServerModule::Get().GetHttpRouter(_port);
+	if (!_router.IsValid())
+	{
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Local dispatcher could not listen on port %u"), _port);
+		return false;
+	}
+
+	FHttpRouteHandle bundleRoute = _router->BindRoute(FHttpPath(TEXT("/dispatcherv2")), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest &request, const FHttpResultCallback &onComplete) { return HandleBundle(request, onComplete); });
+	FHttpRouteHandle uploadRoute = _router->BindRoute(FHttpPath(TEXT("/uploader")), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest &request, const FHttpResultCallback &onComplete) { return HandleUpload(request, onComplete); });
+
+	if (!bundleRoute.IsValid() || !uploadRoute.IsValid())
+	{
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Local dispatcher routes are already bound on port %u"), _port);
+		if (bundleRoute.IsValid())
+			_router->UnbindRoute(bundleRoute);
+		if (uploadRoute.IsValid())
+			_router->UnbindRoute(uploadRoute);
+		_router.Reset();
+		return false;
+	}
+
+	_routes.Add(bundleRoute);
+	_routes.Add(uploadRoute);
+
+	_alive = MakeShareable(new bool(true));
+	FHttpServerModule::Get().StartAllListeners();
+	return true;
+}
+
+void BCLocalDispatcher::Stop()
+{
+	if (!IsRunning())
+		return;
+
+	// responses still waiting out their latency are dropped
+	*_alive = false;
+
+	for (const FHttpRouteHandle &route : _routes)
+		_router->UnbindRoute(route);
+	_routes.Empty();
+	_router.Reset();
+
+	_sessionId.Empty();
+	_answeredPackets.Empty();
+}
+
+FString BCLocalDispatcher::GetServerUrl() const
+{
+	return FString::Printf(TEXT("http://127.0.0.1:%u/dispatcherv2"), _port);
+}
+
+void BCLocalDispatcher::SetResponse(ServiceName service, ServiceOperation operation, const BCLocalResponse &response)
+{
+	_responses.Add(MakeKey(service.getValue(), operation.getValue()), response);
+}
+
+void BCLocalDispatcher::SetHandler(ServiceName service, ServiceOperation operation, BCLocalHandler handler)
+{
+	_handlers.Add(MakeKey(service.getValue(), operation.getValue()), handler);
+}
+
+void BCLocalDispatcher::QueueResponse(ServiceName service, ServiceOperation operation, const BCLocalResponse &response)
+{
+	_queuedResponses.FindOrAdd(MakeKey(service.getValue(), operation.getValue())).Add(response);
+}
+
+void BCLocalDispatcher::ClearResponses()
+{
+	_responses.Empty();
+	_handlers.Empty();
+	_queuedResponses.Empty();
+}
+
+void BCLocalDispatcher::SetLatency(float minSeconds, float maxSeconds)
+{
+	_minLatency = FMath::Max(0.0f, minSeconds);
+	_maxLatency = FMath::Max(_minLatency, maxSeconds);
+}
+
+void BCLocalDispatcher::ClearReceived()
+{
+	_receivedCalls.Empty();
+	_bundleCount = 0;
+	_droppedCount = 0;
+	_uploadCount = 0;
+	_uploadBytes = 0;
+}
+
+bool BCLocalDispatcher::HandleBundle(const FHttpServerRequest &request, const FHttpResultCallback &onComplete)
+{
+	_bundleCount++;
+
+	if (!IsSignatureValid(request))
+	{
+		Respond(onComplete, HttpCode::FORBIDDEN, FString::Printf(
+			TEXT("{\"status\":%d,\"reason_code\":%d,\"status_message\":\"Message signature mismatch\",\"severity\":\"ERROR\"}"),
+			HttpCode::FORBIDDEN, ReasonCodes::BAD_SIGNATURE));
+		return true;
+	}
+
+	if (_bundleStatus != 0)
+	{
+		Respond(onComplete, _bundleStatus, FString::Printf(TEXT("{\"status\":%d}"), _bundleStatus));
+		return true;
+	}
+
+	FUTF8ToTCHAR converted(reinterpret_cast<const ANSICHAR *>(request.Body.GetData()), request.Body.Num());
+	FString body(converted.Length(), converted.Get());
+	FString answer = AnswerBundle(body);
+	if (answer.IsEmpty())
+	{
+		Respond(onComplete, HttpCode::BAD_REQUEST, FString::Printf(TEXT("{\"status\":%d}"), HttpCode::BAD_REQUEST));
+		return true;
+	}
+
+	if (_lossRate > 0.0f && _random.FRand() < _lossRate)
+	{
+		// never completed, the client sees a timeout
+		_droppedCount++;
+		return true;
+	}
+
+	Respond(onComplete, HttpCode::OK, answer);
+	return true;
+}
+
+bool BCLocalDispatcher::HandleUpload(const FHttpServerRequest &request, const FHttpResultCallback &onComplete)
+{
+	_uploadCount++;
+	_uploadBytes += request.Body.Num();
+	Respond(onComplete, HttpCode::OK, FString::Printf(TEXT("{\"status\":%d,\"data\":{}}"), HttpCode::OK));
+	return true;
+}
+
+FString BCLocalDispatcher::AnswerBundle(const FString &body)
+{
+	TSharedPtr<FJsonObject> bundle = JsonUtil::jsonStringToValue(body);
+	if (!bundle.IsValid())
+		return FString();
+
+	uint64 packetId = (uint64)bundle->GetNumberField(TEXT("packetId"));
+	FString sessionId;
+	bundle->TryGetStringField(TEXT("sessionId"), sessionId);
+
+	TPair<FString, uint64> answeredKey(sessionId, packetId);
+	if (FString *answered = _answeredPackets.Find(answeredKey))
+		return *answered;
+
+	const TArray<TSharedPtr<FJsonValue>> *messages = nullptr;
+	if (!bundle->TryGetArrayField(TEXT("messages"), messages))
+		return FString();
+
+	FString answer = FString::Printf(TEXT("{\"packetId\":%llu,\"responses\":["), packetId);
+	for (int32 i = 0; i < messages->Num(); ++i)
+	{
+		const TSharedPtr<FJsonObject> *message = nullptr;
+		if (!(*messages)[i]->TryGetObject(message))
+			return FString();
+
+		ReceivedCall call;
+		call.PacketId = packetId;
+		(*message)->TryGetStringField(TEXT("service"), call.Service);
+		(*message)->TryGetStringField(TEXT("operation"), call.Operation);
+		const TSharedPtr<FJsonObject> *data = nullptr;
+		if ((*message)->TryGetObjectField(TEXT("data"), data))
+			call.Data = *data;
+		_receivedCalls.Add(call);
+
+		bool isAuthentication = call.Service == ServiceName::AuthenticateV2.getValue();
+		BCLocalResponse response;
+		if (!isAuthentication && (_sessionId.IsEmpty() || sessionId != _sessionId))
+			response = BCLocalResponse::Error(HttpCode::FORBIDDEN, ReasonCodes::NO_SESSION, TEXT("No session"));
+		else
+			response = AnswerMessage(call.Service, call.Operation, call.Data);
+
+		if (i > 0)
+			answer += TEXT(",");
+		if (response.Status == HttpCode::OK)
+		{
+			answer += FString::Printf(TEXT("{\"status\":%d,\"data\":%s}"), response.Status, *response.Data);
+		}
+		else
+		{
+			answer += FString::Printf(TEXT("{\"status\":%d,\"reason_code\":%d,\"status_message\":\"%s\",\"severity\":\"ERROR\"}"),
+				response.Status, response.ReasonCode, *response.StatusMessage.ReplaceCharWithEscapedChar());
+		}
+	}
+	answer += TEXT("]}");
+
+	// bundles without a session are authentications, which the client never retries
+	if (!sessionId.IsEmpty())
+	{
+		if (_answeredPackets.Num() >= MaxAnsweredPackets)
+			_answeredPackets.Empty();
+		_answeredPackets.Add(answeredKey, answer);
+	}
+	return answer;
+}
+
+BCLocalResponse BCLocalDispatcher::AnswerMessage(const FString &service, const FString &operation, const TSharedPtr<FJsonObject> &data)
+{
+	FString key = MakeKey(service, operation);
+
+	BCLocalResponse response;
+	TArray<BCLocalResponse> *queued = _queuedResponses.Find(key);
+	if (queued != nullptr && queued->Num() > 0)
+	{
+		response = (*queued)[0];
+		queued->RemoveAt(0);
+	}
+	else if (BCLocalHandler *handler = _handlers.Find(key))
+	{
+		response = (*handler)(service, operation, data);
+	}
+	else if (BCLocalResponse *canned = _responses.Find(key))
+	{
+		response = *canned;
+	}
+	else if (service == ServiceName::AuthenticateV2.getValue())
+	{
+		FString profileId;
+		if (data.IsValid())
+			data->TryGetStringField(TEXT("profileId"), profileId);
+		if (profileId.IsEmpty())
+			profileId = TEXT("local-profile");
+
+		response.Data = FString::Printf(
+			TEXT("{\"profileId\":\"%s\",\"playerName\":\"\",\"maxBundleMsgs\":10,\"maxKillCount\":11,\"playerSessionExpiry\":1200}"),
+			*profileId.ReplaceCharWithEscapedChar());
+	}
+
+	// authentication always starts a new session, inject it into whatever answered it
+	if (service == ServiceName::AuthenticateV2.getValue() && response.Status == HttpCode::OK)
+	{
+		_sessionId = FString::Printf(TEXT("local-session-%d"), _nextSession++);
+		// nothing sent in an earlier session can be answered from the cache any more
+		_answeredPackets.Empty();
+		TSharedPtr<FJsonObject> responseData = JsonUtil::jsonStringToValue(response.Data);
+		if (responseData.IsValid())
+		{
+			responseData->SetStringField(TEXT("sessionId"), _sessionId);
+			response.Data = JsonUtil::jsonValueToString(responseData.ToSharedRef());
+		}
+	}
+	return response;
+}
+
+bool BCLocalDispatcher::IsSignatureValid(const FHttpServerRequest &request) const
+{
+	if (_secretKey.IsEmpty())
+		return true;
+
+	const TArray<FString> *signature = request.Headers.Find(TEXT("X-SIG"));
+	if (signature == nullptr || signature->Num() == 0)
+		return false;
+
+	FTCHARToUTF8 secret(*_secretKey);
+	uint8 digest[16];
+	FMD5 md5;
+	md5.Update(request.Body.GetData(), request.Body.Num());
+	md5.Update(reinterpret_cast<const uint8 *>(secret.Get()), secret.Length());
+	md5.Final(digest);
+
+	return BytesToHex(digest, 16).Equals((*signature)[0], ESearchCase::IgnoreCase);
+}
+
+void BCLocalDispatcher::Respond(const FHttpResultCallback &onComplete, int32 statusCode, const FString &body)
+{
+	float latency = _maxLatency > 0.0f ? _random.FRandRange(_minLatency, _maxLatency) : 0.0f;
+
+	TFunction<void()> complete = [onComplete, statusCode, body]() {
+		TUniquePtr<FHttpServerResponse> response = FHttpServerResponse::Create(body, TEXT("application/json"));
+		response->Code = (EHttpServerResponseCodes)statusCode;
+		onComplete(MoveTemp(response));
+	};
+
+	if (latency <= 0.0f)
+	{
+		complete();
+		return;
+	}
+
+	TSharedRef<bool, ESPMode::ThreadSafe> alive = _alive;
+	FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([alive, complete](float) {
+		if (*alive)
+			complete();
+		return false;
+	}), latency);
+}
+
+#endif
@@ -0,0 +1,316 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCLocalRelayServer.h"
+
+#if WITH_BC_LOCAL_DISPATCHER
+
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "BrainCloudRelayComms.h"
+
+namespace
+{
+	const uint16 ReliableBit = 0x8000;
+
+	// unacked system messages are sent again this often
+	const double RSMGResendInterval = 0.5;
+
+	uint16 ReadShortBE(const uint8 *data)
+	{
+		return (uint16)(((uint16)data[0] << 8) | (uint16)data[1]);
+	}
+}
+
+BCLocalRelayServer::BCLocalRelayServer(uint32 port) : _port(port), _random(0)
+{
+}
+
+BCLocalRelayServer::~BCLocalRelayServer()
+{
+	Stop();
+}
+
+bool BCLocalRelayServer::Start()
+{
+	if (IsRunning())
+		return true;
+
+	ISocketSubsystem *socketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	TSharedRef<FInternetAddr> addr = socketSubsystem->CreateInternetAddr();
+	bool isValid = false;
+	addr->SetIp(TEXT("127.0.0.1"), isValid);
+	addr->SetPort(_port);
+
+	_socket = socketSubsystem->CreateSocket(NAME_DGram, TEXT("brainCloud local relay"), addr->GetProtocolType());
+	if (_socket == nullptr || !_socket->Bind(*addr))
+	{
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Local relay server could not listen on port %u"), _port);
+		if (_socket != nullptr)
+			socketSubsystem->DestroySocket(_socket);
+		_socket = nullptr;
+		return false;
+	}
+	_socket->SetNonBlocking(true);
+	_recvBuffer.SetNumUninitialized(64 * 1024);
+
+	_tickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &BCLocalRelayServer::Tick));
+	return true;
+}
+
+void BCLocalRelayServer::Stop()
+{
+	if (!IsRunning())
+		return;
+
+	FTicker::GetCoreTicker().RemoveTicker(_tickHandle);
+	_tickHandle.Reset();
+
+	_socket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(_socket);
+	_socket = nullptr;
+
+	_peers.Empty();
+	_delayed.Empty();
+}
+
+FString BCLocalRelayServer::GetConnectOptionsJson() const
+{
+	return FString::Printf(TEXT("{\"ssl\":\"false\",\"host\":\"127.0.0.1\",\"port\":\"%u\",\"passcode\":\"local\",\"lobbyId\":\"local\"}"), _port);
+}
+
+void BCLocalRelayServer::SetLatency(float minSeconds, float maxSeconds)
+{
+	_minLatency = minSeconds;
+	_maxLatency = FMath::Max(minSeconds, maxSeconds);
+}
+
+void BCLocalRelayServer::ClearReceived()
+{
+	_receivedRelays.Empty();
+	_pingCount = 0;
+	_ackCount = 0;
+	_droppedCount = 0;
+}
+
+bool BCLocalRelayServer::Tick(float deltaTime)
+{
+	ISocketSubsystem *socketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	TSharedRef<FInternetAddr> from = socketSubsystem->CreateInternetAddr();
+
+	uint32 pendingSize = 0;
+	while (_socket->HasPendingData(pendingSize))
+	{
+		int32 bytesRead = 0;
+		if (!_socket->RecvFrom(_recvBuffer.GetData(), _recvBuffer.Num(), bytesRead, *from))
+			break;
+
+		if (ShouldDrop())
+			continue;
+
+		HandleDatagram(from, _recvBuffer.GetData(), bytesRead);
+	}
+
+	double now = FPlatformTime::Seconds();
+	for (int32 i = 0; i < _delayed.Num();)
+	{
+		if (_delayed[i].SendTime > now)
+		{
+			++i;
+			continue;
+		}
+		SendNow(*_delayed[i].Addr, _delayed[i].Data);
+		_delayed.RemoveAt(i);
+	}
+
+	if (now - _lastResendTime >= RSMGResendInterval)
+	{
+		_lastResendTime = now;
+		for (Peer &peer : _peers)
+		{
+			for (const TPair<uint16, TArray<uint8>> &rsmg : peer.UnackedRSMG)
+				Send(peer.Addr, BrainCloudRelayComms::RS2CL_RSMG, rsmg.Value.GetData(), rsmg.Value.Num());
+		}
+	}
+
+	return true;
+}
+
+void BCLocalRelayServer::HandleDatagram(const TSharedRef<FInternetAddr> &from, const uint8 *data, int32 size)
+{
+	// length prefix and control byte
+	if (size < 3)
+		return;
+
+	uint8 controlByte = data[2];
+	const uint8 *payload = data + 3;
+	int32 payloadSize = size - 3;
+
+	if (controlByte == BrainCloudRelayComms::CL2RS_CONNECT)
+	{
+		HandleConnect(from, payload, payloadSize);
+		return;
+	}
+
+	Peer *peer = FindPeer(*from);
+	if (peer == nullptr)
+		return;
+
+	switch (controlByte)
+	{
+	case BrainCloudRelayComms::CL2RS_DISCONNECT:
+		_peers.RemoveAll([&from](const Peer &other) { return other.Addr->CompareEndpoints(*from); });
+		break;
+	case BrainCloudRelayComms::CL2RS_RELAY:
+		HandleRelay(*peer, payload, payloadSize);
+		break;
+	case BrainCloudRelayComms::CL2RS_ACK:
+		++_ackCount;
+		break;
+	case BrainCloudRelayComms::CL2RS_PING:
+	{
+		++_pingCount;
+
+		// with the server's utc clock, in ms since 1970, for the clock offset
+		uint64 serverMs = (uint64)(FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds();
+		uint8 pong[8];
+		for (int32 i = 0; i < 8; ++i)
+			pong[i] = (uint8)(serverMs >> (56 - 8 * i));
+		Send(peer->Addr, BrainCloudRelayComms::RS2CL_PONG, pong, 8);
+	}
+	break;
+	case BrainCloudRelayComms::CL2RS_RSMG_ACK:
+		if (payloadSize >= 2)
+			peer->UnackedRSMG.Remove(ReadShortBE(payload));
+		break;
+	default:
+		break;
+	}
+}
+
+void BCLocalRelayServer::HandleConnect(const TSharedRef<FInternetAddr> &from, const uint8 *payload, int32 size)
+{
+	// a repeated request, the CONNECT already sent is resent until acked
+	if (FindPeer(*from) != nullptr)
+		return;
+
+	FUTF8ToTCHAR converted(reinterpret_cast<const ANSICHAR *>(payload), size);
+	TSharedPtr<FJsonObject> request;
+	TSharedRef<TJsonReader<TCHAR>> reader = TJsonReaderFactory<TCHAR>::Create(FString(converted.Length(), converted.Get()));
+	if (!FJsonSerializer::Deserialize(reader, request) || !request.IsValid())
+		return;
+
+	int32 netId = 0;
+	while (_peers.ContainsByPredicate([netId](const Peer &other) { return other.NetId == netId; }))
+		++netId;
+	if (netId >= BrainCloudRelayComms::MAX_PLAYERS)
+		return;
+
+	Peer &peer = _peers[_peers.Emplace(from->Clone())];
+	peer.NetId = netId;
+	peer.ProfileId = request->GetStringField(TEXT("profileId"));
+
+	// everyone learns of the newcomer, the newcomer of everyone
+	const FString &ownerId = _peers[0].ProfileId;
+	int32 newIndex = _peers.Num() - 1;
+	for (int32 i = 0; i < _peers.Num(); ++i)
+	{
+		const Peer &other = _peers[i];
+		SendRSMG(_peers[i], FString::Printf(TEXT("{\"op\":\"CONNECT\",\"profileId\":\"%s\",\"ownerId\":\"%s\",\"netId\":%d}"), *_peers[newIndex].ProfileId, *ownerId, _peers[newIndex].NetId));
+		if (i != newIndex)
+			SendRSMG(_peers[newIndex], FString::Printf(TEXT("{\"op\":\"CONNECT\",\"profileId\":\"%s\",\"ownerId\":\"%s\",\"netId\":%d}"), *other.ProfileId, *ownerId, other.NetId));
+	}
+}
+
+void BCLocalRelayServer::HandleRelay(Peer &sender, const uint8 *payload, int32 size)
+{
+	// reliable header and player mask
+	if (size < 8)
+		return;
+
+	ReceivedRelay &received = _receivedRelays.AddDefaulted_GetRef();
+	received.NetId = sender.NetId;
+	received.ReliableHeader = ReadShortBE(payload);
+	for (int32 i = 2; i < 8; ++i)
+		received.PlayerMask = (received.PlayerMask << 8) | payload[i];
+	received.Data.Append(payload + 8, size - 8);
+
+	if ((received.ReliableHeader & ReliableBit) != 0)
+		Send(sender.Addr, BrainCloudRelayComms::RS2CL_ACK, payload, 8);
+
+	// the reliable header goes out as it came in, followed by the sender's net id
+	TArray<uint8> relay;
+	relay.SetNumZeroed(8);
+	relay[0] = payload[0];
+	relay[1] = payload[1];
+	relay[7] = (uint8)sender.NetId;
+	relay.Append(payload + 8, size - 8);
+
+	// the mask holds netId 0 in its highest bit, see BrainCloudRelayComms::sendRelay
+	uint64 targets = received.PlayerMask >> 8;
+	for (const Peer &peer : _peers)
+	{
+		if (((targets >> (BrainCloudRelayComms::MAX_PLAYERS - 1 - peer.NetId)) & 1) != 0)
+			Send(peer.Addr, BrainCloudRelayComms::RS2CL_RELAY, relay.GetData(), relay.Num());
+	}
+}
+
+void BCLocalRelayServer::SendRSMG(Peer &peer, const FString &json)
+{
+	uint16 rsmgPacketId = peer.NextRSMGId++;
+
+	FTCHARToUTF8 converted(*json);
+	TArray<uint8> payload;
+	payload.Add((uint8)(rsmgPacketId >> 8));
+	payload.Add((uint8)rsmgPacketId);
+	payload.Append(reinterpret_cast<const uint8 *>(converted.Get()), converted.Length());
+
+	Send(peer.Addr, BrainCloudRelayComms::RS2CL_RSMG, payload.GetData(), payload.Num());
+	peer.UnackedRSMG.Add(rsmgPacketId, MoveTemp(payload));
+}
+
+void BCLocalRelayServer::Send(const TSharedRef<FInternetAddr> &to, uint8 controlByte, const uint8 *payload, int32 size)
+{
+	uint16 length = (uint16)(size + 3);
+	TArray<uint8> datagram;
+	datagram.Reserve(length);
+	datagram.Add((uint8)(length >> 8));
+	datagram.Add((uint8)length);
+	datagram.Add(controlByte);
+	datagram.Append(payload, size);
+
+	if (ShouldDrop())
+		return;
+
+	if (_maxLatency > 0.0f)
+	{
+		double sendTime = FPlatformTime::Seconds() + _random.FRandRange(_minLatency, _maxLatency);
+		_delayed.Emplace(sendTime, to->Clone(), MoveTemp(datagram));
+		return;
+	}
+
+	SendNow(*to, datagram);
+}
+
+void BCLocalRelayServer::SendNow(const FInternetAddr &to, const TArray<uint8> &datagram)
+{
+	int32 bytesSent = 0;
+	_socket->SendTo(datagram.GetData(), datagram.Num(), bytesSent, to);
+}
+
+BCLocalRelayServer::Peer *BCLocalRelayServer::FindPeer(const FInternetAddr &addr)
+{
+	return _peers.FindByPredicate([&addr](const Peer &peer) { return peer.Addr->CompareEndpoints(addr); });
+}
+
+bool BCLocalRelayServer::ShouldDrop()
+{
+	if (_lossRate <= 0.0f || _random.FRand() >= _lossRate)
+		return false;
+
+	++_droppedCount;
+	return true;
+}
+
+#endif
@@ -0,0 +1,315 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCOfflineJournal.h"
+
+#include "Async/Async.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	const uint32 JournalMagic = 0x314A4342; // "BCJ1"
+	const uint8 AppendRecord = 1;
+	const uint8 AckRecord = 2;
+
+	// don't bother rewriting the file for less than this
+	const int32 MinCompactionBytes = 64 * 1024;
+}
+
+BCOfflineJournal::BCOfflineJournal(const FString &path, int32 maxBytes) : _path(path), _maxBytes(maxBytes)
+{
+	Load();
+}
+
+BCOfflineJournal::~BCOfflineJournal()
+{
+	if (_flushTask.IsValid())
+		_flushTask.Wait();
+
+	FlushPending();
+
+	FScopeLock fileLock(&_fileMutex);
+	delete _file;
+	_file = nullptr;
+}
+
+uint64 BCOfflineJournal::Append(const FString &profileId, const FString &service, const FString &operation, const TArray<uint8> &payload)
+{
+	FScopeLock lock(&_mutex);
+
+	Entry entry;
+	entry.Id = _nextId;
+	entry.ProfileId = profileId;
+	entry.Service = service;
+	entry.Operation = operation;
+	entry.Payload = payload;
+	entry.Live = true;
+
+	// the limit covers the whole record, as Acknowledge and Load count it
+	TArray<uint8> record;
+	WriteAppendRecord(entry, record);
+	if (_liveBytes + record.Num() > _maxBytes)
+		return 0;
+
+	++_nextId;
+	_liveBytes += record.Num();
+	_writeBuffer.Append(record);
+
+	_entries.Add(MoveTemp(entry));
+	return _entries.Last().Id;
+}
+
+void BCOfflineJournal::Acknowledge(uint64 id)
+{
+	FScopeLock lock(&_mutex);
+
+	int32 index = FindEntry(id);
+	if (index == INDEX_NONE)
+		return;
+
+	TArray<uint8> record;
+	WriteAppendRecord(_entries[index], record);
+	_liveBytes -= record.Num();
+	_deadBytes += record.Num();
+	_entries.RemoveAt(index);
+
+	int32 start = _writeBuffer.Num();
+	WriteAckRecord(id, _writeBuffer);
+	_deadBytes += _writeBuffer.Num() - start;
+
+	if (_deadBytes > _liveBytes && (_deadBytes > MinCompactionBytes || _entries.Num() == 0))
+		_needsCompaction = true;
+}
+
+void BCOfflineJournal::ReleaseAll()
+{
+	FScopeLock lock(&_mutex);
+
+	for (Entry &entry : _entries)
+		entry.Live = false;
+}
+
+void BCOfflineJournal::TakeDormant(const FString &profileId, TArray<Entry> &outEntries)
+{
+	FScopeLock lock(&_mutex);
+
+	// entries are kept in the order they were appended
+	for (Entry &entry : _entries)
+	{
+		if (!entry.Live && entry.ProfileId == profileId)
+		{
+			entry.Live = true;
+			outEntries.Add(entry);
+		}
+	}
+}
+
+void BCOfflineJournal::Tick()
+{
+	if (_flushTask.IsValid() && !_flushTask.IsReady())
+		return;
+
+	double now = FPlatformTime::Seconds();
+	if (now - _lastFlushTime < _flushInterval)
+		return;
+
+	{
+		FScopeLock lock(&_mutex);
+		if (_writeBuffer.Num() == 0 && !_needsCompaction)
+			return;
+	}
+
+	_lastFlushTime = now;
+	_flushTask = Async(EAsyncExecution::ThreadPool, [this]() { FlushPending(); });
+}
+
+void BCOfflineJournal::Load()
+{
+	// the app went away half way through a compaction
+	IPlatformFile &platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FString tempPath = _path + TEXT(".tmp");
+	if (!platformFile.FileExists(*_path) && platformFile.FileExists(*tempPath))
+		platformFile.MoveFile(*_path, *tempPath);
+
+	TArray<uint8> data;
+	if (!FFileHelper::LoadFileToArray(data, *_path, FILEREAD_Silent) || data.Num() < (int32)sizeof(uint32))
+		return;
+
+	FMemoryReader reader(data);
+	uint32 magic = 0;
+	reader << magic;
+	if (magic != JournalMagic)
+	{
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Ignoring unrecognized offline journal %s"), *_path);
+		_needsCompaction = true;
+		return;
+	}
+
+	while (data.Num() - reader.Tell() >= (int64)sizeof(uint32))
+	{
+		int32 recordLen = 0;
+		reader << recordLen;
+
+		// a record torn by the app being killed mid write, everything before it is good
+		if (recordLen <= 0 || data.Num() - reader.Tell() < recordLen)
+			break;
+
+		int64 recordEnd = reader.Tell() + recordLen;
+		uint8 type = 0;
+		uint64 id = 0;
+		reader << type;
+		reader << id;
+
+		if (type == AppendRecord)
+		{
+			Entry entry;
+			entry.Id = id;
+			reader << entry.ProfileId;
+			reader << entry.Service;
+			reader << entry.Operation;
+			reader << entry.Payload;
+			if (reader.IsError())
+				break;
+			_entries.Add(MoveTemp(entry));
+		}
+		else if (type == AckRecord)
+		{
+			int32 index = FindEntry(id);
+			if (index != INDEX_NONE)
+				_entries.RemoveAt(index);
+		}
+
+		_nextId = FMath::Max(_nextId, id + 1);
+		reader.Seek(recordEnd);
+	}
+
+	for (const Entry &entry : _entries)
+	{
+		TArray<uint8> record;
+		WriteAppendRecord(entry, record);
+		_liveBytes += record.Num();
+	}
+
+	// start the session from a clean file
+	_needsCompaction = true;
+}
+
+void BCOfflineJournal::WriteAppendRecord(const Entry &entry, TArray<uint8> &out)
+{
+	TArray<uint8> body;
+	FMemoryWriter writer(body);
+	uint8 type = AppendRecord;
+	uint64 id = entry.Id;
+	writer << type;
+	writer << id;
+	writer << const_cast<FString &>(entry.ProfileId);
+	writer << const_cast<FString &>(entry.Service);
+	writer << const_cast<FString &>(entry.Operation);
+	writer << const_cast<TArray<uint8> &>(entry.Payload);
+
+	FMemoryWriter framer(out, false, true);
+	int32 recordLen = body.Num();
+	framer << recordLen;
+	out.Append(body);
+}
+
+void BCOfflineJournal::WriteAckRecord(uint64 id, TArray<uint8> &out)
+{
+	FMemoryWriter framer(out, false, true);
+	int32 recordLen = sizeof(uint8) + sizeof(uint64);
+	uint8 type = AckRecord;
+	framer << recordLen;
+	framer << type;
+	framer << id;
+}
+
+void BCOfflineJournal::FlushPending()
+{
+	TArray<uint8> batch;
+	bool rewrite = false;
+	{
+		FScopeLock lock(&_mutex);
+		if (_needsCompaction)
+		{
+			// everything in the write buffer is already reflected in the entries
+			FMemoryWriter writer(batch);
+			uint32 magic = JournalMagic;
+			writer << magic;
+			for (const Entry &entry : _entries)
+				WriteAppendRecord(entry, batch);
+
+			_writeBuffer.Reset();
+			_deadBytes = 0;
+			_needsCompaction = false;
+			rewrite = true;
+		}
+		else
+		{
+			batch = MoveTemp(_writeBuffer);
+		}
+	}
+
+	if (batch.Num() == 0)
+		return;
+
+	FScopeLock fileLock(&_fileMutex);
+	IPlatformFile &platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	platformFile.CreateDirectoryTree(*FPaths::GetPath(_path));
+
+	if (rewrite)
+	{
+		delete _file;
+		_file = nullptr;
+
+		// write the compacted copy aside first so a crash never leaves a half file behind
+		FString tempPath = _path + TEXT(".tmp");
+		IFileHandle *tempFile = platformFile.OpenWrite(*tempPath);
+		if (tempFile == nullptr)
+		{
+			UE_LOG(LogBrainCloudComms, Warning, TEXT("Could not write offline journal %s"), *tempPath);
+			FScopeLock lock(&_mutex);
+			_needsCompaction = true;
+			return;
+		}
+		tempFile->Write(batch.GetData(), batch.Num());
+		tempFile->Flush(true);
+		delete tempFile;
+
+		platformFile.DeleteFile(*_path);
+		platformFile.MoveFile(*_path, *tempPath);
+		return;
+	}
+
+	if (_file == nullptr)
+	{
+		bool isNewFile = !platformFile.FileExists(*_path);
+		_file = platformFile.OpenWrite(*_path, true);
+		if (_file == nullptr)
+		{
+			UE_LOG(LogBrainCloudComms, Warning, TEXT("Could not open offline journal %s"), *_path);
+
+			// keep the records for the next attempt
+			FScopeLock lock(&_mutex);
+			batch.Append(_writeBuffer);
+			_writeBuffer = MoveTemp(batch);
+			return;
+		}
+
+		if (isNewFile)
+		{
+			uint32 magic = JournalMagic;
+			_file->Write(reinterpret_cast<const uint8 *>(&magic), sizeof(magic));
+		}
+	}
+
+	_file->Write(batch.GetData(), batch.Num());
+	_file->Flush(true);
+}
+
+int32 BCOfflineJournal::FindEntry(uint64 id) const
+{
+	return _entries.IndexOfByPredicate([id](const Entry &entry) { return entry.Id == id; });
+}
@@ -0,0 +1,86 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Async/Future.h"
+
+class IFileHandle;
+
+/**
+ * Append only on-disk log of durable server calls.
+ *
+ * Calls are appended when they are queued and acknowledged once the server
+ * has answered them. Whatever is left unacknowledged when the app goes away
+ * is handed back by TakeDormant on the next authentication so it can be sent
+ * again, in the order it was originally queued.
+ *
+ * Records are buffered in memory and written out in batches on the thread
+ * pool, so neither the game thread nor the comms thread waits on the disk.
+ * The file is rewritten without the acknowledged records once they make up
+ * most of it.
+ */
+class BCOfflineJournal
+{
+  public:
+	struct Entry
+	{
+		uint64 Id = 0;
+		FString ProfileId;
+		FString Service;
+		FString Operation;
+		TArray<uint8> Payload;
+		// the call is queued or in flight in this session
+		bool Live = false;
+	};
+
+	BCOfflineJournal(const FString &path, int32 maxBytes);
+	~BCOfflineJournal();
+
+	/**
+	 * Add a serialized call to the journal.
+	 *
+	 * @return the journal id of the call, 0 if the journal is full
+	 */
+	uint64 Append(const FString &profileId, const FString &service, const FString &operation, const TArray<uint8> &payload);
+
+	// the app was told how the call went, it will not be replayed
+	void Acknowledge(uint64 id);
+
+	// the calls were dropped without telling the app, replay them on the next authentication
+	void ReleaseAll();
+
+	// hands out the dormant calls of a profile, oldest first, and marks them live
+	void TakeDormant(const FString &profileId, TArray<Entry> &outEntries);
+
+	// start a background write of the buffered records if the flush interval has passed
+	void Tick();
+	void SetMaxBytes(int32 maxBytes) { _maxBytes = maxBytes; }
+
+  private:
+	void Load();
+	void WriteAppendRecord(const Entry &entry, TArray<uint8> &out);
+	void WriteAckRecord(uint64 id, TArray<uint8> &out);
+	void FlushPending();
+	int32 FindEntry(uint64 id) const;
+
+	FString _path;
+	int32 _maxBytes;
+
+	// guards the entries and the write buffer
+	FCriticalSection _mutex;
+	TArray<Entry> _entries;
+	TArray<uint8> _writeBuffer;
+	uint64 _nextId = 1;
+	// size on disk of the append records of _entries, what _maxBytes limits
+	int32 _liveBytes = 0;
+	int32 _deadBytes = 0;
+	bool _needsCompaction = false;
+
+	// only touched by the flush task
+	FCriticalSection _fileMutex;
+	IFileHandle *_file = nullptr;
+
+	TFuture<void> _flushTask;
+	double _lastFlushTime = 0.0;
+	float _flushInterval = 0.25f;
+};
@@ -0,0 +1,230 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCPacketCapture.h"
+
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "JsonUtil.h"
+#include "ServiceName.h"
+
+namespace
+{
+	const uint32 CaptureMagic = 0x31434342; // "BCC1"
+
+	// records are written out once this much is buffered
+	const int32 FlushBytes = 64 * 1024;
+
+	const TCHAR *const RedactedValue = TEXT("REDACTED");
+
+	// credentials carried in the data of authentication and identity calls
+	const TCHAR *const RedactedFields[] = {TEXT("authenticationToken"), TEXT("password"), TEXT("secret")};
+
+	// what an authentication answers with, enough to carry on its session
+	const TCHAR *const RedactedSessionFields[] = {TEXT("sessionId"), TEXT("profileId")};
+
+	TSharedPtr<FJsonObject> ParseBody(const TArray<uint8> &body)
+	{
+		FUTF8ToTCHAR converted(reinterpret_cast<const ANSICHAR *>(body.GetData()), body.Num());
+		return JsonUtil::jsonStringToValue(FString(converted.Length(), converted.Get()));
+	}
+
+	void WriteBody(TArray<uint8> &body, const TSharedRef<FJsonObject> &json)
+	{
+		FTCHARToUTF8 converted(*JsonUtil::jsonValueToString(json));
+		body.Reset();
+		body.Append(reinterpret_cast<const uint8 *>(converted.Get()), converted.Length());
+	}
+
+	bool RedactFields(const TSharedPtr<FJsonObject> &object, const TCHAR *const *fields, int32 numFields)
+	{
+		bool isRedacted = false;
+		for (int32 i = 0; i < numFields; ++i)
+		{
+			if (object->HasField(fields[i]))
+			{
+				object->SetStringField(fields[i], RedactedValue);
+				isRedacted = true;
+			}
+		}
+		return isRedacted;
+	}
+
+	/**
+	 * Blanks out the signature header, the bundle's session, the credentials
+	 * of any authentication in the bundle and the session it is answered
+	 * with, none of them belong in a file on disk.
+	 */
+	void RedactExchange(BCPacketCapture::Exchange &exchange)
+	{
+		for (FString &header : exchange.RequestHeaders)
+		{
+			if (header.StartsWith(TEXT("X-SIG:")))
+				header = FString::Printf(TEXT("X-SIG: %s"), RedactedValue);
+		}
+
+		TSharedPtr<FJsonObject> bundle = ParseBody(exchange.RequestBody);
+		if (!bundle.IsValid())
+			return;
+
+		bool isRedacted = false;
+		if (bundle->HasField(TEXT("sessionId")))
+		{
+			bundle->SetStringField(TEXT("sessionId"), RedactedValue);
+			isRedacted = true;
+		}
+
+		// responses come back in the order of the messages
+		TArray<int32> authentications;
+		const TArray<TSharedPtr<FJsonValue>> *messages = nullptr;
+		if (bundle->TryGetArrayField(TEXT("messages"), messages))
+		{
+			for (int32 i = 0; i < messages->Num(); ++i)
+			{
+				const TSharedPtr<FJsonObject> *messageObject = nullptr;
+				const TSharedPtr<FJsonObject> *data = nullptr;
+				FString service;
+				if (!(*messages)[i]->TryGetObject(messageObject) || !(*messageObject)->TryGetStringField(TEXT("service"), service) ||
+					!(*messageObject)->TryGetObjectField(TEXT("data"), data))
+					continue;
+
+				if (service != ServiceName::AuthenticateV2.getValue() && service != ServiceName::Identity.getValue())
+					continue;
+
+				if (service == ServiceName::AuthenticateV2.getValue())
+					authentications.Add(i);
+
+				isRedacted |= RedactFields(*data, RedactedFields, UE_ARRAY_COUNT(RedactedFields));
+			}
+		}
+
+		if (isRedacted)
+			WriteBody(exchange.RequestBody, bundle.ToSharedRef());
+
+		if (authentications.Num() == 0)
+			return;
+
+		TSharedPtr<FJsonObject> responseBundle = ParseBody(exchange.ResponseBody);
+		const TArray<TSharedPtr<FJsonValue>> *responses = nullptr;
+		if (!responseBundle.IsValid() || !responseBundle->TryGetArrayField(TEXT("responses"), responses))
+			return;
+
+		bool isResponseRedacted = false;
+		for (int32 index : authentications)
+		{
+			const TSharedPtr<FJsonObject> *response = nullptr;
+			const TSharedPtr<FJsonObject> *data = nullptr;
+			if (index < responses->Num() && (*responses)[index]->TryGetObject(response) && (*response)->TryGetObjectField(TEXT("data"), data))
+				isResponseRedacted |= RedactFields(*data, RedactedSessionFields, UE_ARRAY_COUNT(RedactedSessionFields));
+		}
+
+		if (isResponseRedacted)
+			WriteBody(exchange.ResponseBody, responseBundle.ToSharedRef());
+	}
+
+	void SerializeExchange(FArchive &ar, BCPacketCapture::Exchange &exchange)
+	{
+		ar << exchange.SendTime;
+		ar << exchange.ResponseTime;
+		ar << exchange.PacketId;
+		ar << exchange.MessageCount;
+		ar << exchange.RequestHeaders;
+		ar << exchange.RequestBody;
+		ar << exchange.StatusCode;
+		ar << exchange.ResponseBody;
+	}
+}
+
+FString BCPacketCapture::Exchange::GetResponseString() const
+{
+	FUTF8ToTCHAR converted(reinterpret_cast<const ANSICHAR *>(ResponseBody.GetData()), ResponseBody.Num());
+	return FString(converted.Length(), converted.Get());
+}
+
+BCPacketCapture::BCPacketCapture(IFileHandle *file) : _file(file), _startTime(FPlatformTime::Seconds())
+{
+	FMemoryWriter writer(_buffer);
+	uint32 magic = CaptureMagic;
+	writer << magic;
+}
+
+BCPacketCapture::~BCPacketCapture()
+{
+	Flush();
+	delete _file;
+}
+
+BCPacketCapture *BCPacketCapture::Create(const FString &path)
+{
+	IPlatformFile &platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	platformFile.CreateDirectoryTree(*FPaths::GetPath(path));
+
+	IFileHandle *file = platformFile.OpenWrite(*path);
+	if (file == nullptr)
+		return nullptr;
+
+	return new BCPacketCapture(file);
+}
+
+bool BCPacketCapture::Load(const FString &path, TArray<Exchange> &outExchanges)
+{
+	TArray<uint8> data;
+	if (!FFileHelper::LoadFileToArray(data, *path, FILEREAD_Silent) || data.Num() < (int32)sizeof(uint32))
+		return false;
+
+	FMemoryReader reader(data);
+	uint32 magic = 0;
+	reader << magic;
+	if (magic != CaptureMagic)
+		return false;
+
+	while (data.Num() - reader.Tell() >= (int64)sizeof(int32))
+	{
+		int32 recordLen = 0;
+		reader << recordLen;
+
+		// the capture was cut short mid record
+		if (recordLen <= 0 || data.Num() - reader.Tell() < recordLen)
+			break;
+
+		int64 recordEnd = reader.Tell() + recordLen;
+		Exchange exchange;
+		SerializeExchange(reader, exchange);
+		if (reader.IsError())
+			break;
+
+		outExchanges.Add(MoveTemp(exchange));
+		reader.Seek(recordEnd);
+	}
+	return true;
+}
+
+void BCPacketCapture::Write(const Exchange &exchange)
+{
+	Exchange redacted = exchange;
+	RedactExchange(redacted);
+
+	TArray<uint8> record;
+	FMemoryWriter writer(record);
+	SerializeExchange(writer, redacted);
+
+	FMemoryWriter framer(_buffer, false, true);
+	int32 recordLen = record.Num();
+	framer << recordLen;
+	_buffer.Append(record);
+
+	if (_buffer.Num() >= FlushBytes)
+		Flush();
+}
+
+void BCPacketCapture::Flush()
+{
+	if (_buffer.Num() == 0)
+		return;
+
+	_file->Write(_buffer.GetData(), _buffer.Num());
+	_file->Flush();
+	_buffer.Reset();
+}
@@ -0,0 +1,54 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+class IFileHandle;
+
+/**
+ * On-disk log of the request bundles sent to the server and what came back,
+ * see BrainCloudClient::startPacketCapture.
+ *
+ * Each exchange is one length prefixed record so a capture cut short by the
+ * app going away can still be read up to its last whole record. Records are
+ * buffered and written out in blocks. The X-SIG header, the bundle's session
+ * id, the credentials of authentication calls and the session and profile
+ * ids they are answered with are redacted before anything is written.
+ */
+class BCPacketCapture
+{
+  public:
+	struct Exchange
+	{
+		// seconds since the capture started
+		double SendTime = 0.0;
+		// seconds from the first send until the response was handled
+		double ResponseTime = 0.0;
+		uint64 PacketId = 0;
+		int32 MessageCount = 0;
+		TArray<FString> RequestHeaders;
+		TArray<uint8> RequestBody;
+		// HttpCode::CLIENT_NETWORK_ERROR if the packet never got an answer
+		int32 StatusCode = 0;
+		// utf8
+		TArray<uint8> ResponseBody;
+
+		FString GetResponseString() const;
+	};
+
+	~BCPacketCapture();
+
+	// nullptr if the file can't be created
+	static BCPacketCapture *Create(const FString &path);
+	static bool Load(const FString &path, TArray<Exchange> &outExchanges);
+
+	void Write(const Exchange &exchange);
+	double GetElapsedTime() const { return FPlatformTime::Seconds() - _startTime; }
+
+  private:
+	BCPacketCapture(IFileHandle *file);
+	void Flush();
+
+	IFileHandle *_file;
+	TArray<uint8> _buffer;
+	double _startTime;
+};
@@ -0,0 +1,70 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCSubmissionQueue.h"
+
+BCSubmissionQueue::BCSubmissionQueue()
+	: _stub(ServiceName::None, ServiceOperation::None, TArray<uint8>()),
+	  _head(&_stub),
+	  _tail(&_stub),
+	  _count(0)
+{
+}
+
+BCSubmissionQueue::~BCSubmissionQueue()
+{
+	while (ServerCall *serverCall = Pop())
+		delete serverCall;
+}
+
+void BCSubmissionQueue::Push(ServerCall *serverCall)
+{
+	_count.IncrementExchange();
+	PushNode(serverCall);
+}
+
+void BCSubmissionQueue::PushNode(ServerCall *node)
+{
+	node->_nextSubmitted.Store(nullptr);
+	ServerCall *previous = _head.Exchange(node);
+	// between the exchange and this store the list is briefly cut, Pop
+	// treats that as empty and picks the call up on the next pass
+	previous->_nextSubmitted.Store(node);
+}
+
+ServerCall *BCSubmissionQueue::Pop()
+{
+	ServerCall *tail = _tail;
+	ServerCall *next = tail->_nextSubmitted.Load();
+
+	if (tail == &_stub)
+	{
+		if (next == nullptr)
+			return nullptr;
+
+		_tail = next;
+		tail = next;
+		next = next->_nextSubmitted.Load();
+	}
+
+	if (next != nullptr)
+	{
+		_tail = next;
+		_count.DecrementExchange();
+		return tail;
+	}
+
+	if (tail != _head.Load())
+		return nullptr;
+
+	// tail is the last call, put the stub back behind it so it can be handed out
+	PushNode(&_stub);
+	next = tail->_nextSubmitted.Load();
+	if (next != nullptr)
+	{
+		_tail = next;
+		_count.DecrementExchange();
+		return tail;
+	}
+	return nullptr;
+}
@@ -0,0 +1,40 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Templates/Atomic.h"
+#include "ServerCall.h"
+
+/**
+ * Lock free multi producer, single consumer queue of server calls waiting
+ * to be sorted into the comms message lanes.
+ *
+ * Calls are linked through ServerCall::_nextSubmitted so pushing allocates
+ * nothing. Any thread may Push, Pop must only be called by one thread at a
+ * time (the comms do it under _queueMutex).
+ */
+class BCSubmissionQueue
+{
+  public:
+	BCSubmissionQueue();
+	~BCSubmissionQueue();
+
+	void Push(ServerCall *serverCall);
+
+	// oldest call first, nullptr when empty or a push is half way through
+	ServerCall *Pop();
+
+	int32 Num() const { return _count.Load(); }
+
+  private:
+	void PushNode(ServerCall *node);
+
+	// placeholder which keeps the list from ever being empty
+	ServerCall _stub;
+
+	// producers swap themselves in here
+	TAtomic<ServerCall *> _head;
+	// consumer only
+	ServerCall *_tail;
+	TAtomic<int32> _count;
+};
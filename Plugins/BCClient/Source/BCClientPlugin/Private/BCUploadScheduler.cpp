@@ -0,0 +1,146 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "BCUploadScheduler.h"
+
+#include "BCFileUploader.h"
+#include "IFileUploadCallback.h"
+
+namespace
+{
+	// first retry after this many seconds, doubling with each one
+	const double RetryDelaySeconds = 2.0;
+	const double MaxRetryDelaySeconds = 30.0;
+}
+
+void BCUploadScheduler::Enqueue(TSharedRef<BCFileUploader> uploader, const FString &uploadId, const FString &localPath, const FString &sessionId, const FString &uploadUrl)
+{
+	FScopeLock Lock(&_mutex);
+	Upload &upload = _uploads.Add(uploadId, Upload(uploader));
+	upload.LocalPath = localPath;
+	upload.SessionId = sessionId;
+	upload.UploadUrl = uploadUrl;
+	_waiting.Add(uploadId);
+}
+
+void BCUploadScheduler::Update(IFileUploadCallback *callback)
+{
+	TArray<TPair<FString, TSharedRef<BCFileUploader>>> finished;
+
+	_mutex.Lock();
+	if (_uploads.Num() == 0)
+	{
+		_mutex.Unlock();
+		return;
+	}
+
+	double now = FPlatformTime::Seconds();
+	int32 uploadingCount = 0;
+	for (auto itr = _uploads.CreateIterator(); itr; ++itr)
+	{
+		Upload &upload = itr.Value();
+		if (upload.IsWaiting)
+			continue;
+
+		BCFileUploader::EFileUploaderStatus status = upload.Uploader->GetStatus();
+		if (status == BCFileUploader::UPLOAD_STATUS_UPLOADING)
+		{
+			int32 bytesSent = upload.Uploader->GetBytesTransferred();
+			if (bytesSent > upload.BytesSent)
+			{
+				_rateWindowBytes += bytesSent - upload.BytesSent;
+				upload.BytesSent = bytesSent;
+			}
+			++uploadingCount;
+		}
+		else if (status == BCFileUploader::UPLOAD_STATUS_COMPLETE_FAILED && upload.Uploader->CanRetry() && upload.Retries < _maxRetries)
+		{
+			++upload.Retries;
+			upload.RetryTime = now + FMath::Min(RetryDelaySeconds * (1 << (upload.Retries - 1)), MaxRetryDelaySeconds);
+			upload.BytesSent = 0;
+			upload.IsWaiting = true;
+			_waiting.Add(itr.Key());
+		}
+		else if (status == BCFileUploader::UPLOAD_STATUS_COMPLETE_SUCCESS || status == BCFileUploader::UPLOAD_STATUS_COMPLETE_FAILED)
+		{
+			finished.Emplace(itr.Key(), upload.Uploader);
+			itr.RemoveCurrent();
+		}
+	}
+
+	if (now - _rateWindowStart >= 1.0)
+	{
+		_bytesPerSecond = _rateWindowStart > 0.0 ? _rateWindowBytes / (now - _rateWindowStart) : 0.0;
+		_rateWindowStart = now;
+		_rateWindowBytes = 0;
+	}
+
+	StartWaitingUploads(uploadingCount, now);
+	_mutex.Unlock();
+
+	// outside the lock, the callbacks may well start or cancel uploads
+	if (callback == nullptr)
+		return;
+
+	for (const TPair<FString, TSharedRef<BCFileUploader>> &upload : finished)
+	{
+		if (upload.Value->GetStatus() == BCFileUploader::UPLOAD_STATUS_COMPLETE_SUCCESS)
+			callback->fileUploadCompleted(upload.Key, upload.Value->GetResponse());
+		else
+			callback->fileUploadFailed(upload.Key, upload.Value->GetHttpStatus(), upload.Value->GetErrorReasonCode(), upload.Value->GetResponse());
+	}
+}
+
+void BCUploadScheduler::StartWaitingUploads(int32 uploadingCount, double now)
+{
+	for (int32 i = 0; i < _waiting.Num();)
+	{
+		if (_maxConcurrentUploads > 0 && uploadingCount >= _maxConcurrentUploads)
+			break;
+
+		// uploads already going can't be slowed down, but no more are added
+		if (_maxBytesPerSecond > 0 && _bytesPerSecond >= _maxBytesPerSecond)
+			break;
+
+		FString uploadId = _waiting[i];
+		Upload &upload = _uploads.FindChecked(uploadId);
+		if (upload.RetryTime > now)
+		{
+			++i;
+			continue;
+		}
+
+		_waiting.RemoveAt(i);
+		upload.IsWaiting = false;
+
+		bool isStarted = upload.IsStarted ? upload.Uploader->RestartUpload() : upload.Uploader->UploadFile(upload.LocalPath, upload.SessionId, uploadId, upload.UploadUrl);
+		upload.IsStarted = true;
+		if (isStarted)
+			++uploadingCount;
+	}
+}
+
+void BCUploadScheduler::Cancel(const FString &uploadId)
+{
+	FScopeLock Lock(&_mutex);
+	Upload *upload = _uploads.Find(uploadId);
+	if (upload == nullptr)
+		return;
+
+	// a waiting upload is reported as failed on the next update
+	if (upload->IsWaiting)
+	{
+		_waiting.Remove(uploadId);
+		upload->IsWaiting = false;
+	}
+	upload->Uploader->CancelUpload();
+}
+
+TSharedPtr<BCFileUploader> BCUploadScheduler::Find(const FString &uploadId)
+{
+	FScopeLock Lock(&_mutex);
+	Upload *upload = _uploads.Find(uploadId);
+	if (upload == nullptr)
+		return nullptr;
+	return upload->Uploader;
+}
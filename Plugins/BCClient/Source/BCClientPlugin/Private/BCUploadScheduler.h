@@ -0,0 +1,63 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+class BCFileUploader;
+class IFileUploadCallback;
+
+/**
+ * Runs the file uploads prepared by the server, see
+ * BrainCloudClient::setMaxConcurrentUploads.
+ *
+ * Uploads wait in order until there is room under the concurrency and
+ * bandwidth limits. One which fails on the network is sent again, after a
+ * growing delay, until it runs out of retries. Uploads are kept by upload id.
+ */
+class BCUploadScheduler
+{
+  public:
+	// may be called from any thread, the upload starts on a later Update
+	void Enqueue(TSharedRef<BCFileUploader> uploader, const FString &uploadId, const FString &localPath, const FString &sessionId, const FString &uploadUrl);
+	void Update(IFileUploadCallback *callback);
+	void Cancel(const FString &uploadId);
+	TSharedPtr<BCFileUploader> Find(const FString &uploadId);
+
+	void SetMaxConcurrentUploads(int32 maxUploads) { _maxConcurrentUploads = maxUploads; }
+	void SetMaxBytesPerSecond(int32 bytesPerSec) { _maxBytesPerSecond = bytesPerSec; }
+	void SetMaxRetries(int32 maxRetries) { _maxRetries = maxRetries; }
+	int32 GetMaxConcurrentUploads() const { return _maxConcurrentUploads; }
+	int32 GetMaxBytesPerSecond() const { return _maxBytesPerSecond; }
+	int32 GetMaxRetries() const { return _maxRetries; }
+
+  private:
+	struct Upload
+	{
+		Upload(TSharedRef<BCFileUploader> uploader) : Uploader(uploader) {}
+
+		TSharedRef<BCFileUploader> Uploader;
+		FString LocalPath;
+		FString SessionId;
+		FString UploadUrl;
+		bool IsStarted = false;
+		bool IsWaiting = true;
+		int32 Retries = 0;
+		double RetryTime = 0.0;
+		int32 BytesSent = 0;
+	};
+
+	void StartWaitingUploads(int32 uploadingCount, double now);
+
+	FCriticalSection _mutex;
+	TMap<FString, Upload> _uploads;
+	// upload ids in the order they go out
+	TArray<FString> _waiting;
+
+	int32 _maxConcurrentUploads = 0;
+	int32 _maxBytesPerSecond = 0;
+	int32 _maxRetries = 2;
+
+	// upload rate over the last second or so, across every upload
+	double _rateWindowStart = 0.0;
+	int64 _rateWindowBytes = 0;
+	double _bytesPerSecond = 0.0;
+};
@@ -98,6 +98,11 @@ void UBCClientProxy::SetErrorCallbackOn202Status(UBrainCloudWrapper *brainCloudW
 	UBCWrapperProxy::GetBrainCloudInstance(brainCloudWrapper)->getBCClient()->setErrorCallbackOn202Status(isError);
 }
 
+void UBCClientProxy::SetMaxPacketsInFlight(UBrainCloudWrapper *brainCloudWrapper, int32 maxPacketsInFlight)
+{
+	UBCWrapperProxy::GetBrainCloudInstance(brainCloudWrapper)->getBCClient()->setMaxPacketsInFlight(maxPacketsInFlight);
+}
+
 void UBCClientProxy::SetUploadLowTransferRateTimeout(UBrainCloudWrapper *brainCloudWrapper, int32 timeoutSecs)
 {
 	UBCWrapperProxy::GetBrainCloudInstance(brainCloudWrapper)->getBCClient()->setUploadLowTransferRateTimeout(timeoutSecs);
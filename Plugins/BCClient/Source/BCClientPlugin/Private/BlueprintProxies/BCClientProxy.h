@@ -200,6 +200,17 @@ class UBCClientProxy : public UBCBlueprintCallProxyBase
 	UFUNCTION(BlueprintCallable, Category = "BrainCloud|Client")
 	static void SetErrorCallbackOn202Status(UBrainCloudWrapper *brainCloudWrapper, bool isError);
 
+	/**
+	* Sets how many request bundles may be waiting on the server at the same
+	* time. With the default of 1 a bundle is only sent once the previous one
+	* has been fully reported. Callbacks still run in the order the bundles
+	* were sent and authentication is never pipelined.
+	*
+	* Param - maxPacketsInFlight The number of outstanding bundles, minimum 1
+	*/
+	UFUNCTION(BlueprintCallable, Category = "BrainCloud|Client")
+	static void SetMaxPacketsInFlight(UBrainCloudWrapper *brainCloudWrapper, int32 maxPacketsInFlight);
+
 	UFUNCTION(BlueprintCallable, Category = "BrainCloud|Client")
 	static const FString &GetAppId(UBrainCloudWrapper *brainCloudWrapper);
 
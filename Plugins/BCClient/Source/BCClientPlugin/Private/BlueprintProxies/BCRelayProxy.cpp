@@ -74,6 +74,11 @@ void UBCRelayProxy::SetPingInterval(UBrainCloudWrapper *brainCloudWrapper, float
 	UBCWrapperProxy::GetBrainCloudInstance(brainCloudWrapper)->getRelayService()->setPingInterval(in_value);
 }
 
+FBC_RelayStats UBCRelayProxy::GetStats(UBrainCloudWrapper *brainCloudWrapper)
+{
+	return UBCWrapperProxy::GetBrainCloudInstance(brainCloudWrapper)->getRelayService()->getStats();
+}
+
 FString UBCRelayProxy::BCBytesToString(const TArray<uint8>& in_data)
 {
 	FString parsedMessage = BrainCloudRelay::BCBytesToString(in_data.GetData(), in_data.Num());
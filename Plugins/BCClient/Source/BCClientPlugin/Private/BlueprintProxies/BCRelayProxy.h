@@ -118,6 +118,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "BrainCloud|Relay")
 	static void SetPingInterval(UBrainCloudWrapper *brainCloudWrapper, float in_value);
 
+	/**
+	* Connection quality: round trip, jitter, loss, traffic and server clock offset.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "BrainCloud|Relay")
+	static FBC_RelayStats GetStats(UBrainCloudWrapper *brainCloudWrapper);
+
 	/** 
  	* Convert an array of bytes to a TCHAR
  	* @param In byte array values to convert
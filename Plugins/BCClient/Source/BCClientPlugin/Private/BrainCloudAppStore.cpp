@@ -12,8 +12,8 @@ BrainCloudAppStore::BrainCloudAppStore(BrainCloudClient *client) : _client(clien
 void BrainCloudAppStore::verifyPurchase(const FString &in_storeId, const FString &in_jsonReceiptData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AppStoreId.getValue(), in_storeId);
-    message->SetObjectField(OperationParam::AppStoreJsonReceiptData.getValue(), JsonUtil::jsonStringToValue(in_jsonReceiptData));
+    message->SetStringField(OperationParam::AppStoreId.getKey(), in_storeId);
+    message->SetObjectField(OperationParam::AppStoreJsonReceiptData.getKey(), JsonUtil::jsonStringToValue(in_jsonReceiptData));
 
     ServerCall *sc = new ServerCall(ServiceName::AppStore, ServiceOperation::VerifyPurchase, message, callback);
     _client->sendRequest(sc);
@@ -35,18 +35,18 @@ void BrainCloudAppStore::getSalesInventory(const FString &in_storeId, const FStr
 void BrainCloudAppStore::getSalesInventoryByCategory(const FString &in_storeId, const FString &in_userCurrency, const FString &in_category, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AppStoreId.getValue(), in_storeId);
+    message->SetStringField(OperationParam::AppStoreId.getKey(), in_storeId);
     if (!in_category.IsEmpty())
     {
-        message->SetStringField(OperationParam::AppStoreCategory.getValue(), in_category);
+        message->SetStringField(OperationParam::AppStoreCategory.getKey(), in_category);
     }
 
     TSharedRef<FJsonObject> priceInfoCriteria = MakeShareable(new FJsonObject());
     if (!in_userCurrency.IsEmpty())
     {
-        priceInfoCriteria->SetStringField(OperationParam::AppStoreUserCurrency.getValue(), in_userCurrency);
+        priceInfoCriteria->SetStringField(OperationParam::AppStoreUserCurrency.getKey(), in_userCurrency);
     }
-    message->SetObjectField(OperationParam::AppStorePriceInfoCriteria.getValue(), priceInfoCriteria);
+    message->SetObjectField(OperationParam::AppStorePriceInfoCriteria.getKey(), priceInfoCriteria);
 
     ServerCall *sc = new ServerCall(ServiceName::AppStore, ServiceOperation::GetSalesInventory, message, callback);
     _client->sendRequest(sc);
@@ -55,8 +55,8 @@ void BrainCloudAppStore::getSalesInventoryByCategory(const FString &in_storeId,
 void BrainCloudAppStore::startPurchase(const FString &in_storeId, const FString &in_jsonPurchaseData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AppStoreId.getValue(), in_storeId);
-    message->SetObjectField(OperationParam::AppStoreJsonPurchaseData.getValue(), JsonUtil::jsonStringToValue(in_jsonPurchaseData));
+    message->SetStringField(OperationParam::AppStoreId.getKey(), in_storeId);
+    message->SetObjectField(OperationParam::AppStoreJsonPurchaseData.getKey(), JsonUtil::jsonStringToValue(in_jsonPurchaseData));
 
     ServerCall *sc = new ServerCall(ServiceName::AppStore, ServiceOperation::StartPurchase, message, callback);
     _client->sendRequest(sc);
@@ -65,9 +65,9 @@ void BrainCloudAppStore::startPurchase(const FString &in_storeId, const FString
 void BrainCloudAppStore::finalizePurchase(const FString &in_storeId, const FString &in_transactionId, const FString &in_jsonTransactionData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AppStoreId.getValue(), in_storeId);
-    message->SetStringField(OperationParam::AppStoreTransactionId.getValue(), in_transactionId);
-    message->SetObjectField(OperationParam::AppStoreJsonTransactionData.getValue(), JsonUtil::jsonStringToValue(in_jsonTransactionData));
+    message->SetStringField(OperationParam::AppStoreId.getKey(), in_storeId);
+    message->SetStringField(OperationParam::AppStoreTransactionId.getKey(), in_transactionId);
+    message->SetObjectField(OperationParam::AppStoreJsonTransactionData.getKey(), JsonUtil::jsonStringToValue(in_jsonTransactionData));
 
     ServerCall *sc = new ServerCall(ServiceName::AppStore, ServiceOperation::FinalizePurchase, message, callback);
     _client->sendRequest(sc);
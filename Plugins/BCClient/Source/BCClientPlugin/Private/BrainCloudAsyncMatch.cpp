@@ -26,26 +26,26 @@ void BrainCloudAsyncMatch::createMatchWithInitialTurn(
     IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetField(OperationParam::AsyncMatchServicePlayers.getValue(), JsonUtil::jsonStringToActualValue(jsonOpponentIds));
+    message->SetField(OperationParam::AsyncMatchServicePlayers.getKey(), JsonUtil::jsonStringToActualValue(jsonOpponentIds));
     if (OperationParam::isOptionalParamValid(jsonMatchState))
     {
-        message->SetObjectField(OperationParam::AsyncMatchServiceMatchState.getValue(), JsonUtil::jsonStringToValue(jsonMatchState));
+        message->SetObjectField(OperationParam::AsyncMatchServiceMatchState.getKey(), JsonUtil::jsonStringToValue(jsonMatchState));
     }
 
     if (OperationParam::isOptionalParamValid(nextPlayer))
     {
         TSharedRef<FJsonObject> currentPlayer = MakeShareable(new FJsonObject());
-        currentPlayer->SetStringField(OperationParam::AsyncMatchServiceCurrentPlayer.getValue(), nextPlayer);
+        currentPlayer->SetStringField(OperationParam::AsyncMatchServiceCurrentPlayer.getKey(), nextPlayer);
 
-        message->SetObjectField(OperationParam::AsyncMatchServiceMatchStatus.getValue(), currentPlayer);
+        message->SetObjectField(OperationParam::AsyncMatchServiceMatchStatus.getKey(), currentPlayer);
     }
     if (OperationParam::isOptionalParamValid(jsonSummary))
     {
-        message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getValue(), JsonUtil::jsonStringToValue(jsonSummary));
+        message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getKey(), JsonUtil::jsonStringToValue(jsonSummary));
     }
     if (OperationParam::isOptionalParamValid(pushNotificationMessage))
     {
-        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getValue(), pushNotificationMessage);
+        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getKey(), pushNotificationMessage);
     }
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::Create, message, callback);
@@ -64,31 +64,31 @@ void BrainCloudAsyncMatch::submitTurn(
     IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
-    message->SetNumberField(OperationParam::AsyncMatchServiceVersion.getValue(), version);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
+    message->SetNumberField(OperationParam::AsyncMatchServiceVersion.getKey(), version);
     if (OperationParam::isOptionalParamValid(jsonMatchState))
     {
-        message->SetObjectField(OperationParam::AsyncMatchServiceMatchState.getValue(), JsonUtil::jsonStringToValue(jsonMatchState));
+        message->SetObjectField(OperationParam::AsyncMatchServiceMatchState.getKey(), JsonUtil::jsonStringToValue(jsonMatchState));
     }
     if (OperationParam::isOptionalParamValid(nextPlayer))
     {
         TSharedRef<FJsonObject> currentPlayer = MakeShareable(new FJsonObject());
-        currentPlayer->SetStringField(OperationParam::AsyncMatchServiceCurrentPlayer.getValue(), nextPlayer);
+        currentPlayer->SetStringField(OperationParam::AsyncMatchServiceCurrentPlayer.getKey(), nextPlayer);
 
-        message->SetObjectField(OperationParam::AsyncMatchServiceMatchStatus.getValue(), currentPlayer);
+        message->SetObjectField(OperationParam::AsyncMatchServiceMatchStatus.getKey(), currentPlayer);
     }
     if (OperationParam::isOptionalParamValid(jsonSummary))
     {
-        message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getValue(), JsonUtil::jsonStringToValue(jsonSummary));
+        message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getKey(), JsonUtil::jsonStringToValue(jsonSummary));
     }
     if (OperationParam::isOptionalParamValid(jsonStatistics))
     {
-        message->SetObjectField(OperationParam::AsyncMatchServiceStatistics.getValue(), JsonUtil::jsonStringToValue(jsonStatistics));
+        message->SetObjectField(OperationParam::AsyncMatchServiceStatistics.getKey(), JsonUtil::jsonStringToValue(jsonStatistics));
     }
     if (OperationParam::isOptionalParamValid(pushNotificationMessage))
     {
-        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getValue(), pushNotificationMessage);
+        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getKey(), pushNotificationMessage);
     }
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::SubmitTurn, message, callback);
@@ -98,13 +98,13 @@ void BrainCloudAsyncMatch::submitTurn(
 void BrainCloudAsyncMatch::updateMatchSummaryData(const FString &ownerId, const FString &matchId, uint64 version, const FString &jsonSummary, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
-    message->SetNumberField(OperationParam::AsyncMatchServiceVersion.getValue(), version);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
+    message->SetNumberField(OperationParam::AsyncMatchServiceVersion.getKey(), version);
 
     if (jsonSummary.Len() != 0)
     {
-        message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getValue(), JsonUtil::jsonStringToValue(jsonSummary));
+        message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getKey(), JsonUtil::jsonStringToValue(jsonSummary));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::UpdateMatchSummary, message, callback);
@@ -114,8 +114,8 @@ void BrainCloudAsyncMatch::updateMatchSummaryData(const FString &ownerId, const
 void BrainCloudAsyncMatch::completeMatch(const FString &ownerId, const FString &matchId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::Complete, message, callback);
     _client->sendRequest(sc);
@@ -124,8 +124,8 @@ void BrainCloudAsyncMatch::completeMatch(const FString &ownerId, const FString &
 void BrainCloudAsyncMatch::readMatch(const FString &ownerId, const FString &matchId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::ReadMatch, message, callback);
     _client->sendRequest(sc);
@@ -134,8 +134,8 @@ void BrainCloudAsyncMatch::readMatch(const FString &ownerId, const FString &matc
 void BrainCloudAsyncMatch::readMatchHistory(const FString &ownerId, const FString &matchId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::ReadMatchHistory, message, callback);
     _client->sendRequest(sc);
@@ -160,8 +160,8 @@ void BrainCloudAsyncMatch::findCompleteMatches(IServerCallback *callback)
 void BrainCloudAsyncMatch::abandonMatch(const FString &ownerId, const FString &matchId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::Abandon, message, callback);
     _client->sendRequest(sc);
@@ -170,8 +170,8 @@ void BrainCloudAsyncMatch::abandonMatch(const FString &ownerId, const FString &m
 void BrainCloudAsyncMatch::deleteMatch(const FString &ownerId, const FString &matchId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::DeleteMatch, message, callback);
     _client->sendRequest(sc);
@@ -180,14 +180,14 @@ void BrainCloudAsyncMatch::deleteMatch(const FString &ownerId, const FString &ma
 void BrainCloudAsyncMatch::abandonMatchWithSummaryData(const FString &ownerId, const FString &matchId, const FString &pushContent, const FString &summary, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
 
     if (OperationParam::isOptionalParamValid(pushContent))
     {
-        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getValue(), pushContent);
+        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getKey(), pushContent);
     }
-    message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getValue(), JsonUtil::jsonStringToValue(summary));
+    message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getKey(), JsonUtil::jsonStringToValue(summary));
     
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::AbandonMatchWithSummaryData, message, callback);
     _client->sendRequest(sc);
@@ -196,13 +196,13 @@ void BrainCloudAsyncMatch::abandonMatchWithSummaryData(const FString &ownerId, c
 void BrainCloudAsyncMatch::completeMatchWithSummaryData(const FString &ownerId, const FString &matchId, const FString &pushContent, const FString &summary, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getValue(), ownerId);
-    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getValue(), matchId);
+    message->SetStringField(OperationParam::AsyncMatchServiceOwnerId.getKey(), ownerId);
+    message->SetStringField(OperationParam::AsyncMatchServiceMatchId.getKey(), matchId);
     if (OperationParam::isOptionalParamValid(pushContent))
     {
-        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getValue(), pushContent);
+        message->SetStringField(OperationParam::AsyncMatchServicePushMessage.getKey(), pushContent);
     }
-    message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getValue(), JsonUtil::jsonStringToValue(summary));
+    message->SetObjectField(OperationParam::AsyncMatchServiceMatchSummary.getKey(), JsonUtil::jsonStringToValue(summary));
 
     ServerCall *sc = new ServerCall(ServiceName::AsyncMatch, ServiceOperation::CompleteMatchWithSummaryData, message, callback);
     _client->sendRequest(sc);
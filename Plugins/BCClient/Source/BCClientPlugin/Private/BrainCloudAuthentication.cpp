@@ -124,8 +124,8 @@ void BrainCloudAuthentication::resetEmailPassword(const FString &in_email, IServ
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalId.getValue(), in_email);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalId.getKey(), in_email);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetEmailPassword, message, in_callback);
 	brainCloudClientRef->sendRequest(sc);
@@ -136,9 +136,9 @@ void BrainCloudAuthentication::resetEmailPasswordAdvanced(const FString &in_emai
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateEmailAddress.getValue(), in_emailAddress);
-	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getValue(), JsonUtil::jsonStringToValue(in_serviceParams));
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateEmailAddress.getKey(), in_emailAddress);
+	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getKey(), JsonUtil::jsonStringToValue(in_serviceParams));
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetEmailPasswordAdvanced, message, in_callback);
 	brainCloudClientRef->sendRequest(sc);
@@ -149,9 +149,9 @@ void BrainCloudAuthentication::resetEmailPasswordWithExpiry(const FString &in_em
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalId.getValue(), in_email);
-	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getValue(), in_tokenTtlInMinutes);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalId.getKey(), in_email);
+	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getKey(), in_tokenTtlInMinutes);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetEmailPasswordWithExpiry, message, in_callback);
 	brainCloudClientRef->sendRequest(sc);
@@ -163,10 +163,10 @@ void BrainCloudAuthentication::resetEmailPasswordAdvancedWithExpiry(const FStrin
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateEmailAddress.getValue(), in_emailAddress);
-	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getValue(), in_tokenTtlInMinutes);
-	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getValue(), JsonUtil::jsonStringToValue(in_serviceParams));
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateEmailAddress.getKey(), in_emailAddress);
+	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getKey(), in_tokenTtlInMinutes);
+	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getKey(), JsonUtil::jsonStringToValue(in_serviceParams));
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetEmailPasswordAdvancedWithExpiry, message, in_callback);
 	brainCloudClientRef->sendRequest(sc);
@@ -177,8 +177,8 @@ void BrainCloudAuthentication::resetUniversalIdPassword(const FString &in_univer
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getValue(), in_universalId);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getKey(), in_universalId);
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetUniversalIdPassword, message, in_callback);
 	brainCloudClientRef->sendRequest(sc);
@@ -189,9 +189,9 @@ void BrainCloudAuthentication::resetUniversalIdPasswordAdvanced(const FString &i
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getValue(), in_universalId);
-	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getValue(), JsonUtil::jsonStringToValue(in_serviceParams));
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getKey(), in_universalId);
+	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getKey(), JsonUtil::jsonStringToValue(in_serviceParams));
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetUniversalIdPasswordAdvanced, message, in_callback);
 	brainCloudClientRef->sendRequest(sc);
@@ -202,9 +202,9 @@ void BrainCloudAuthentication::resetUniversalIdPasswordWithExpiry(const FString
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getValue(), in_universalId);
-	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getValue(), in_tokenTtlInMinutes);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getKey(), in_universalId);
+	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getKey(), in_tokenTtlInMinutes);
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetUniversalIdPasswordWithExpiry, message, in_callback);
 	brainCloudClientRef->sendRequest(sc);
@@ -215,10 +215,10 @@ void BrainCloudAuthentication::resetUniversalIdPasswordAdvancedWithExpiry(const
 	BrainCloudClient *brainCloudClientRef = _client;
 
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getValue(), in_universalId);
-	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getValue(), in_tokenTtlInMinutes);
-	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getValue(), JsonUtil::jsonStringToValue(in_serviceParams));
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateUniversalId.getKey(), in_universalId);
+	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTokenTtlInMinutes.getKey(), in_tokenTtlInMinutes);
+	message->SetObjectField(OperationParam::AuthenticateServiceAuthenticateServiceParams.getKey(), JsonUtil::jsonStringToValue(in_serviceParams));
 
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::ResetUniversalIdPasswordAdvancedWithExpiry, message, in_callback);
@@ -236,22 +236,22 @@ void BrainCloudAuthentication::authenticate(
 	BrainCloudClient *brainCloudClientRef = _client;
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getValue(), authenticationToken);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
-	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getValue(), forceCreate);
-
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateProfileId.getValue(), _profileId);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAnonymousId.getValue(), _anonymousId);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), brainCloudClientRef->getAppId());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateReleasePlatform.getValue(), brainCloudClientRef->getReleasePlatform());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameVersion.getValue(), brainCloudClientRef->getAppVersion());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateBrainCloudVersion.getValue(), brainCloudClientRef->getBrainCloudClientVersion());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getKey(), authenticationToken);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
+	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getKey(), forceCreate);
+
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateProfileId.getKey(), _profileId);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAnonymousId.getKey(), _anonymousId);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), brainCloudClientRef->getAppId());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateReleasePlatform.getKey(), brainCloudClientRef->getReleasePlatform());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameVersion.getKey(), brainCloudClientRef->getAppVersion());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateBrainCloudVersion.getKey(), brainCloudClientRef->getBrainCloudClientVersion());
 	message->SetStringField(TEXT("clientLib"), TEXT("ue4"));
 
 	if (OperationParam::isOptionalParamValid(externalAuthName))
 	{
-		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalAuthName.getValue(), externalAuthName);
+		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalAuthName.getKey(), externalAuthName);
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::Authenticate, message, callback);
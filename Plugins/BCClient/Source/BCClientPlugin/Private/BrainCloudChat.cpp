@@ -12,8 +12,8 @@ BrainCloudChat::BrainCloudChat(BrainCloudClient *client) : _client(client){};
 void BrainCloudChat::channelConnect(const FString &in_channelId, int32 in_maxToReturn, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
-    message->SetNumberField(OperationParam::ChatMaxReturn.getValue(), in_maxToReturn);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
+    message->SetNumberField(OperationParam::ChatMaxReturn.getKey(), in_maxToReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::ChannelConnect, message, in_callback);
     _client->sendRequest(sc);
@@ -22,7 +22,7 @@ void BrainCloudChat::channelConnect(const FString &in_channelId, int32 in_maxToR
 void BrainCloudChat::channelDisconnect(const FString &in_channelId, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::ChannelDisconnect, message, in_callback);
     _client->sendRequest(sc);
@@ -31,9 +31,9 @@ void BrainCloudChat::channelDisconnect(const FString &in_channelId, IServerCallb
 void BrainCloudChat::deleteChatMessage(const FString &in_channelId, const FString &in_messageId, int32 in_version, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
-    message->SetStringField(OperationParam::ChatMessageId.getValue(), in_messageId);
-    message->SetNumberField(OperationParam::ChatVersion.getValue(), in_version);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
+    message->SetStringField(OperationParam::ChatMessageId.getKey(), in_messageId);
+    message->SetNumberField(OperationParam::ChatVersion.getKey(), in_version);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::DeleteChatMessage, message, in_callback);
     _client->sendRequest(sc);
@@ -42,8 +42,8 @@ void BrainCloudChat::deleteChatMessage(const FString &in_channelId, const FStrin
 void BrainCloudChat::getChannelId(const FString &in_channelType, const FString &in_channelSubId, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelType.getValue(), in_channelType);
-    message->SetStringField(OperationParam::ChatChannelSubId.getValue(), in_channelSubId);
+    message->SetStringField(OperationParam::ChatChannelType.getKey(), in_channelType);
+    message->SetStringField(OperationParam::ChatChannelSubId.getKey(), in_channelSubId);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::GetChannelId, message, in_callback);
     _client->sendRequest(sc);
@@ -52,7 +52,7 @@ void BrainCloudChat::getChannelId(const FString &in_channelType, const FString &
 void BrainCloudChat::getChannelInfo(const FString &in_channelId, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::GetChannelInfo, message, in_callback);
     _client->sendRequest(sc);
@@ -61,8 +61,8 @@ void BrainCloudChat::getChannelInfo(const FString &in_channelId, IServerCallback
 void BrainCloudChat::getChatMessage(const FString &in_channelId, const FString &in_messageId, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
-    message->SetStringField(OperationParam::ChatMessageId.getValue(), in_messageId);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
+    message->SetStringField(OperationParam::ChatMessageId.getKey(), in_messageId);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::GetChatMessage, message, in_callback);
     _client->sendRequest(sc);
@@ -71,8 +71,8 @@ void BrainCloudChat::getChatMessage(const FString &in_channelId, const FString &
 void BrainCloudChat::getRecentChatMessages(const FString &in_channelId, int32 in_maxToReturn, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
-    message->SetNumberField(OperationParam::ChatMaxReturn.getValue(), in_maxToReturn);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
+    message->SetNumberField(OperationParam::ChatMaxReturn.getKey(), in_maxToReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::GetRecentChatMessages, message, in_callback);
     _client->sendRequest(sc);
@@ -81,7 +81,7 @@ void BrainCloudChat::getRecentChatMessages(const FString &in_channelId, int32 in
 void BrainCloudChat::getSubscribedChannels(const FString &in_channelType, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelType.getValue(), in_channelType);
+    message->SetStringField(OperationParam::ChatChannelType.getKey(), in_channelType);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::GetSubscribedChannels, message, in_callback);
     _client->sendRequest(sc);
@@ -91,13 +91,13 @@ void BrainCloudChat::postChatMessage(const FString &in_channelId, const FString
 {
     // build content
     TSharedRef<FJsonObject> content = MakeShareable(new FJsonObject());
-    content->SetStringField(OperationParam::ChatText.getValue(), in_plain);
-    content->SetObjectField(OperationParam::ChatRich.getValue(), JsonUtil::jsonStringToValue(in_jsonRich));
+    content->SetStringField(OperationParam::ChatText.getKey(), in_plain);
+    content->SetObjectField(OperationParam::ChatRich.getKey(), JsonUtil::jsonStringToValue(in_jsonRich));
 
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
-    message->SetObjectField(OperationParam::ChatContent.getValue(), content);
-    message->SetBoolField(OperationParam::ChatRecordInHistory.getValue(), in_recordInHistory);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
+    message->SetObjectField(OperationParam::ChatContent.getKey(), content);
+    message->SetBoolField(OperationParam::ChatRecordInHistory.getKey(), in_recordInHistory);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::PostChatMessage, message, in_callback);
     _client->sendRequest(sc);
@@ -106,9 +106,9 @@ void BrainCloudChat::postChatMessage(const FString &in_channelId, const FString
 void BrainCloudChat::postChatMessageSimple(const FString &in_channelId, const FString &in_plain, bool in_recordInHistory, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
-    message->SetStringField(OperationParam::ChatText.getValue(), in_plain);
-    message->SetBoolField(OperationParam::ChatRecordInHistory.getValue(), in_recordInHistory);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
+    message->SetStringField(OperationParam::ChatText.getKey(), in_plain);
+    message->SetBoolField(OperationParam::ChatRecordInHistory.getKey(), in_recordInHistory);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::PostChatMessageSimple, message, in_callback);
     _client->sendRequest(sc);
@@ -119,14 +119,14 @@ void BrainCloudChat::updateChatMessage(const FString &in_channelId, const FStrin
 {
     // build content
     TSharedRef<FJsonObject> content = MakeShareable(new FJsonObject());
-    content->SetStringField(OperationParam::ChatText.getValue(), in_plain);
-    content->SetObjectField(OperationParam::ChatRich.getValue(), JsonUtil::jsonStringToValue(in_jsonRich));
+    content->SetStringField(OperationParam::ChatText.getKey(), in_plain);
+    content->SetObjectField(OperationParam::ChatRich.getKey(), JsonUtil::jsonStringToValue(in_jsonRich));
 
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ChatChannelId.getValue(), in_channelId);
-    message->SetStringField(OperationParam::ChatMessageId.getValue(), in_messageId);
-    message->SetNumberField(OperationParam::ChatVersion.getValue(), in_version);
-    message->SetObjectField(OperationParam::ChatContent.getValue(), content);
+    message->SetStringField(OperationParam::ChatChannelId.getKey(), in_channelId);
+    message->SetStringField(OperationParam::ChatMessageId.getKey(), in_messageId);
+    message->SetNumberField(OperationParam::ChatVersion.getKey(), in_version);
+    message->SetObjectField(OperationParam::ChatContent.getKey(), content);
 
     ServerCall *sc = new ServerCall(ServiceName::Chat, ServiceOperation::UpdateChatMessage, message, in_callback);
     _client->sendRequest(sc);
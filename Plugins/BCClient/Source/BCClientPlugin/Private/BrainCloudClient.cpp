@@ -18,9 +18,12 @@
 #include "IRTTCallback.h"
 #include "IRelayCallback.h"
 #include "BCPlatform.h"
+#include "BCCommsThread.h"
+#include "Runtime/Launch/Resources/Version.h"
 
 // Define all static member variables.
 FString BrainCloudClient::s_brainCloudClientVersion = TEXT("4.6.0");
+bool BrainCloudClient::SINGLE_THREADED = true;
 
 ////////////////////////////////////////////////////
 // (De)Constructors
@@ -41,6 +44,8 @@ BrainCloudClient::BrainCloudClient()
  */
 BrainCloudClient::~BrainCloudClient()
 {
+	stopCommsThread();
+
 	destroyService(_brainCloudComms);
 	destroyService(_brainCloudRTTComms);
 	destroyService(_brainCloudRelayComms);
@@ -119,6 +124,7 @@ void BrainCloudClient::initialize(
 
 	_brainCloudComms->Initialize(serverUrl, secretKey, appId);
 	determineReleasePlatform();
+	startCommsThread();
 
 	_appId = appId;
 	_appVersion = appVersion;
@@ -158,6 +164,7 @@ void BrainCloudClient::initializeWithApps(
 
 	_brainCloudComms->InitializeWithApps(serverUrl, secretMap, appId);
 	determineReleasePlatform();
+	startCommsThread();
 
 	_appId = appId;
 	_appVersion = appVersion;
@@ -314,6 +321,35 @@ void BrainCloudClient::heartbeat()
 	_brainCloudComms->Heartbeat();
 }
 
+void BrainCloudClient::startCommsThread()
+{
+	if (SINGLE_THREADED || _isCommsThreaded)
+		return;
+
+#if ENGINE_MINOR_VERSION > 25
+	_brainCloudComms->SetThreaded(true);
+	_brainCloudRTTComms->SetThreaded(true);
+	_brainCloudRelayComms->SetThreaded(true);
+	_isCommsThreaded = true;
+	BCCommsThread::AddClient(this);
+#else
+	UE_LOG(LogBrainCloud, Warning, TEXT("Threaded comms require thread safe http requests, staying on the game thread"));
+#endif
+}
+
+void BrainCloudClient::stopCommsThread()
+{
+	if (!_isCommsThreaded)
+		return;
+
+	BCCommsThread::RemoveClient(this);
+	_isCommsThreaded = false;
+
+	_brainCloudComms->SetThreaded(false);
+	_brainCloudRTTComms->SetThreaded(false);
+	_brainCloudRelayComms->SetThreaded(false);
+}
+
 void BrainCloudClient::sendRequest(ServerCall *serviceMessage)
 {
 	_brainCloudComms->AddToQueue(serviceMessage);
@@ -379,6 +415,21 @@ void BrainCloudClient::setUploadLowTransferRateThreshold(int32 bytesPerSec)
 	_brainCloudComms->SetUploadLowTransferRateThreshold(bytesPerSec);
 }
 
+void BrainCloudClient::setMaxConcurrentUploads(int32 maxUploads)
+{
+	_brainCloudComms->SetMaxConcurrentUploads(maxUploads);
+}
+
+void BrainCloudClient::setUploadMaxBytesPerSecond(int32 bytesPerSec)
+{
+	_brainCloudComms->SetUploadMaxBytesPerSecond(bytesPerSec);
+}
+
+void BrainCloudClient::setUploadMaxRetries(int32 maxRetries)
+{
+	_brainCloudComms->SetUploadMaxRetries(maxRetries);
+}
+
 void BrainCloudClient::setOldStyleStatusMessageErrorCallback(bool enabled)
 {
 	_brainCloudComms->SetOldStyleStatusMessageErrorCallback(enabled);
@@ -389,6 +440,41 @@ void BrainCloudClient::setErrorCallbackOn202Status(bool isError)
 	_brainCloudComms->SetErrorCallbackOn202Status(isError);
 }
 
+void BrainCloudClient::setMaxPacketsInFlight(int32 maxPacketsInFlight)
+{
+	_brainCloudComms->SetMaxPacketsInFlight(maxPacketsInFlight);
+}
+
+int32 BrainCloudClient::getMaxPacketsInFlight()
+{
+	return _brainCloudComms->GetMaxPacketsInFlight();
+}
+
+void BrainCloudClient::enableAdaptiveTimeouts(bool enabled)
+{
+	_brainCloudComms->EnableAdaptiveTimeouts(enabled);
+}
+
+void BrainCloudClient::setBundleWindow(float seconds, int32 frames)
+{
+	_brainCloudComms->SetBundleWindow(seconds, frames);
+}
+
+void BrainCloudClient::setMaxBundleBytes(int32 maxBundleBytes)
+{
+	_brainCloudComms->SetMaxBundleBytes(maxBundleBytes);
+}
+
+void BrainCloudClient::setServicePriority(ServiceName serviceName, eBCCallPriority priority)
+{
+	_brainCloudComms->SetServicePriority(serviceName, priority);
+}
+
+void BrainCloudClient::setBackgroundMaxAge(float seconds)
+{
+	_brainCloudComms->SetBackgroundMaxAge(seconds);
+}
+
 void BrainCloudClient::enableNetworkErrorMessageCaching(bool enabled)
 {
 	_brainCloudComms->EnableNetworkErrorMessageCaching(enabled);
@@ -404,6 +490,96 @@ void BrainCloudClient::flushCachedMessages(bool sendApiErrorCallbacks)
 	_brainCloudComms->FlushCachedMessages(sendApiErrorCallbacks);
 }
 
+void BrainCloudClient::enableOfflineJournal(bool enabled)
+{
+	_brainCloudComms->EnableOfflineJournal(enabled);
+}
+
+void BrainCloudClient::addDurableOperation(ServiceName serviceName, ServiceOperation serviceOperation)
+{
+	_brainCloudComms->AddDurableOperation(serviceName, serviceOperation);
+}
+
+void BrainCloudClient::setOfflineJournalMaxSize(int32 maxBytes)
+{
+	_brainCloudComms->SetOfflineJournalMaxSize(maxBytes);
+}
+
+void BrainCloudClient::enableMetrics(bool enabled)
+{
+	_brainCloudComms->EnableMetrics(enabled);
+}
+
+TArray<BCOperationMetrics> BrainCloudClient::getOperationMetrics()
+{
+	return _brainCloudComms->GetMetrics().GetOperationMetrics();
+}
+
+BCBundleMetrics BrainCloudClient::getBundleMetrics()
+{
+	return _brainCloudComms->GetMetrics().GetBundleMetrics();
+}
+
+FString BrainCloudClient::getMetricsJson()
+{
+	return _brainCloudComms->GetMetrics().ToJsonString();
+}
+
+void BrainCloudClient::resetMetrics()
+{
+	_brainCloudComms->GetMetrics().Reset();
+}
+
+bool BrainCloudClient::startPacketCapture(const FString &path)
+{
+	return _brainCloudComms->StartPacketCapture(path);
+}
+
+void BrainCloudClient::stopPacketCapture()
+{
+	_brainCloudComms->StopPacketCapture();
+}
+
+bool BrainCloudClient::startPacketReplay(const FString &path, float speed)
+{
+	return _brainCloudComms->StartPacketReplay(path, speed);
+}
+
+void BrainCloudClient::stopPacketReplay()
+{
+	_brainCloudComms->StopPacketReplay();
+}
+
+void BrainCloudClient::beginWarmUpCalls(bool cacheResponses)
+{
+	_brainCloudComms->BeginWarmUpCalls(cacheResponses);
+}
+
+void BrainCloudClient::endWarmUpCalls()
+{
+	_brainCloudComms->EndWarmUpCalls();
+}
+
+void BrainCloudClient::clearWarmUpCalls()
+{
+	_brainCloudComms->ClearWarmUpCalls();
+}
+
+void BrainCloudClient::registerWarmUpCallback(IServerCallback *callback)
+{
+	_brainCloudComms->RegisterWarmUpCallback(callback);
+}
+
+void BrainCloudClient::deregisterWarmUpCallback()
+{
+	_brainCloudComms->DeregisterWarmUpCallback();
+}
+
+FString BrainCloudClient::getWarmUpResponse(ServiceName serviceName, ServiceOperation serviceOperation)
+{
+	return _brainCloudComms->GetWarmUpResponse(serviceName, serviceOperation);
+}
+
 void BrainCloudClient::insertEndOfMessageBundleMarker()
 {
 	_brainCloudComms->InsertEndOfMessageBundleMarker();
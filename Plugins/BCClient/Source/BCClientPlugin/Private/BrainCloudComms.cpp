@@ -15,6 +15,10 @@
 #include "BrainCloudWrapper.h"
 #include "BrainCloudClient.h"
 #include "BCFileUploader.h"
+#include "JsonUtil.h"
+#include "BCJsonWriter.h"
+#include "BCOfflineJournal.h"
+#include "BCPacketCapture.h"
 
 #include "BCBlueprintRestCallProxyBase.h"
 
@@ -25,6 +29,11 @@ BrainCloudComms::BrainCloudComms(BrainCloudClient *client) : _client(client)
 {
 	SetPacketTimeoutsToDefault();
 	FHttpModule::Get().SetHttpTimeout(30);
+	_retryRandom.GenerateNewSeed();
+
+	_servicePriorities.Add(ServicePriority{ServiceName::AuthenticateV2, eBCCallPriority::CRITICAL});
+	_servicePriorities.Add(ServicePriority{ServiceName::HeartBeat, eBCCallPriority::CRITICAL});
+	_servicePriorities.Add(ServicePriority{ServiceName::DataStream, eBCCallPriority::BACKGROUND});
 }
 
 BrainCloudComms::~BrainCloudComms()
@@ -34,13 +43,21 @@ BrainCloudComms::~BrainCloudComms()
 	DeregisterFileUploadCallback();
 	DeregisterGlobalErrorCallback();
 	DeregisterNetworkErrorCallback();
+
+	FScopeLock Lock(&_networkMutex);
+	delete _journal;
+	_journal = nullptr;
+
+	delete _capture;
+	_capture = nullptr;
 }
 
 void BrainCloudComms::Initialize(const FString &serverURL, const FString &secretKey, const FString &appId)
 {
+	FScopeLock Lock(&_networkMutex);
 	_isInitialized = true;
 	_serverUrl = serverURL;
-	_secretKey = secretKey;
+	SetSecretKey(secretKey);
 	_appId = appId;
 	_secretMap.Emplace(appId, secretKey);
 
@@ -56,6 +73,9 @@ void BrainCloudComms::Initialize(const FString &serverURL, const FString &secret
 	}
 
 	_uploadUrl += TEXT("/uploader");
+
+	if (_offlineJournalEnabled)
+		OpenOfflineJournal();
 }
 
 void BrainCloudComms::InitializeWithApps(const FString &serverURL, const TMap<FString, FString> &secretMap, const FString &appId)
@@ -78,37 +98,165 @@ void BrainCloudComms::InitializeWithApps(const FString &serverURL, const TMap<FS
 
 void BrainCloudComms::SetPacketTimeoutsToDefault()
 {
-    _packetTimeouts.Empty();
+	FScopeLock Lock(&_networkMutex);
+	_packetTimeouts.Empty();
 	_packetTimeouts.Add(15);
 	_packetTimeouts.Add(20);
 	_packetTimeouts.Add(35);
 	_packetTimeouts.Add(50);
 }
 
+void BrainCloudComms::SetPacketTimeouts(const TArray<int32> &packetTimeouts)
+{
+	FScopeLock Lock(&_networkMutex);
+	_packetTimeouts = packetTimeouts;
+}
+
+void BrainCloudComms::SetSessionId(const FString &sessionId)
+{
+	FScopeLock Lock(&_networkMutex);
+	_sessionId = sessionId;
+}
+
+void BrainCloudComms::ClearSessionId()
+{
+	FScopeLock Lock(&_networkMutex);
+	_sessionId.Empty();
+}
+
 void BrainCloudComms::AddToQueue(ServerCall *serverCall)
 {
 	if (!_isInitialized)
 		UE_LOG(LogBrainCloudComms, Error, TEXT("Attempted to send request but client is not initialized!"));
 
-	TSharedRef<ServerCall> sc = MakeShareable(serverCall);
+	// written out here so bundling only has to concatenate bytes
+	serverCall->serialize();
+	if (_isRecordingWarmUp && serverCall->getService() != ServiceName::HeartBeat)
+	{
+		// checked again under the lock, recording may have just been ended. Only the
+		// thread recording is, calls from the network thread, RTT or other app threads go out
+		FScopeLock Lock(&_networkMutex);
+		if (_isRecordingWarmUp && FPlatformTLS::GetCurrentThreadId() == _warmUpThreadId)
+		{
+			_warmUpCalls.Add(WarmUpCall{serverCall->getService(), serverCall->getOperation(), serverCall->getPayload()});
+			delete serverCall;
+			return;
+		}
+	}
+
+	// checked first so calls only wait on the network thread when there is a journal
+	if (_offlineJournalEnabled && serverCall->getJournalId() == 0)
+	{
+		FScopeLock Lock(&_networkMutex);
+		if (_journal != nullptr && IsDurable(*serverCall))
+			JournalServerCall(*serverCall);
+	}
+	serverCall->setQueuedTime(FPlatformTime::Seconds());
 
-	_queueMutex.Lock();
-	_messageQueue.AddHead(sc);
-	_queueMutex.Unlock();
+	// no lock here, calls can come from any thread; they are sorted into the
+	// lanes the next time the comms look at the queue
+	_submissions.Push(serverCall);
+}
+
+void BrainCloudComms::DrainSubmissions()
+{
+	while (ServerCall *serverCall = _submissions.Pop())
+	{
+		ServerCallRef sc = MakeShareable(serverCall);
+		AssignPriority(*serverCall);
+		serverCall->setQueueSequence(++_queueSequence);
+		if (GetQueuedCount() == 0)
+			RestartBundleWindow();
+		_messageQueues[(int32)sc->getPriority()].AddHead(sc);
+	}
 }
 
 void BrainCloudComms::InsertEndOfMessageBundleMarker()
 {
-	_queueMutex.Lock();
-	int32 queueCount = _messageQueue.Num();
-	_queueMutex.Unlock();
+	FScopeLock Lock(&_queueMutex);
+	DrainSubmissions();
+	if (GetQueuedCount() == 0)
+		return;
+
+	// everything queued so far goes out before anything queued after, whichever
+	// lane it is in, so the marker is a point in the queue order rather than a
+	// flag on one lane's newest call
+	if (_bundleMarkers.Num() == 0 || _bundleMarkers.Last() != _queueSequence)
+		_bundleMarkers.Add(_queueSequence);
+}
+
+void BrainCloudComms::SetServicePriority(ServiceName service, eBCCallPriority priority)
+{
+	FScopeLock Lock(&_queueMutex);
+	for (ServicePriority &servicePriority : _servicePriorities)
+	{
+		if (servicePriority.Service == service)
+		{
+			servicePriority.Priority = priority;
+			return;
+		}
+	}
+	_servicePriorities.Add(ServicePriority{service, priority});
+}
 
-	if (queueCount <= 0)
+void BrainCloudComms::AssignPriority(ServerCall &servercall)
+{
+	// authentication has to go out before anything else can
+	if (servercall.getOperation() == ServiceOperation::Authenticate)
+	{
+		servercall.setPriority(eBCCallPriority::CRITICAL);
 		return;
+	}
 
-	_queueMutex.Lock();
-	_messageQueue.GetHead()->GetValue()->setIsEndOfBundle(true);
-	_queueMutex.Unlock();
+	if (servercall.hasPriority())
+		return;
+
+	for (const ServicePriority &servicePriority : _servicePriorities)
+	{
+		if (servicePriority.Service == servercall.getService())
+		{
+			servercall.setPriority(servicePriority.Priority);
+			return;
+		}
+	}
+	servercall.setPriority(eBCCallPriority::INTERACTIVE);
+}
+
+int32 BrainCloudComms::GetQueuedCount()
+{
+	int32 count = 0;
+	for (int32 lane = 0; lane < NumPriorityLanes; ++lane)
+		count += _messageQueues[lane].Num();
+	return count;
+}
+
+uint64 BrainCloudComms::GetBundleMarkerLimit()
+{
+	// a marker is done with once every call queued before it has gone out,
+	// the oldest call of each lane is at its tail
+	while (_bundleMarkers.Num() > 0)
+	{
+		bool isPending = false;
+		for (int32 lane = 0; lane < NumPriorityLanes && !isPending; ++lane)
+		{
+			auto tail = _messageQueues[lane].GetTail();
+			isPending = tail != nullptr && tail->GetValue()->getQueueSequence() <= _bundleMarkers[0];
+		}
+
+		if (isPending)
+			return _bundleMarkers[0];
+		_bundleMarkers.RemoveAt(0);
+	}
+	return MAX_uint64;
+}
+
+bool BrainCloudComms::IsBackgroundOverdue()
+{
+	const TDoubleLinkedList<ServerCallRef> &background = _messageQueues[(int32)eBCCallPriority::BACKGROUND];
+	if (_backgroundMaxAge <= 0.0f || background.Num() == 0)
+		return false;
+
+	return FPlatformTime::Seconds() - background.GetTail()->GetValue()->getQueuedTime() >= _backgroundMaxAge;
 }
 
 void BrainCloudComms::RegisterEventCallback(UBCBlueprintRestCallProxyBase *callback)
@@ -183,14 +331,22 @@ void BrainCloudComms::DeregisterGlobalErrorCallback()
 	_globalErrorCallback = nullptr;
 }
 
+void BrainCloudComms::RegisterNetworkErrorCallback(INetworkErrorCallback *networkErrorCallback)
+{
+	FScopeLock Lock(&_networkMutex);
+	_networkErrorCallback = networkErrorCallback;
+}
+
 void BrainCloudComms::RegisterNetworkErrorCallback(UBCBlueprintRestCallProxyBase *callback)
 {
+	FScopeLock Lock(&_networkMutex);
 	callback->AddToRoot();
 	m_registeredRestBluePrintCallbacks.Emplace("networkError", callback);
 }
 
 void BrainCloudComms::DeregisterNetworkErrorCallback()
 {
+	FScopeLock Lock(&_networkMutex);
 	FString serviceName = TEXT("networkError");
 	if (m_registeredRestBluePrintCallbacks.Contains(serviceName))
 	{
@@ -201,100 +357,157 @@ void BrainCloudComms::DeregisterNetworkErrorCallback()
 	_networkErrorCallback = nullptr;
 }
 
+INetworkErrorCallback *BrainCloudComms::GetNetworkErrorCallback()
+{
+	FScopeLock Lock(&_networkMutex);
+	return _networkErrorCallback != nullptr ? _networkErrorCallback : m_registeredRestBluePrintCallbacks.Contains("networkError") ? m_registeredRestBluePrintCallbacks["networkError"] : nullptr;
+}
+
 BrainCloudComms::PacketRef BrainCloudComms::BuildPacket()
 {
-	PacketRef packet = MakeShareable(new TArray<TSharedRef<ServerCall>>());
+	PacketRef packet = MakeShareable(new TArray<ServerCallRef>());
 
 	_queueMutex.Lock();
+	DrainSubmissions();
 
-	auto nextNode = _messageQueue.GetTail();
+	// calls queued after the oldest end of bundle marker wait for the next bundle
+	uint64 markerLimit = GetBundleMarkerLimit();
+
+	// authentication is always critical, so only that lane needs looking at
+	TDoubleLinkedList<ServerCallRef> &critical = _messageQueues[(int32)eBCCallPriority::CRITICAL];
+	auto nextNode = critical.GetTail();
 	while (nextNode != nullptr)
 	{
-		TSharedRef<ServerCall> message = nextNode->GetValue();
+		ServerCallRef message = nextNode->GetValue();
 
-		if (message->getOperation() == ServiceOperation::Authenticate)
+		if (message->getQueueSequence() > markerLimit)
 		{
-			message->setIsEndOfBundle(true);
-			_messageQueue.RemoveNode(nextNode);
-			_messageQueue.AddTail(message);
 			break;
 		}
 
-		if (message->getIsEndOfBundle() == true)
+		if (message->getOperation() == ServiceOperation::Authenticate)
 		{
+			message->setIsEndOfBundle(true);
+			critical.RemoveNode(nextNode);
+			critical.AddTail(message);
 			break;
 		}
 
 		nextNode = nextNode->GetPrevNode();
 	}
 
-	while (_messageQueue.Num() != 0 && packet->Num() < _maxBundleMessages)
+	// fill from the highest lane down, background calls which have waited
+	// too long jump ahead of the interactive ones so they can't be starved
+	eBCCallPriority laneOrder[NumPriorityLanes] = {eBCCallPriority::CRITICAL, eBCCallPriority::INTERACTIVE, eBCCallPriority::BACKGROUND};
+	if (IsBackgroundOverdue())
+	{
+		laneOrder[1] = eBCCallPriority::BACKGROUND;
+		laneOrder[2] = eBCCallPriority::INTERACTIVE;
+	}
+
+	int32 packetBytes = 0;
+	bool isClosed = false;
+	for (int32 i = 0; i < NumPriorityLanes && !isClosed; ++i)
 	{
-		auto tailNode = _messageQueue.GetTail();
-		TSharedRef<ServerCall> message = tailNode->GetValue();
-		_messageQueue.RemoveNode(tailNode);
-		packet->Add(message);
-		if (message->getIsEndOfBundle() == true)
+		TDoubleLinkedList<ServerCallRef> &lane = _messageQueues[(int32)laneOrder[i]];
+		while (lane.Num() != 0 && packet->Num() < _maxBundleMessages)
 		{
-			break;
+			auto tailNode = lane.GetTail();
+			ServerCallRef message = tailNode->GetValue();
+
+			// the rest of this lane was queued after the marker
+			if (message->getQueueSequence() > markerLimit)
+				break;
+
+			// always take at least one message, however large
+			int32 messageBytes = message->getPayload().Num();
+			if (_maxBundleBytes > 0 && packet->Num() > 0 && packetBytes + messageBytes > _maxBundleBytes)
+			{
+				isClosed = true;
+				break;
+			}
+			packetBytes += messageBytes;
+
+			lane.RemoveNode(tailNode);
+			packet->Add(message);
+			if (message->getIsEndOfBundle() == true)
+			{
+				isClosed = true;
+				break;
+			}
 		}
+
+		if (packet->Num() >= _maxBundleMessages)
+			isClosed = true;
 	}
+
+	// whatever is left over starts a new window
+	if (GetQueuedCount() != 0)
+		RestartBundleWindow();
 	_queueMutex.Unlock();
 
+	// an authentication bundle is closed right after it, except for the warm up calls
+	if (packet->Num() == 1 && (*packet)[0]->getOperation() == ServiceOperation::Authenticate)
+		AppendWarmUpCalls(packet);
+
 	return packet;
 }
 
-BrainCloudComms::PacketRef BrainCloudComms::BuildPacket(TSharedRef<ServerCall> sc)
+BrainCloudComms::PacketRef BrainCloudComms::BuildPacket(ServerCallRef sc)
 {
-	PacketRef packet = MakeShareable(new TArray<TSharedRef<ServerCall>>());
+	PacketRef packet = MakeShareable(new TArray<ServerCallRef>());
 	packet->Add(sc);
 	return packet;
 }
 
-#if ENGINE_MINOR_VERSION > 25
-TSharedRef<IHttpRequest,ESPMode::ThreadSafe> BrainCloudComms::SendPacket(PacketRef packet)
-#else
-TSharedRef<IHttpRequest> BrainCloudComms::SendPacket(PacketRef packet)
-#endif
+void BrainCloudComms::SendPacket(PacketRef packet)
 {
+	if (_isReplaying)
+	{
+		ReplayPacket(packet);
+		return;
+	}
+
 	#if ENGINE_MINOR_VERSION > 25
 	TSharedRef<IHttpRequest,ESPMode::ThreadSafe> httpRequest = FHttpModule::Get().CreateRequest();
 	#else
 	TSharedRef<IHttpRequest> httpRequest = FHttpModule::Get().CreateRequest();
 	#endif
 
-
+	InFlightPacketRef inFlight = MakeShareable(new InFlightPacket(packet, _packetId));
 	FString packetIdStr = FString::FormatAsNumber(_packetId);
-	_currentPacket = packet;
 
 	httpRequest->SetURL(_serverUrl);
 	httpRequest->SetVerb(TEXT("POST"));
 	httpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	httpRequest->SetHeader(TEXT("X-Braincloud-PacketId"), packetIdStr);
 
-	FString dataString = GetDataString(packet, _packetId++);
+	WriteRequestBody(packet, _packetId++, _requestBody);
 	if (_isLoggingEnabled)
-		UE_LOG(LogBrainCloudComms, Log, TEXT("Sending request:%s\n"), *dataString);
+		UE_LOG(LogBrainCloudComms, Log, TEXT("Sending request:%s\n"), *BodyToString(_requestBody));
 
-	httpRequest->SetContentAsString(dataString);
+	httpRequest->SetContent(_requestBody);
 
 	if (_secretKey.Len() > 0)
 	{
-		FString secret = dataString + _secretKey;
-		FString secretHeader = FMD5::HashAnsiString(*secret);
-		httpRequest->SetHeader(TEXT("X-SIG"), secretHeader);
+		httpRequest->SetHeader(TEXT("X-SIG"), GetSignature(_requestBody, _secretKeyUtf8));
 	}
 
 	httpRequest->SetHeader(TEXT("X-APPID"), _appId);
 
 	httpRequest->ProcessRequest();
 	_requestSentTime = FPlatformTime::Seconds();
-	return httpRequest;
+
+	inFlight->Request = httpRequest;
+	inFlight->SentTime = _requestSentTime;
+	_inFlightPackets.Add(inFlight);
+
+	RecordPacketSent(packet);
 }
 
-void BrainCloudComms::ResendActivePacket()
+void BrainCloudComms::ResendPacket(InFlightPacketRef inFlight)
 {
-	if (!_activeRequest.IsValid())
+	if (!inFlight->Request.IsValid())
 		return;
 	#if ENGINE_MINOR_VERSION > 25
 	TSharedRef<IHttpRequest,ESPMode::ThreadSafe> httpRequest = FHttpModule::Get().CreateRequest();
@@ -305,77 +518,216 @@ void BrainCloudComms::ResendActivePacket()
 	httpRequest->SetURL(_serverUrl);
 	httpRequest->SetVerb(TEXT("POST"));
 	httpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	httpRequest->SetHeader(TEXT("X-Braincloud-PacketId"), _activeRequest->GetHeader(TEXT("X-Braincloud-PacketId")));
+	httpRequest->SetHeader(TEXT("X-Braincloud-PacketId"), inFlight->Request->GetHeader(TEXT("X-Braincloud-PacketId")));
 
-	httpRequest->SetContent(_activeRequest->GetContent());
-	httpRequest->SetHeader(TEXT("X-SIG"), _activeRequest->GetHeader(TEXT("X-SIG")));
-	httpRequest->SetHeader(TEXT("X-APPID"), _activeRequest->GetHeader(TEXT("X-APPID")));
+	httpRequest->SetContent(inFlight->Request->GetContent());
+	httpRequest->SetHeader(TEXT("X-SIG"), inFlight->Request->GetHeader(TEXT("X-SIG")));
+	httpRequest->SetHeader(TEXT("X-APPID"), inFlight->Request->GetHeader(TEXT("X-APPID")));
 
 	httpRequest->ProcessRequest();
-	_activeRequest = httpRequest;
-	_requestSentTime = FPlatformTime::Seconds();
+	inFlight->Request = httpRequest;
+	inFlight->SentTime = FPlatformTime::Seconds();
+	_requestSentTime = inFlight->SentTime;
+
+	RecordPacketRetry(inFlight->Packet);
 }
 
-FString BrainCloudComms::GetDataString(PacketRef packet, uint64 packetId)
+void BrainCloudComms::WriteRequestBody(PacketRef packet, uint64 packetId, TArray<uint8> &body)
 {
-	FString jsonStr;
-
-	TSharedRef<TJsonWriter<>> writer = TJsonWriterFactory<>::Create(&jsonStr);
+	body.Reset();
 
-	TArray<TSharedPtr<FJsonValue>> messages;
+	BCJsonWriter writer(body);
+	writer.BeginObject();
 
+	writer.WriteKey(TEXT("messages"));
+	writer.BeginArray();
 	for (int32 i = 0; i < packet->Num(); i++)
 	{
-		TSharedRef<ServerCall> sc = (packet.Get()[i]);
-		TSharedRef<FJsonValue> message = MakeShareable(new FJsonValueObject(sc->getPayload()));
-		messages.Add(message);
+		const TArray<uint8> &payload = (packet.Get()[i])->getPayload();
+		writer.WriteRawValue(payload.GetData(), payload.Num());
 	}
+	writer.EndArray();
 
-	TSharedRef<FJsonObject> jsonDataObject = MakeShareable(new FJsonObject());
-	jsonDataObject->SetArrayField("messages", messages);
-	jsonDataObject->SetStringField("sessionId", _sessionId);
-	jsonDataObject->SetStringField("gameId", _appId);
-	jsonDataObject->SetNumberField("packetId", packetId);
+	writer.WriteKey(TEXT("sessionId"));
+	writer.WriteString(_sessionId);
+	writer.WriteKey(TEXT("gameId"));
+	writer.WriteString(_appId);
+	writer.WriteKey(TEXT("packetId"));
+	writer.WriteNumber((double)packetId);
 
-	FJsonSerializer::Serialize(jsonDataObject, writer);
-	return jsonStr;
+	writer.EndObject();
 }
 
-void BrainCloudComms::CreateAndSendNextRequestBundle()
+FString BrainCloudComms::GetSignature(const TArray<uint8> &body, const TArray<uint8> &secret)
 {
-	_queueMutex.Lock();
-	int32 queueCount = _messageQueue.Num();
-	_queueMutex.Unlock();
+	// md5 of the body followed by the secret, fed in place rather than concatenated
+	uint8 digest[16];
+	FMD5 md5;
+	md5.Update(body.GetData(), body.Num());
+	md5.Update(secret.GetData(), secret.Num());
+	md5.Final(digest);
+
+	static const TCHAR HexDigits[] = TEXT("0123456789abcdef");
+	TCHAR hex[33];
+	for (int32 i = 0; i < 16; i++)
+	{
+		hex[i * 2] = HexDigits[digest[i] >> 4];
+		hex[i * 2 + 1] = HexDigits[digest[i] & 0x0f];
+	}
+	hex[32] = 0;
+	return FString(32, hex);
+}
 
-	if (queueCount <= 0)
-		return;
+void BrainCloudComms::SetSecretKey(const FString &secretKey)
+{
+	_secretKey = secretKey;
+
+	FTCHARToUTF8 secret(*_secretKey);
+	_secretKeyUtf8.Reset();
+	_secretKeyUtf8.Append(reinterpret_cast<const uint8 *>(secret.Get()), secret.Length());
+}
+
+FString BrainCloudComms::BodyToString(const TArray<uint8> &body)
+{
+	FUTF8ToTCHAR converted(reinterpret_cast<const ANSICHAR *>(body.GetData()), body.Num());
+	return FString(converted.Length(), converted.Get());
+}
+
+bool BrainCloudComms::CanSendNextRequestBundle()
+{
+	int32 inFlightCount = _inFlightPackets.Num() + _replayedPackets.Num();
+	if (inFlightCount == 0)
+		return true;
+
+	// nothing else goes out until a resumed session has been accepted
+	if (_isResumedSession)
+		return false;
+
+	// pipelining only kicks in once we have a session, and authentication
+	// always travels on its own with nothing else outstanding
+	if (inFlightCount >= _maxPacketsInFlight || !_isAuthenticated || _killSwitchEngaged)
+		return false;
+
+	return !IsAuthenticationBundleNext();
+}
+
+bool BrainCloudComms::IsAuthenticationBundleNext()
+{
+	// mirrors the authentication scan done by BuildPacket
+	FScopeLock Lock(&_queueMutex);
+	DrainSubmissions();
+
+	uint64 markerLimit = GetBundleMarkerLimit();
+	auto nextNode = _messageQueues[(int32)eBCCallPriority::CRITICAL].GetTail();
+	while (nextNode != nullptr)
+	{
+		ServerCallRef message = nextNode->GetValue();
+		if (message->getQueueSequence() > markerLimit)
+			break;
+
+		if (message->getOperation() == ServiceOperation::Authenticate)
+			return true;
+
+		nextNode = nextNode->GetPrevNode();
+	}
+	return false;
+}
+
+bool BrainCloudComms::IsBundleReady()
+{
+	if (_bundleWindowSeconds <= 0.0f && _bundleWindowFrames <= 0)
+		return true;
+
+	FScopeLock Lock(&_queueMutex);
+
+	if (IsBackgroundOverdue())
+		return true;
+
+	// the bundle is already closed off by a marker
+	if (GetBundleMarkerLimit() != MAX_uint64)
+		return true;
+
+	int32 count = 0;
+	int32 bytes = 0;
+	for (int32 lane = 0; lane < NumPriorityLanes; ++lane)
+	{
+		for (auto node = _messageQueues[lane].GetTail(); node != nullptr; node = node->GetPrevNode())
+		{
+			ServerCallRef message = node->GetValue();
+
+			// authentication closes the bundle, no point in waiting for more
+			if (message->getIsEndOfBundle() || message->getOperation() == ServiceOperation::Authenticate)
+				return true;
 
+			++count;
+			bytes += message->getPayload().Num();
+			if (count >= _maxBundleMessages || (_maxBundleBytes > 0 && bytes >= _maxBundleBytes))
+				return true;
+		}
+	}
+
+	if (_bundleWindowSeconds > 0.0f && FPlatformTime::Seconds() - _bundleWindowStartTime >= _bundleWindowSeconds)
+		return true;
+
+	if (_bundleWindowFrames > 0 && GFrameCounter - _bundleWindowStartFrame >= (uint64)_bundleWindowFrames)
+		return true;
+
+	return false;
+}
+
+void BrainCloudComms::RestartBundleWindow()
+{
+	_bundleWindowStartTime = FPlatformTime::Seconds();
+	_bundleWindowStartFrame = GFrameCounter;
+}
+
+bool BrainCloudComms::CreateAndSendNextRequestBundle()
+{
 	bool isAuth = false;
 
-	if (!_isAuthenticated)
+	_queueMutex.Lock();
+	DrainSubmissions();
+	if (GetQueuedCount() <= 0)
 	{
-		_queueMutex.Lock();
-		auto itr = TDoubleLinkedList<TSharedRef<ServerCall>>::TConstIterator(_messageQueue.GetHead());
+		_queueMutex.Unlock();
+		return false;
+	}
 
-		for (; itr; ++itr)
+	if (!_isAuthenticated)
+	{
+		for (int32 lane = 0; lane < NumPriorityLanes && !isAuth; ++lane)
 		{
-			auto operation = itr->getOperation();
-			if (operation == ServiceOperation::Authenticate ||
-				operation == ServiceOperation::ResetEmailPassword ||
-				operation == ServiceOperation::ResetEmailPasswordAdvanced)
+			auto itr = TDoubleLinkedList<ServerCallRef>::TConstIterator(_messageQueues[lane].GetHead());
+
+			for (; itr; ++itr)
 			{
-				isAuth = true;
-				break;
+				auto operation = itr->getOperation();
+				if (operation == ServiceOperation::Authenticate ||
+					operation == ServiceOperation::ResetEmailPassword ||
+					operation == ServiceOperation::ResetEmailPasswordAdvanced)
+				{
+					isAuth = true;
+					break;
+				}
 			}
 		}
-		_queueMutex.Unlock();
 	}
+	_queueMutex.Unlock();
+
+	// the authentication replacing a rejected session hasn't been queued yet
+	if (!isAuth && _isReauthenticating)
+		return false;
+	_isReauthenticating = false;
 
 	if (!_killSwitchEngaged)
 	{
 		if (isAuth || _isAuthenticated)
 		{
-			_activeRequest = SendPacket(BuildPacket());
+			if (!isAuth && !IsBundleReady())
+				return false;
+
+			SendPacket(BuildPacket());
+			return true;
 		}
 		else
 		{
@@ -386,223 +738,368 @@ void BrainCloudComms::CreateAndSendNextRequestBundle()
 	{
 		FakeErrorResponse(900, ReasonCodes::CLIENT_DISABLED, "Client disabled due to repeated errors from a single API call");
 	}
-
-	_retryCount = 0;
-	_waitingForRetry = false;
+	return false;
 }
 
 void BrainCloudComms::RunCallbacks()
 {
-	if (!_isInitialized || _blockingQueue)
+	if (!_isInitialized)
 		return;
 
-	if (_activeRequest.IsValid())
-	{
-		if (_waitingForRetry) //We're waiting to retry
-		{
-			if (FPlatformTime::Seconds() - _retryWaitStart > _retryWaitTime)
-			{
-				_waitingForRetry = false;
-				ResendActivePacket();
-				_retryCount++;
-			}
-		}
-		else
-		{
-			EHttpRequestStatus::Type status = _activeRequest->GetStatus();
-			double elapsedTime = FPlatformTime::Seconds() - _requestSentTime;
-			bool isError = false;
+	// when threaded the network thread does this part
+	if (!_isThreaded)
+		UpdateNetwork();
 
-			//request was successful
-			if (status == EHttpRequestStatus::Succeeded)
-			{
-				FHttpResponsePtr resp = _activeRequest->GetResponse();
-				if (resp.IsValid())
-				{
-					if (resp->GetResponseCode() == HttpCode::OK)
-						HandleResponse(_activeRequest->GetResponse()->GetResponseCode(),
-									   _activeRequest->GetResponse()->GetContentAsString());
-					else
-						isError = true;
-				}
-			}
-			else if (_activeRequest->GetStatus() == EHttpRequestStatus::Processing && elapsedTime > GetRetryTimeoutSeconds(_retryCount)) //request timeout
-			{
-				if (_isLoggingEnabled)
-					UE_LOG(LogBrainCloudComms, Warning, TEXT("Request timed out"));
-				isError = true;
-			}
-			else if (!_waitingForRetry && status == EHttpRequestStatus::Failed)
-			{
-				if (_isLoggingEnabled)
-					UE_LOG(LogBrainCloudComms, Warning, TEXT("Request failed"));
-				isError = true;
-			}
+	DispatchResults();
 
-			if (isError) //request failed
-			{
-				_activeRequest->CancelRequest();
-				if (_retryCount < GetMaxRetryAttempts())
-				{
-					if (_isLoggingEnabled)
-						UE_LOG(LogBrainCloudComms, Warning, TEXT("Retrying...#%d of %d"), _retryCount + 1, GetMaxRetryAttempts() + 1);
-					_retryWaitStart = FPlatformTime::Seconds();
-					_retryWaitTime = GetRetryTimeoutSeconds(_retryCount) - elapsedTime;
+	if (!_blockingQueue)
+		UpdateUploads();
+}
 
-					_waitingForRetry = true;
-				}
-				else
-				{
-					if (_isLoggingEnabled)
-						UE_LOG(LogBrainCloudComms, Warning, TEXT("Reached max retry limit #%d of %d"), _retryCount + 1, GetMaxRetryAttempts() + 1);
-					// if we're doing caching of messages on timeout, kick it in now!
-					INetworkErrorCallback *networkErrorCallback = _networkErrorCallback != nullptr ? _networkErrorCallback : m_registeredRestBluePrintCallbacks.Contains("networkError") ? m_registeredRestBluePrintCallbacks["networkError"] : nullptr;
-
-					if (_cacheMessagesOnNetworkError && networkErrorCallback != nullptr)
-					{
-						if (_isLoggingEnabled)
-							UE_LOG(LogBrainCloudComms, Log, TEXT("Caching messages"));
-						_blockingQueue = true;
-						networkErrorCallback->networkError();
-					}
-					else
-					{
-						FHttpResponsePtr resp = _activeRequest->GetResponse();
-						if (resp.IsValid())
-							HandleResponse(resp->GetResponseCode(), resp->GetContentAsString());
-						else
-						{
-							ReportError(
-								_currentPacket.ToSharedRef(),
-								HttpCode::CLIENT_NETWORK_ERROR,
-								ReasonCodes::CLIENT_NETWORK_ERROR_TIMEOUT,
-								"Timeout trying to reach brainCloud server");
-						}
-					}
-				}
-			}
-		}
-	}
-	else
+void BrainCloudComms::UpdateNetwork()
+{
+	FScopeLock Lock(&_networkMutex);
+	if (!_isInitialized || _blockingQueue)
+		return;
+
+	UpdateInFlightPackets();
+	ProcessCompletedPackets();
+	ProcessReplayedPackets();
+
+	// keep sending bundles while the in flight window has room, a faked
+	// error response stops the loop so the queue drains one bundle per tick
+	while (!_blockingQueue && CanSendNextRequestBundle())
 	{
-		CreateAndSendNextRequestBundle();
+		if (!CreateAndSendNextRequestBundle())
+			break;
 	}
 
-	UpdateUploads();
 	Heartbeat();
+
+	if (_journal != nullptr)
+		_journal->Tick();
 }
 
-void BrainCloudComms::HandleResponse(int32 statusCode, FString responseBody)
+void BrainCloudComms::DispatchResults()
 {
-	if (statusCode == HttpCode::OK)
+	PacketResultPtr result;
+	while (_results.Dequeue(result))
 	{
-		if (_isLoggingEnabled)
-			UE_LOG(LogBrainCloudComms, Log, TEXT("Got response: %s\n"), *responseBody);
+		if (result->IsNetworkError)
+		{
+			INetworkErrorCallback *networkErrorCallback = GetNetworkErrorCallback();
+			if (networkErrorCallback != nullptr)
+				networkErrorCallback->networkError();
+			continue;
+		}
 
-		TSharedRef<TJsonReader<TCHAR>> reader = TJsonReaderFactory<TCHAR>::Create(responseBody);
-		TSharedPtr<FJsonObject> jsonPacket = MakeShareable(new FJsonObject());
+		if (result->IsSessionRejected)
+		{
+			_client->getAuthenticationService()->authenticateAnonymous(false, _resumeCallback);
+			RequeueRejectedCalls();
+			continue;
+		}
 
-		bool res = FJsonSerializer::Deserialize(reader, jsonPacket);
-		if (res)
+		if (result->ResumedCallback != nullptr)
 		{
-			ReportResults(_currentPacket.ToSharedRef(), jsonPacket.ToSharedRef());
-			IEventCallback *eventCallback = _eventCallback != nullptr ? _eventCallback : m_registeredRestBluePrintCallbacks.Contains(ServiceName::Event.getValue()) ? m_registeredRestBluePrintCallbacks[ServiceName::Event.getValue()] : nullptr;
+			result->ResumedCallback->serverCallback(ServiceName::AuthenticateV2, ServiceOperation::Authenticate, result->ResponseBody);
+			continue;
+		}
 
-			if (eventCallback && jsonPacket->HasField("events"))
-			{
-				TArray<TSharedPtr<FJsonValue>> events = jsonPacket->GetArrayField("events");
-				if (events.Num() > 0)
-				{
-					TSharedRef<FJsonObject> eventsRoot = MakeShareable(new FJsonObject);
-					eventsRoot->SetArrayField("events", events);
-					eventCallback->eventCallback(UBrainCloudWrapper::GetJsonString(eventsRoot));
-				}
-			}
+		PacketRef requestPacket = result->Packet.ToSharedRef();
+
+		// the app is told how these calls went, success or error, so they are done with
+		if (_offlineJournalEnabled)
+		{
+			FScopeLock Lock(&_networkMutex);
+			AcknowledgeJournal(requestPacket);
 		}
-		else //couldnt deserialize the response body
+
+		if (result->IsError)
 		{
-			ReportError(_currentPacket.ToSharedRef(), HttpCode::CLIENT_NETWORK_ERROR, ReasonCodes::JSON_PARSING_ERROR, TEXT("Unable to parse response"));
+			ReportError(requestPacket, result->StatusCode, result->ReasonCode, result->StatusMessage);
+			RecordPacketCallbacks(*result);
+			continue;
+		}
+
+		ReportResults(requestPacket, *result);
+		RecordPacketCallbacks(*result);
+		IEventCallback *eventCallback = _eventCallback != nullptr ? _eventCallback : m_registeredRestBluePrintCallbacks.Contains(ServiceName::Event.getValue()) ? m_registeredRestBluePrintCallbacks[ServiceName::Event.getValue()] : nullptr;
+
+		if (eventCallback && result->EventsStart != INDEX_NONE)
+		{
+			const TCHAR *json = *result->ResponseBody;
+			int32 firstEvent = JsonUtil::skipJsonWhitespace(json, result->EventsEnd, result->EventsStart + 1);
+			if (json[result->EventsStart] == '[' && json[firstEvent] != ']')
+			{
+				FString eventsRoot = TEXT("{\"events\":");
+				eventsRoot.AppendChars(json + result->EventsStart, result->EventsEnd - result->EventsStart);
+				eventsRoot.AppendChar('}');
+				eventCallback->eventCallback(eventsRoot);
+			}
 		}
-	}
-	else
-	{
-		ReportError(_currentPacket.ToSharedRef(), statusCode, 0, responseBody);
 	}
 }
 
-void BrainCloudComms::RetryCachedMessages()
+void BrainCloudComms::QueueError(PacketRef requestPacket, uint32 statusCode, uint32 reasonCode, const FString &statusMessage)
 {
-	if (_blockingQueue)
-	{
-		if (_isLoggingEnabled)
-			UE_LOG(LogBrainCloudComms, Log, TEXT("Retrying cached messages"));
-		_blockingQueue = false;
-		_retryCount = 0;
-		_waitingForRetry = false;
-		ResendActivePacket();
-	}
+	PacketResultPtr result = MakeShareable(new PacketResult());
+	result->Packet = requestPacket;
+	result->StatusCode = statusCode;
+	result->ReasonCode = reasonCode;
+	result->StatusMessage = statusMessage;
+	result->IsError = true;
+	result->ReceivedTime = FPlatformTime::Seconds();
+	_results.Enqueue(result);
 }
 
-void BrainCloudComms::FlushCachedMessages(bool sendApiErrorCallbacks)
+void BrainCloudComms::UpdateInFlightPackets()
 {
-	if (_isLoggingEnabled)
-		UE_LOG(LogBrainCloudComms, Log, TEXT("Flushing cached messages"));
-
-	if (sendApiErrorCallbacks)
+	for (int32 i = 0; i < _inFlightPackets.Num(); ++i)
 	{
-		ReportError(
-			_currentPacket.ToSharedRef(),
-			HttpCode::CLIENT_NETWORK_ERROR,
-			ReasonCodes::CLIENT_NETWORK_ERROR_TIMEOUT,
-			"Timeout trying to reach brainCloud server");
-	}
+		InFlightPacketRef inFlight = _inFlightPackets[i];
+		if (inFlight->HasFailed)
+			continue;
 
-	_blockingQueue = false;
-	_retryCount = 0;
-	_waitingForRetry = false;
+		if (inFlight->WaitingForRetry) //We're waiting to retry
+		{
+			if (FPlatformTime::Seconds() - inFlight->RetryWaitStart > inFlight->RetryWaitTime)
+			{
+				inFlight->WaitingForRetry = false;
+				ResendPacket(inFlight);
+				inFlight->RetryCount++;
+			}
+			continue;
+		}
 
-	_activeRequest = nullptr;
-	_currentPacket = nullptr;
+		EHttpRequestStatus::Type status = inFlight->Request->GetStatus();
+		double elapsedTime = FPlatformTime::Seconds() - inFlight->SentTime;
+		bool isError = false;
 
-	_queueMutex.Lock();
-	_messageQueue.Empty();
-	_queueMutex.Unlock();
-}
+		//request was successful, results are reported in packet order by ProcessCompletedPackets
+		if (status == EHttpRequestStatus::Succeeded)
+		{
+			FHttpResponsePtr resp = inFlight->Request->GetResponse();
+			if (resp.IsValid() && resp->GetResponseCode() != HttpCode::OK)
+				isError = true;
 
-void BrainCloudComms::UpdateUploads()
+			// only first attempts are sampled, a retried packet can't tell which send was answered
+			if (!isError && !inFlight->RttSampled && inFlight->RetryCount == 0)
+			{
+				inFlight->RttSampled = true;
+				AddRttSample(inFlight->Request->GetElapsedTime());
+			}
+		}
+		else if (status == EHttpRequestStatus::Processing && elapsedTime > GetRetryTimeoutSeconds(inFlight->Packet, inFlight->RetryCount)) //request timeout
+		{
+			if (_isLoggingEnabled)
+				UE_LOG(LogBrainCloudComms, Warning, TEXT("Request timed out"));
+			isError = true;
+		}
+		else if (status == EHttpRequestStatus::Failed)
+		{
+			if (_isLoggingEnabled)
+				UE_LOG(LogBrainCloudComms, Warning, TEXT("Request failed"));
+			isError = true;
+		}
+
+		if (isError) //request failed
+		{
+			inFlight->Request->CancelRequest();
+			if (inFlight->RetryCount < GetMaxRetryAttempts(inFlight->Packet))
+			{
+				if (_isLoggingEnabled)
+					UE_LOG(LogBrainCloudComms, Warning, TEXT("Retrying...#%d of %d"), inFlight->RetryCount + 1, GetMaxRetryAttempts(inFlight->Packet) + 1);
+				inFlight->RetryWaitStart = FPlatformTime::Seconds();
+				inFlight->RetryWaitTime = GetRetryWaitSeconds(inFlight, elapsedTime);
+
+				inFlight->WaitingForRetry = true;
+			}
+			else
+			{
+				if (_isLoggingEnabled)
+					UE_LOG(LogBrainCloudComms, Warning, TEXT("Reached max retry limit #%d of %d"), inFlight->RetryCount + 1, GetMaxRetryAttempts(inFlight->Packet) + 1);
+				inFlight->HasFailed = true;
+			}
+		}
+	}
+}
+
+void BrainCloudComms::ProcessCompletedPackets()
 {
-	if (_fileUploads.Num() <= 0)
-		return;
+	// responses are handed out strictly in packetId order, a packet which
+	// completes early waits for the ones sent before it
+	while (_inFlightPackets.Num() > 0 && !_blockingQueue)
+	{
+		InFlightPacketRef inFlight = _inFlightPackets[0];
 
-	int32 count = _fileUploads.Num();
+		if (inFlight->HasFailed)
+		{
+			// if we're doing caching of messages on timeout, kick it in now!
+			if (_cacheMessagesOnNetworkError && GetNetworkErrorCallback() != nullptr)
+			{
+				if (_isLoggingEnabled)
+					UE_LOG(LogBrainCloudComms, Log, TEXT("Caching messages"));
+				_blockingQueue = true;
 
-	IFileUploadCallback *fileCallback = _fileUploadCallback != nullptr ? _fileUploadCallback : m_registeredRestBluePrintCallbacks.Contains(ServiceName::File.getValue()) ? m_registeredRestBluePrintCallbacks[ServiceName::File.getValue()] : nullptr;
-	for (int32 i = count - 1; i >= 0; --i)
+				PacketResultPtr result = MakeShareable(new PacketResult());
+				result->IsNetworkError = true;
+				_results.Enqueue(result);
+				return;
+			}
+
+			_inFlightPackets.RemoveAt(0);
+			FHttpResponsePtr resp = inFlight->Request->GetResponse();
+			if (resp.IsValid())
+			{
+				CaptureExchange(inFlight, resp->GetResponseCode(), resp->GetContentAsString());
+				HandleResponse(inFlight->Packet, resp->GetResponseCode(), resp->GetContentAsString());
+			}
+			else
+			{
+				CaptureExchange(inFlight, HttpCode::CLIENT_NETWORK_ERROR, FString());
+				QueueError(
+					inFlight->Packet,
+					HttpCode::CLIENT_NETWORK_ERROR,
+					ReasonCodes::CLIENT_NETWORK_ERROR_TIMEOUT,
+					"Timeout trying to reach brainCloud server");
+			}
+			continue;
+		}
+
+		if (inFlight->WaitingForRetry || inFlight->Request->GetStatus() != EHttpRequestStatus::Succeeded)
+			break;
+
+		FHttpResponsePtr resp = inFlight->Request->GetResponse();
+		if (!resp.IsValid() || resp->GetResponseCode() != HttpCode::OK)
+			break;
+
+		_inFlightPackets.RemoveAt(0);
+		CaptureExchange(inFlight, resp->GetResponseCode(), resp->GetContentAsString());
+		HandleResponse(inFlight->Packet, resp->GetResponseCode(), resp->GetContentAsString());
+	}
+}
+
+void BrainCloudComms::HandleResponse(PacketRef requestPacket, int32 statusCode, const FString &responseBody)
+{
+	if (statusCode == HttpCode::OK)
+	{
+		if (_isLoggingEnabled)
+			UE_LOG(LogBrainCloudComms, Log, TEXT("Got response: %s\n"), *responseBody);
+
+		PacketResultPtr result = MakeShareable(new PacketResult());
+		result->Packet = requestPacket;
+		result->ResponseBody = responseBody;
+		result->ReceivedTime = FPlatformTime::Seconds();
+
+		if (ScanResponseBundle(requestPacket, *result))
+		{
+			if (_isResumedSession && IsSessionRejected(*result))
+			{
+				RejectResumedSession(requestPacket);
+				return;
+			}
+			_isResumedSession = false;
+
+			UpdateSessionState(requestPacket, *result);
+			result->SessionId = _sessionId;
+			RecordPacketResponses(requestPacket, *result);
+
+			// the parsed json is not thread safe, the result must hold the only reference once queued
+			_results.Enqueue(result);
+		}
+		else //couldnt deserialize the response body
+		{
+			QueueError(requestPacket, HttpCode::CLIENT_NETWORK_ERROR, ReasonCodes::JSON_PARSING_ERROR, TEXT("Unable to parse response"));
+		}
+	}
+	else
 	{
-		if (_fileUploads[i]->GetStatus() == BCFileUploader::UPLOAD_STATUS_COMPLETE_SUCCESS)
+		QueueError(requestPacket, statusCode, 0, responseBody);
+	}
+}
+
+void BrainCloudComms::RetryCachedMessages()
+{
+	FScopeLock Lock(&_networkMutex);
+	if (_blockingQueue)
+	{
+		if (_isLoggingEnabled)
+			UE_LOG(LogBrainCloudComms, Log, TEXT("Retrying cached messages"));
+		_blockingQueue = false;
+
+		for (int32 i = 0; i < _inFlightPackets.Num(); ++i)
 		{
-			if (fileCallback != nullptr)
-				fileCallback->fileUploadCompleted(_fileUploads[i]->GetUploadId(), _fileUploads[i]->GetResponse());
-			_fileUploads.RemoveAt(i);
+			InFlightPacketRef inFlight = _inFlightPackets[i];
+			if (inFlight->HasFailed)
+			{
+				inFlight->HasFailed = false;
+				inFlight->RetryCount = 0;
+				inFlight->WaitingForRetry = false;
+				ResendPacket(inFlight);
+			}
 		}
-		else if (_fileUploads[i]->GetStatus() == BCFileUploader::UPLOAD_STATUS_COMPLETE_FAILED)
+	}
+}
+
+void BrainCloudComms::FlushCachedMessages(bool sendApiErrorCallbacks)
+{
+	if (_isLoggingEnabled)
+		UE_LOG(LogBrainCloudComms, Log, TEXT("Flushing cached messages"));
+
+	TArray<InFlightPacketRef> flushed;
+	{
+		FScopeLock Lock(&_networkMutex);
+		flushed = _inFlightPackets;
+		_inFlightPackets.Empty();
+		_blockingQueue = false;
+
+		_queueMutex.Lock();
+		DrainSubmissions();
+		for (int32 lane = 0; lane < NumPriorityLanes; ++lane)
+		{
+			if (_journal != nullptr)
+			{
+				for (auto node = _messageQueues[lane].GetHead(); node != nullptr; node = node->GetNextNode())
+				{
+					if (node->GetValue()->getJournalId() != 0)
+						_journal->Acknowledge(node->GetValue()->getJournalId());
+				}
+			}
+			_messageQueues[lane].Empty();
+		}
+		_bundleMarkers.Empty();
+		_queueMutex.Unlock();
+
+		for (int32 i = 0; i < flushed.Num(); ++i)
+			AcknowledgeJournal(flushed[i]->Packet);
+	}
+
+	for (int32 i = 0; i < flushed.Num(); ++i)
+	{
+		if (flushed[i]->Request.IsValid())
+			flushed[i]->Request->CancelRequest();
+
+		if (sendApiErrorCallbacks)
 		{
-			if (fileCallback != nullptr)
-				fileCallback->fileUploadFailed(
-					_fileUploads[i]->GetUploadId(),
-					_fileUploads[i]->GetHttpStatus(),
-					_fileUploads[i]->GetErrorReasonCode(),
-					_fileUploads[i]->GetResponse());
-			_fileUploads.RemoveAt(i);
+			ReportError(
+				flushed[i]->Packet,
+				HttpCode::CLIENT_NETWORK_ERROR,
+				ReasonCodes::CLIENT_NETWORK_ERROR_TIMEOUT,
+				"Timeout trying to reach brainCloud server");
 		}
 	}
 }
 
+void BrainCloudComms::UpdateUploads()
+{
+	IFileUploadCallback *fileCallback = _fileUploadCallback != nullptr ? _fileUploadCallback : m_registeredRestBluePrintCallbacks.Contains(ServiceName::File.getValue()) ? m_registeredRestBluePrintCallbacks[ServiceName::File.getValue()] : nullptr;
+	_uploadScheduler.Update(fileCallback);
+}
+
 void BrainCloudComms::CancelUpload(const FString &uploadId)
 {
-	TSharedPtr<BCFileUploader> uploader = FindFileUploader(uploadId);
-	if (uploader.IsValid())
-		uploader->CancelUpload();
+	_uploadScheduler.Cancel(uploadId);
 }
 
 float BrainCloudComms::GetUploadProgress(const FString &uploadId)
@@ -631,14 +1128,9 @@ int32 BrainCloudComms::GetUploadTotalBytesToTransfer(const FString &uploadId)
 
 TSharedPtr<BCFileUploader> BrainCloudComms::FindFileUploader(const FString &uploadId)
 {
-	int32 count = _fileUploads.Num();
-	for (int32 i = 0; i < count; ++i)
-	{
-		if (_fileUploads[i]->GetUploadId() == uploadId)
-		{
-			return _fileUploads[i];
-		}
-	}
+	TSharedPtr<BCFileUploader> uploader = _uploadScheduler.Find(uploadId);
+	if (uploader.IsValid())
+		return uploader;
 
 	if (_isLoggingEnabled)
 		UE_LOG(LogBrainCloudComms, Log, TEXT("Could not find Uploader with ID: %s"), *uploadId);
@@ -648,60 +1140,53 @@ TSharedPtr<BCFileUploader> BrainCloudComms::FindFileUploader(const FString &uplo
 void BrainCloudComms::FakeErrorResponse(uint32 statusCode, uint32 reasonCode, const FString statusMessage)
 {
 	PacketRef requestPacket = BuildPacket();
-	FString sendString = GetDataString(requestPacket, _packetId);
 	if (_isLoggingEnabled)
-		UE_LOG(LogBrainCloudComms, Log, TEXT("Sending request:%s\n"), *sendString);
+	{
+		WriteRequestBody(requestPacket, _packetId, _requestBody);
+		UE_LOG(LogBrainCloudComms, Log, TEXT("Sending request:%s\n"), *BodyToString(_requestBody));
+	}
 
-	_currentPacket = requestPacket;
-	ReportError(requestPacket, statusCode, reasonCode, statusMessage);
+	QueueError(requestPacket, statusCode, reasonCode, statusMessage);
 }
 
-void BrainCloudComms::ReportResults(PacketRef requestPacket, TSharedRef<FJsonObject> responsePacket)
+void BrainCloudComms::ReportResults(PacketRef requestPacket, const PacketResult &result)
 {
-	TArray<TSharedPtr<FJsonValue>> responses = responsePacket->GetArrayField("responses");
+	const TCHAR *json = *result.ResponseBody;
 
 	TArray<TSharedPtr<FJsonValue>> apiRewards;
 	UObject *tempCallback = nullptr;
 	IRewardCallback *rewardCallback = _rewardCallback != nullptr ? _rewardCallback : m_registeredRestBluePrintCallbacks.Contains("reward") ? m_registeredRestBluePrintCallbacks["reward"] : nullptr;
 
-	for (int32 i = 0; i < responses.Num(); i++)
+	for (int32 i = 0; i < result.Responses.Num() && i < requestPacket->Num(); i++)
 	{
-		TSharedRef<ServerCall> sc = (*requestPacket)[i];
-		TSharedPtr<FJsonObject> respObj = responses[i]->AsObject();
+		ServerCallRef sc = (*requestPacket)[i];
+		const ResponseSlice &response = result.Responses[i];
+		TSharedPtr<FJsonObject> respObj = response.Parsed;
 
-		uint32 statusCode = respObj->GetNumberField("status");
+		uint32 statusCode = response.StatusCode;
 
-		IServerCallback *callback = sc->getCallback();
+		IServerCallback *callback = sc->getIsWarmUp() ? _warmUpCallback : sc->getCallback();
 
-		FString jsonRespStr = UBrainCloudWrapper::GetJsonString(respObj.ToSharedRef());
+		// hand out the response text as the server sent it
+		FString jsonRespStr(response.End - response.Start, json + response.Start);
 
 		if (statusCode == HttpCode::OK || (!_errorCallbackOn202 && statusCode == 202))
 		{
-			ResetKillSwitch();
-			FilterIncomingMessages(sc, respObj.ToSharedRef());
+			if (respObj.IsValid())
+				FilterIncomingMessages(sc, respObj.ToSharedRef(), result.SessionId);
+			if (sc->getIsWarmUp())
+				CacheWarmUpResponse(sc, jsonRespStr);
 			if (callback != nullptr)
 				callback->serverCallback(sc->getService(), sc->getOperation(), *jsonRespStr);
 		}
 		else
 		{
-			uint32 reasonCode = 0;
-			if (respObj->HasField("reason_code"))
-			{
-				reasonCode = respObj->GetNumberField("reason_code");
-				if (reasonCode == ReasonCodes::PLAYER_SESSION_EXPIRED || reasonCode == ReasonCodes::NO_SESSION || reasonCode == ReasonCodes::PLAYER_SESSION_LOGGED_OUT || sc->getOperation() == ServiceOperation::Logout || sc->getOperation() == ServiceOperation::FullReset)
-				{
-					_isAuthenticated = false;
-					_sessionId = TEXT("");
-					_statusCodeCache = statusCode;
-					_reasonCodeCache = reasonCode;
-					_statusMessageCache = respObj->GetStringField("status_message");
-				}
-			}
+			uint32 reasonCode = response.ReasonCode;
 
 			FString errorString;
 			if (_useOldStatusMessage)
 			{
-				errorString = respObj->GetStringField("status_message");
+				errorString = response.StatusMessage;
 			}
 			else
 			{
@@ -715,11 +1200,9 @@ void BrainCloudComms::ReportResults(PacketRef requestPacket, TSharedRef<FJsonObj
 
 			if (globalErrorCallback != nullptr)
 				globalErrorCallback->globalError(sc->getService(), sc->getOperation(), statusCode, reasonCode, *errorString);
-
-			UpdateKillSwitch(sc->getService().getValue(), sc->getOperation().getValue(), statusCode);
 		}
 
-		if (rewardCallback && (statusCode == HttpCode::OK || (!_errorCallbackOn202 && statusCode == 202)))
+		if (rewardCallback && respObj.IsValid() && (statusCode == HttpCode::OK || (!_errorCallbackOn202 && statusCode == 202)))
 		{
 			ServiceName service = sc->getService();
 			ServiceOperation operation = sc->getOperation();
@@ -769,18 +1252,15 @@ void BrainCloudComms::ReportResults(PacketRef requestPacket, TSharedRef<FJsonObj
 			rewardCallback->rewardCallback(jsonString);
 		}
 	}
-
-	_activeRequest = nullptr; //clear the active request
-	_currentPacket = nullptr;
 }
 
 void BrainCloudComms::ReportError(PacketRef requestPacket, uint32 statusCode, uint32 reasonCode, const FString statusMessage)
 {
-	TArray<TSharedRef<ServerCall>> arr = requestPacket.Get();
+	const TArray<ServerCallRef> &arr = requestPacket.Get();
 	for (int32 i = 0; i < arr.Num(); i++)
 	{
-		TSharedRef<ServerCall> sc = arr[i];
-		IServerCallback *callback = sc->getCallback();
+		ServerCallRef sc = arr[i];
+		IServerCallback *callback = sc->getIsWarmUp() ? _warmUpCallback : sc->getCallback();
 		if (callback != nullptr)
 		{
 			FString errorString;
@@ -799,33 +1279,130 @@ void BrainCloudComms::ReportError(PacketRef requestPacket, uint32 statusCode, ui
 				globalErrorCallback->globalError(sc->getService(), sc->getOperation(), statusCode, reasonCode, *errorString);
 		}
 	}
+}
+
+bool BrainCloudComms::ScanResponseBundle(PacketRef requestPacket, PacketResult &result)
+{
+	// locate each response in the body rather than building a tree of the
+	// whole bundle, large entity and leaderboard payloads are never parsed
+	const TCHAR *json = *result.ResponseBody;
+	int32 len = result.ResponseBody.Len();
+
+	int32 start = 0;
+	int32 end = 0;
+	TArray<TPair<int32, int32>> elements;
+	if (!JsonUtil::findJsonField(json, len, 0, TEXT("responses"), start, end) ||
+		!JsonUtil::splitJsonArray(json, end, start, elements))
+	{
+		return false;
+	}
+
+	if (JsonUtil::findJsonField(json, len, 0, TEXT("events"), start, end))
+	{
+		result.EventsStart = start;
+		result.EventsEnd = end;
+	}
+
+	result.Responses.SetNum(elements.Num());
+	for (int32 i = 0; i < elements.Num(); ++i)
+	{
+		ResponseSlice &response = result.Responses[i];
+		response.Start = elements[i].Key;
+		response.End = elements[i].Value;
+
+		if (!JsonUtil::findJsonField(json, response.End, response.Start, TEXT("status"), start, end))
+			return false;
+		response.StatusCode = FCString::Atoi(json + start);
+
+		if (JsonUtil::findJsonField(json, response.End, response.Start, TEXT("reason_code"), start, end))
+		{
+			response.ReasonCode = FCString::Atoi(json + start);
+			response.HasReasonCode = true;
+		}
+
+		if (JsonUtil::findJsonField(json, response.End, response.Start, TEXT("status_message"), start, end))
+			response.StatusMessage = JsonUtil::unescapeJsonString(json, start, end);
+
+		if (i < requestPacket->Num() && NeedsParsedResponse((*requestPacket)[i], response.StatusCode))
+		{
+			response.Parsed = JsonUtil::jsonStringToValue(FString(response.End - response.Start, json + response.Start));
+			if (!response.Parsed.IsValid())
+				return false;
+		}
+	}
+	return true;
+}
+
+bool BrainCloudComms::NeedsParsedResponse(ServerCallRef servercall, uint32 statusCode)
+{
+	if (statusCode != HttpCode::OK && (_errorCallbackOn202 || statusCode != 202))
+		return false;
+
+	// the calls whose data is read by UpdateSessionState, FilterIncomingMessages or the reward callback
+	ServiceName service = servercall->getService();
+	ServiceOperation operation = servercall->getOperation();
+	return service == ServiceName::AuthenticateV2 ||
+		   service == ServiceName::Identity ||
+		   (service == ServiceName::PlayerState && (operation == ServiceOperation::FullReset || operation == ServiceOperation::Logout || operation == ServiceOperation::UpdateName)) ||
+		   (service == ServiceName::File && operation == ServiceOperation::PrepareUserUpload) ||
+		   (service == ServiceName::PlayerStatistics && operation == ServiceOperation::Update) ||
+		   (service == ServiceName::PlayerStatisticsEvent && (operation == ServiceOperation::Trigger || operation == ServiceOperation::TriggerMultiple));
+}
+
+void BrainCloudComms::UpdateSessionState(PacketRef requestPacket, const PacketResult &result)
+{
+	// applied as soon as a response is scanned so the next bundle can go out
+	// before the app has been called back
+	bool isSessionActive = false;
+	for (int32 i = 0; i < result.Responses.Num() && i < requestPacket->Num(); i++)
+	{
+		ServerCallRef sc = (*requestPacket)[i];
+		const ResponseSlice &response = result.Responses[i];
+
+		uint32 statusCode = response.StatusCode;
+
+		if (statusCode == HttpCode::OK || (!_errorCallbackOn202 && statusCode == 202))
+		{
+			isSessionActive = true;
+			ResetKillSwitch();
+			if (response.Parsed.IsValid())
+				UpdateSessionState(sc, response.Parsed.ToSharedRef());
+		}
+		else
+		{
+			uint32 reasonCode = response.ReasonCode;
+			if (response.HasReasonCode && (reasonCode == ReasonCodes::PLAYER_SESSION_EXPIRED || reasonCode == ReasonCodes::NO_SESSION || reasonCode == ReasonCodes::PLAYER_SESSION_LOGGED_OUT || sc->getOperation() == ServiceOperation::Logout || sc->getOperation() == ServiceOperation::FullReset))
+			{
+				_isAuthenticated = false;
+				_sessionId = TEXT("");
+				_statusCodeCache = statusCode;
+				_reasonCodeCache = reasonCode;
+				_statusMessageCache = response.StatusMessage;
+			}
+
+			UpdateKillSwitch(sc->getService().getValue(), sc->getOperation().getValue(), statusCode);
+		}
+	}
 
-	_activeRequest = nullptr; //clear the active request
-	_currentPacket = nullptr;
+	// the server counts the session's expiry from the last call it handled
+	if (isSessionActive && !_sessionId.IsEmpty())
+		_sessionExpiresAt = FDateTime::UtcNow() + FTimespan::FromSeconds(_sessionExpirySeconds);
 }
 
-void BrainCloudComms::FilterIncomingMessages(TSharedRef<ServerCall> servercall, TSharedRef<FJsonObject> response)
+void BrainCloudComms::UpdateSessionState(ServerCallRef servercall, TSharedRef<FJsonObject> response)
 {
 	ServiceName service = servercall->getService();
 	ServiceOperation operation = servercall->getOperation();
 
 	TSharedPtr<FJsonValue> Field = response->TryGetField("data");
 	const TSharedPtr<FJsonObject>* data = nullptr;
-	bool isDataValid = Field->TryGetObject(data);
-	// A session id or a profile id could potentially come back in any messages
+	bool isDataValid = Field.IsValid() && Field->TryGetObject(data);
+	// A session id could potentially come back in any messages
 	//Only allow it in Authenticate and Identity calls.
 	if ( isDataValid && (service == ServiceName::AuthenticateV2 || service == ServiceName::Identity))
 	{
 		(*data)->TryGetStringField("sessionId", _sessionId);
 
-		FString profileIdOut;
-		(*data)->TryGetStringField("profileId", profileIdOut);
-
-		if (!profileIdOut.IsEmpty())
-		{
-			_client->getAuthenticationService()->setProfileId(profileIdOut);
-		}
-
 		FString appIdOut;
 		(*data)->TryGetStringField("switchToAppId", appIdOut);
 		if (!appIdOut.IsEmpty())
@@ -833,11 +1410,7 @@ void BrainCloudComms::FilterIncomingMessages(TSharedRef<ServerCall> servercall,
 			_appId = (*data)->GetStringField("switchToAppId");
 
 			//update the secret key
-			_secretKey = "MISSING";
-			if (_secretMap.Contains(_appId))
-			{
-				_secretKey = _secretMap[_appId];
-			}
+			SetSecretKey(_secretMap.Contains(_appId) ? _secretMap[_appId] : FString(TEXT("MISSING")));
 		}
 	}
 
@@ -846,11 +1419,16 @@ void BrainCloudComms::FilterIncomingMessages(TSharedRef<ServerCall> servercall,
 		_isAuthenticated = true;
 		ResetErrorCache();
 
+		FString profileId;
+		if (isDataValid && (*data)->TryGetStringField("profileId", profileId))
+			ReplayJournal(profileId);
+
 		if (isDataValid)
 		{
+			_sessionExpirySeconds = (*data)->GetIntegerField("playerSessionExpiry");
 			if (_heartbeatInterval == 0)
 			{
-				int32 sessionTimeout = (*data)->GetIntegerField("playerSessionExpiry");
+				int32 sessionTimeout = _sessionExpirySeconds;
 				sessionTimeout = (int32)((double)sessionTimeout * 0.85);
 
 				// minimum 30 secs
@@ -862,7 +1440,44 @@ void BrainCloudComms::FilterIncomingMessages(TSharedRef<ServerCall> servercall,
 
 			if ((*data)->HasField("maxKillCount"))
 				_killSwitchThreshold = (*data)->GetNumberField("maxKillCount");
+		}
+	}
+	else if (service == ServiceName::PlayerState &&
+			 (operation == ServiceOperation::FullReset || operation == ServiceOperation::Logout))
+	{
+		_isAuthenticated = false;
+		_sessionId = TEXT("");
+		ResetErrorCache();
+	}
+}
+
+void BrainCloudComms::FilterIncomingMessages(ServerCallRef servercall, TSharedRef<FJsonObject> response, const FString &sessionId)
+{
+	// session state has already been applied by UpdateSessionState, this
+	// only deals with the client side services
+	ServiceName service = servercall->getService();
+	ServiceOperation operation = servercall->getOperation();
+
+	TSharedPtr<FJsonValue> Field = response->TryGetField("data");
+	const TSharedPtr<FJsonObject>* data = nullptr;
+	bool isDataValid = Field.IsValid() && Field->TryGetObject(data);
+	// A profile id could potentially come back in any messages
+	//Only allow it in Authenticate and Identity calls.
+	if ( isDataValid && (service == ServiceName::AuthenticateV2 || service == ServiceName::Identity))
+	{
+		FString profileIdOut;
+		(*data)->TryGetStringField("profileId", profileIdOut);
 
+		if (!profileIdOut.IsEmpty())
+		{
+			_client->getAuthenticationService()->setProfileId(profileIdOut);
+		}
+	}
+
+	if (service == ServiceName::AuthenticateV2 && operation == ServiceOperation::Authenticate)
+	{
+		if (isDataValid)
+		{
 			//set player name
 			FString name = (*data)->GetStringField("playerName");
 			_client->getPlayerStateService()->setUserName(name);
@@ -871,9 +1486,6 @@ void BrainCloudComms::FilterIncomingMessages(TSharedRef<ServerCall> servercall,
 	else if (service == ServiceName::PlayerState &&
 			 (operation == ServiceOperation::FullReset || operation == ServiceOperation::Logout))
 	{
-		_isAuthenticated = false;
-		_sessionId = TEXT("");
-		ResetErrorCache();
 		_client->getAuthenticationService()->clearSavedProfileId();
 		_client->getPlayerStateService()->setUserName(TEXT(""));
 	}
@@ -901,31 +1513,508 @@ void BrainCloudComms::FilterIncomingMessages(TSharedRef<ServerCall> servercall,
 			FString localPath = fileInfo->GetStringField("localPath");
 			FString uploadId = fileInfo->GetStringField("uploadId");
 
-			_fileUploads.Add(uploader);
-			uploader->UploadFile(localPath, _sessionId, uploadId, _uploadUrl);
+			// _uploadUrl is only written by Initialize, on the game thread
+			_uploadScheduler.Enqueue(uploader, uploadId, localPath, sessionId, _uploadUrl);
 		}
 	}
 }
 
 void BrainCloudComms::ResetCommunication()
 {
+	FScopeLock Lock(&_networkMutex);
 	_queueMutex.Lock();
-	_messageQueue.Empty();
+	DrainSubmissions();
+	for (int32 lane = 0; lane < NumPriorityLanes; ++lane)
+		_messageQueues[lane].Empty();
+	_bundleMarkers.Empty();
+	_rejectedCalls.Empty();
 	_queueMutex.Unlock();
 	_isAuthenticated = false;
+	_isResumedSession = false;
+	_isReauthenticating = false;
 	_sessionId = TEXT("");
 	_packetId = 0;
 	ResetErrorCache();
-	_waitingForRetry = false;
 
-	if (_activeRequest.IsValid())
-		_activeRequest->CancelRequest();
-	_activeRequest = nullptr;
-	_currentPacket = nullptr;
+	for (int32 i = 0; i < _inFlightPackets.Num(); ++i)
+	{
+		if (_inFlightPackets[i]->Request.IsValid())
+			_inFlightPackets[i]->Request->CancelRequest();
+	}
+	_inFlightPackets.Empty();
+	_replayedPackets.Empty();
+	_results.Empty();
+
+	if (_journal != nullptr)
+		_journal->ReleaseAll();
 
 	_blockingQueue = false;
 }
 
+void BrainCloudComms::EnableOfflineJournal(bool enabled)
+{
+	FScopeLock Lock(&_networkMutex);
+	_offlineJournalEnabled = enabled;
+
+	if (!enabled)
+	{
+		delete _journal;
+		_journal = nullptr;
+	}
+	else if (_isInitialized)
+	{
+		OpenOfflineJournal();
+	}
+}
+
+void BrainCloudComms::AddDurableOperation(ServiceName service, ServiceOperation operation)
+{
+	FScopeLock Lock(&_networkMutex);
+	_durableOperations.Add(DurableOperation{service, operation});
+}
+
+void BrainCloudComms::SetOfflineJournalMaxSize(int32 maxBytes)
+{
+	FScopeLock Lock(&_networkMutex);
+	_offlineJournalMaxBytes = maxBytes;
+	if (_journal != nullptr)
+		_journal->SetMaxBytes(maxBytes);
+}
+
+void BrainCloudComms::OpenOfflineJournal()
+{
+	// one journal per app, switching apps leaves the other's calls on disk
+	FString path = FPaths::ProjectSavedDir() / TEXT("BrainCloud") / FString::Printf(TEXT("OfflineJournal_%s.bin"), *_appId);
+
+	delete _journal;
+	_journal = new BCOfflineJournal(path, _offlineJournalMaxBytes);
+}
+
+bool BrainCloudComms::IsDurable(const ServerCall &servercall)
+{
+	for (const DurableOperation &durable : _durableOperations)
+	{
+		if (durable.Service == servercall.getService() && durable.Operation == servercall.getOperation())
+			return true;
+	}
+	return false;
+}
+
+void BrainCloudComms::JournalServerCall(ServerCall &servercall)
+{
+	uint64 journalId = _journal->Append(
+		_client->getAuthenticationService()->getProfileId(),
+		servercall.getService().getValue(),
+		servercall.getOperation().getValue(),
+		servercall.getPayload());
+
+	if (journalId == 0 && _isLoggingEnabled)
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Offline journal is full, %s %s will not be kept"), servercall.getService().getValue(), servercall.getOperation().getValue());
+
+	servercall.setJournalId(journalId);
+}
+
+void BrainCloudComms::AcknowledgeJournal(PacketRef packet)
+{
+	if (_journal == nullptr)
+		return;
+
+	for (int32 i = 0; i < packet->Num(); i++)
+	{
+		uint64 journalId = (*packet)[i]->getJournalId();
+		if (journalId != 0)
+			_journal->Acknowledge(journalId);
+	}
+}
+
+void BrainCloudComms::ReplayJournal(const FString &profileId)
+{
+	if (_journal == nullptr)
+		return;
+
+	TArray<BCOfflineJournal::Entry> entries;
+	_journal->TakeDormant(profileId, entries);
+	if (entries.Num() == 0)
+		return;
+
+	if (_isLoggingEnabled)
+		UE_LOG(LogBrainCloudComms, Log, TEXT("Replaying %d journaled calls"), entries.Num());
+
+	// the journaled calls are older than anything queued, they go in at the
+	// tail (the send end) of their lane newest first so they keep their
+	// original order
+	_queueMutex.Lock();
+	for (int32 i = entries.Num() - 1; i >= 0; --i)
+	{
+		ServiceName service = ServiceName::None;
+		ServiceOperation operation = ServiceOperation::None;
+		for (const DurableOperation &durable : _durableOperations)
+		{
+			if (entries[i].Service == durable.Service.getValue() && entries[i].Operation == durable.Operation.getValue())
+			{
+				service = durable.Service;
+				operation = durable.Operation;
+				break;
+			}
+		}
+
+		ServerCallRef sc = MakeShareable(new ServerCall(service, operation, entries[i].Payload));
+		sc->setJournalId(entries[i].Id);
+		sc->setQueuedTime(FPlatformTime::Seconds());
+		AssignPriority(sc.Get());
+		_messageQueues[(int32)sc->getPriority()].AddTail(sc);
+	}
+	_queueMutex.Unlock();
+}
+
+void BrainCloudComms::RecordPacketSent(PacketRef packet)
+{
+	if (!_metrics.IsEnabled())
+		return;
+
+	_metrics.RecordBundleSent(packet->Num(), _maxBundleMessages, _requestBody.Num());
+	for (int32 i = 0; i < packet->Num(); ++i)
+	{
+		ServerCallRef servercall = (*packet)[i];
+		servercall->setSentTime(_requestSentTime);
+		_metrics.RecordSent(
+			servercall->getService().getValue(),
+			servercall->getOperation().getValue(),
+			_requestSentTime - servercall->getQueuedTime(),
+			servercall->getPayload().Num());
+	}
+}
+
+void BrainCloudComms::RecordPacketRetry(PacketRef packet)
+{
+	if (!_metrics.IsEnabled())
+		return;
+
+	// the bundle totals count the resend once, each of its calls is marked as retried
+	_metrics.RecordBundleRetry();
+	for (int32 i = 0; i < packet->Num(); ++i)
+	{
+		ServerCallRef servercall = (*packet)[i];
+		_metrics.RecordRetry(servercall->getService().getValue(), servercall->getOperation().getValue());
+	}
+}
+
+void BrainCloudComms::RecordPacketResponses(PacketRef packet, const PacketResult &result)
+{
+	if (!_metrics.IsEnabled())
+		return;
+
+	// the server latency includes any retries of the bundle
+	for (int32 i = 0; i < packet->Num() && i < result.Responses.Num(); ++i)
+	{
+		ServerCallRef servercall = (*packet)[i];
+		const ResponseSlice &response = result.Responses[i];
+		_metrics.RecordResponse(
+			servercall->getService().getValue(),
+			servercall->getOperation().getValue(),
+			result.ReceivedTime - servercall->getSentTime(),
+			response.End - response.Start);
+	}
+}
+
+void BrainCloudComms::RecordPacketCallbacks(const PacketResult &result)
+{
+	if (!_metrics.IsEnabled() || !result.Packet.IsValid())
+		return;
+
+	double callbackSeconds = FPlatformTime::Seconds() - result.ReceivedTime;
+	for (int32 i = 0; i < result.Packet->Num(); ++i)
+	{
+		ServerCallRef servercall = (*result.Packet)[i];
+		bool isError = result.IsError || (i < result.Responses.Num() && result.Responses[i].StatusCode != HttpCode::OK);
+		_metrics.RecordCallback(servercall->getService().getValue(), servercall->getOperation().getValue(), callbackSeconds, isError);
+	}
+}
+
+bool BrainCloudComms::StartPacketCapture(const FString &path)
+{
+	FScopeLock Lock(&_networkMutex);
+	delete _capture;
+	_capture = BCPacketCapture::Create(path);
+	if (_capture == nullptr)
+	{
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Could not create packet capture %s"), *path);
+		return false;
+	}
+	return true;
+}
+
+void BrainCloudComms::StopPacketCapture()
+{
+	FScopeLock Lock(&_networkMutex);
+	delete _capture;
+	_capture = nullptr;
+}
+
+bool BrainCloudComms::StartPacketReplay(const FString &path, float speed)
+{
+	FScopeLock Lock(&_networkMutex);
+
+	TArray<BCPacketCapture::Exchange> exchanges;
+	if (!BCPacketCapture::Load(path, exchanges))
+	{
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Could not load packet capture %s"), *path);
+		return false;
+	}
+
+	_replayExchanges = MoveTemp(exchanges);
+	_replayIndex = 0;
+	_replaySpeed = speed;
+	_replayedPackets.Empty();
+	_isReplaying = true;
+	return true;
+}
+
+void BrainCloudComms::StopPacketReplay()
+{
+	FScopeLock Lock(&_networkMutex);
+	_isReplaying = false;
+	_replayExchanges.Empty();
+	_replayIndex = 0;
+}
+
+void BrainCloudComms::CaptureExchange(InFlightPacketRef inFlight, int32 statusCode, const FString &responseBody)
+{
+	if (_capture == nullptr || !inFlight->Request.IsValid())
+		return;
+
+	BCPacketCapture::Exchange exchange;
+	double elapsed = _capture->GetElapsedTime();
+	exchange.ResponseTime = FPlatformTime::Seconds() - inFlight->SentTime;
+	exchange.SendTime = elapsed - exchange.ResponseTime;
+	exchange.PacketId = inFlight->PacketId;
+	exchange.MessageCount = inFlight->Packet->Num();
+	exchange.RequestHeaders = inFlight->Request->GetAllHeaders();
+	exchange.RequestBody = inFlight->Request->GetContent();
+	exchange.StatusCode = statusCode;
+
+	FTCHARToUTF8 response(*responseBody);
+	exchange.ResponseBody.Append(reinterpret_cast<const uint8 *>(response.Get()), response.Length());
+	_capture->Write(exchange);
+}
+
+void BrainCloudComms::ReplayPacket(PacketRef packet)
+{
+	// the body is still written so replays measure the full cost of a bundle
+	WriteRequestBody(packet, _packetId++, _requestBody);
+	if (_isLoggingEnabled)
+		UE_LOG(LogBrainCloudComms, Log, TEXT("Replaying request:%s\n"), *BodyToString(_requestBody));
+
+	_requestSentTime = FPlatformTime::Seconds();
+	RecordPacketSent(packet);
+
+	ReplayedPacket replayed{packet, _requestSentTime, HttpCode::CLIENT_NETWORK_ERROR, FString()};
+	if (_replayIndex < _replayExchanges.Num())
+	{
+		const BCPacketCapture::Exchange &exchange = _replayExchanges[_replayIndex++];
+		if (exchange.MessageCount != packet->Num())
+		{
+			UE_LOG(LogBrainCloudComms, Warning, TEXT("Replayed packet %d had %d messages, this one has %d"),
+				_replayIndex - 1, exchange.MessageCount, packet->Num());
+		}
+
+		if (_replaySpeed > 0.0f)
+			replayed.DueTime += exchange.ResponseTime / _replaySpeed;
+		replayed.StatusCode = exchange.StatusCode;
+		replayed.ResponseBody = exchange.GetResponseString();
+	}
+	else
+	{
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Packet capture has no more responses to replay"));
+	}
+	_replayedPackets.Add(MoveTemp(replayed));
+}
+
+void BrainCloudComms::ProcessReplayedPackets()
+{
+	// answered in the order they were sent, as ProcessCompletedPackets does
+	double now = FPlatformTime::Seconds();
+	while (_replayedPackets.Num() > 0 && _replayedPackets[0].DueTime <= now)
+	{
+		ReplayedPacket replayed = MoveTemp(_replayedPackets[0]);
+		_replayedPackets.RemoveAt(0);
+
+		if (replayed.StatusCode == HttpCode::CLIENT_NETWORK_ERROR)
+		{
+			QueueError(
+				replayed.Packet,
+				HttpCode::CLIENT_NETWORK_ERROR,
+				ReasonCodes::CLIENT_NETWORK_ERROR_TIMEOUT,
+				"Timeout trying to reach brainCloud server");
+			continue;
+		}
+		HandleResponse(replayed.Packet, replayed.StatusCode, replayed.ResponseBody);
+	}
+}
+
+void BrainCloudComms::ResumeSession(const FString &sessionId, int32 sessionExpirySeconds, int32 maxBundleMessages, int32 killSwitchThreshold, IServerCallback *reauthenticateCallback,
+								   IServerCallback *callback, const FString &authenticateResponse)
+{
+	FScopeLock Lock(&_networkMutex);
+	_sessionId = sessionId;
+	_sessionExpirySeconds = sessionExpirySeconds;
+	_maxBundleMessages = maxBundleMessages;
+	_killSwitchThreshold = killSwitchThreshold;
+	_resumeCallback = reauthenticateCallback;
+	_isAuthenticated = true;
+	_isResumedSession = true;
+	_sessionExpiresAt = FDateTime::UtcNow() + FTimespan::FromSeconds(sessionExpirySeconds);
+	ResetErrorCache();
+
+	if (_heartbeatInterval == 0)
+		_heartbeatInterval = (int32)((double)sessionExpirySeconds * 0.85) * 1000;
+
+	// answered from RunCallbacks like a real authentication, never from inside the call that asked for it
+	if (callback != nullptr)
+	{
+		PacketResultPtr result = MakeShareable(new PacketResult());
+		result->ResumedCallback = callback;
+		result->ResponseBody = authenticateResponse;
+		result->ReceivedTime = FPlatformTime::Seconds();
+		_results.Enqueue(result);
+	}
+}
+
+FDateTime BrainCloudComms::GetSessionExpiresAt(const FString &sessionId)
+{
+	FScopeLock Lock(&_networkMutex);
+	if (sessionId.IsEmpty() || sessionId != _sessionId)
+		return FDateTime::MinValue();
+	return _sessionExpiresAt;
+}
+
+bool BrainCloudComms::IsSessionRejected(const PacketResult &result)
+{
+	for (const ResponseSlice &response : result.Responses)
+	{
+		if (response.ReasonCode == ReasonCodes::NO_SESSION || response.ReasonCode == ReasonCodes::PLAYER_SESSION_EXPIRED)
+			return true;
+	}
+	return false;
+}
+
+void BrainCloudComms::RejectResumedSession(PacketRef packet)
+{
+	if (_isLoggingEnabled)
+		UE_LOG(LogBrainCloudComms, Log, TEXT("Resumed session was rejected, authenticating again"));
+
+	_isResumedSession = false;
+	_isAuthenticated = false;
+	_isReauthenticating = true;
+	_sessionId = TEXT("");
+
+	// held back until the authentication replacing the session has been queued
+	_queueMutex.Lock();
+	_rejectedCalls.Append(*packet);
+	_queueMutex.Unlock();
+
+	// authentication is queued from the game thread, see DispatchResults
+	PacketResultPtr result = MakeShareable(new PacketResult());
+	result->IsSessionRejected = true;
+	_results.Enqueue(result);
+}
+
+void BrainCloudComms::RequeueRejectedCalls()
+{
+	FScopeLock Lock(&_queueMutex);
+	if (_rejectedCalls.Num() == 0)
+		return;
+
+	DrainSubmissions();
+
+	// the new authentication goes first, it takes the rejected bundle's place
+	// so no end of bundle marker can hold it back behind the calls it unblocks
+	TDoubleLinkedList<ServerCallRef> &critical = _messageQueues[(int32)eBCCallPriority::CRITICAL];
+	auto authNode = critical.GetTail();
+	while (authNode != nullptr && authNode->GetValue()->getOperation() != ServiceOperation::Authenticate)
+		authNode = authNode->GetPrevNode();
+
+	if (authNode != nullptr)
+	{
+		ServerCallRef authentication = authNode->GetValue();
+		authentication->setQueueSequence(_rejectedCalls[0]->getQueueSequence());
+		authentication->setIsEndOfBundle(true);
+		critical.RemoveNode(authNode);
+		critical.AddTail(authentication);
+		authNode = critical.GetTail();
+	}
+
+	// then the rejected bundle, oldest call first, ahead of anything queued since
+	for (int32 i = _rejectedCalls.Num() - 1; i >= 0; --i)
+	{
+		ServerCallRef servercall = _rejectedCalls[i];
+		TDoubleLinkedList<ServerCallRef> &lane = _messageQueues[(int32)servercall->getPriority()];
+		if (&lane == &critical && authNode != nullptr)
+			lane.InsertNode(servercall, authNode);
+		else
+			lane.AddTail(servercall);
+	}
+	_rejectedCalls.Empty();
+}
+
+void BrainCloudComms::BeginWarmUpCalls(bool cacheResponses)
+{
+	FScopeLock Lock(&_networkMutex);
+	_isRecordingWarmUp = true;
+	_warmUpThreadId = FPlatformTLS::GetCurrentThreadId();
+	_cacheWarmUpResponses = cacheResponses;
+}
+
+void BrainCloudComms::EndWarmUpCalls()
+{
+	FScopeLock Lock(&_networkMutex);
+	_isRecordingWarmUp = false;
+}
+
+void BrainCloudComms::ClearWarmUpCalls()
+{
+	_networkMutex.Lock();
+	_warmUpCalls.Empty();
+	_networkMutex.Unlock();
+
+	_warmUpResponses.Empty();
+}
+
+FString BrainCloudComms::GetWarmUpResponse(ServiceName service, ServiceOperation operation)
+{
+	const FString *response = _warmUpResponses.Find(FString::Printf(TEXT("%s.%s"), service.getValue(), operation.getValue()));
+	return response != nullptr ? *response : FString();
+}
+
+void BrainCloudComms::AppendWarmUpCalls(PacketRef packet)
+{
+	FScopeLock Lock(&_networkMutex);
+
+	int32 packetBytes = 0;
+	for (const ServerCallRef &servercall : *packet)
+		packetBytes += servercall->getPayload().Num();
+
+	// a fresh call each time, the recorded ones are kept for every authentication to come.
+	// Calls past the bundle limits are left out, the rest keep their order
+	for (const WarmUpCall &warmUp : _warmUpCalls)
+	{
+		if (packet->Num() >= _maxBundleMessages || (_maxBundleBytes > 0 && packetBytes + warmUp.Payload.Num() > _maxBundleBytes))
+			break;
+		packetBytes += warmUp.Payload.Num();
+
+		ServerCallRef sc = MakeShareable(new ServerCall(warmUp.Service, warmUp.Operation, warmUp.Payload));
+		sc->setIsWarmUp(true);
+		sc->setQueuedTime(FPlatformTime::Seconds());
+		packet->Add(sc);
+	}
+}
+
+void BrainCloudComms::CacheWarmUpResponse(ServerCallRef servercall, const FString &response)
+{
+	if (_cacheWarmUpResponses)
+		_warmUpResponses.Add(FString::Printf(TEXT("%s.%s"), servercall->getService().getValue(), servercall->getOperation().getValue()), response);
+}
+
 void BrainCloudComms::ResetErrorCache()
 {
 	_statusCodeCache = HttpCode::FORBIDDEN;
@@ -972,13 +2061,11 @@ void BrainCloudComms::Heartbeat()
 	}
 }
 
-bool BrainCloudComms::ShouldRetryPacket()
+bool BrainCloudComms::ShouldRetryPacket(PacketRef packet)
 {
-	TArray<TSharedRef<ServerCall>> arr = *_currentPacket.Get();
+	const TArray<ServerCallRef> &arr = packet.Get();
 	for (int32 i = 0; i < arr.Num(); i++)
 	{
-		TSharedRef<ServerCall> sc = arr[i];
-
 		if (arr[i]->getService() == ServiceName::AuthenticateV2 && (arr[i]->getOperation() == ServiceOperation::Authenticate))
 		{
 			return false;
@@ -987,17 +2074,56 @@ bool BrainCloudComms::ShouldRetryPacket()
 	return true;
 }
 
-double BrainCloudComms::GetRetryTimeoutSeconds(int16 retryAttempt)
+double BrainCloudComms::GetRetryTimeoutSeconds(PacketRef packet, int16 retryAttempt)
 {
-	if (!ShouldRetryPacket())
+	if (!ShouldRetryPacket(packet))
 	{
 		return _authenticationTimeout;
 	}
 
-	return _packetTimeouts[retryAttempt >= _packetTimeouts.Num() ? _packetTimeouts.Num() - 1 : retryAttempt];
+	double tableTimeout = _packetTimeouts[retryAttempt >= _packetTimeouts.Num() ? _packetTimeouts.Num() - 1 : retryAttempt];
+
+	const RttEstimate *estimate = _adaptiveTimeouts ? _rttEstimates.Find(_serverUrl) : nullptr;
+	if (estimate == nullptr)
+		return tableTimeout;
+
+	// RTO = SRTT + 4 * RTTVAR, doubled on each retry and never above the table
+	const double minTimeout = 2.0;
+	double timeout = FMath::Max(minTimeout, estimate->Srtt + 4.0 * estimate->RttVar);
+	timeout *= (double)(1 << FMath::Min((int32)retryAttempt, 8));
+	return FMath::Min(timeout, tableTimeout);
+}
+
+double BrainCloudComms::GetRetryWaitSeconds(InFlightPacketRef inFlight, double elapsedTime)
+{
+	if (!_adaptiveTimeouts)
+		return GetRetryTimeoutSeconds(inFlight->Packet, inFlight->RetryCount) - elapsedTime;
+
+	// decorrelated jitter, so clients cut off by the same server blip
+	// don't all come back at the same moment
+	const double baseWait = 0.25;
+	double cap = GetRetryTimeoutSeconds(inFlight->Packet, inFlight->RetryCount);
+	double previous = FMath::Max(inFlight->RetryBackoff, baseWait);
+	inFlight->RetryBackoff = FMath::Min(cap, (double)_retryRandom.FRandRange(baseWait, previous * 3.0));
+	return inFlight->RetryBackoff;
+}
+
+void BrainCloudComms::AddRttSample(double rtt)
+{
+	RttEstimate *estimate = _rttEstimates.Find(_serverUrl);
+	if (estimate == nullptr)
+	{
+		estimate = &_rttEstimates.Add(_serverUrl);
+		estimate->Srtt = rtt;
+		estimate->RttVar = rtt * 0.5;
+		return;
+	}
+
+	estimate->RttVar = 0.75 * estimate->RttVar + 0.25 * FMath::Abs(estimate->Srtt - rtt);
+	estimate->Srtt = 0.875 * estimate->Srtt + 0.125 * rtt;
 }
 
-int16 BrainCloudComms::GetMaxRetryAttempts()
+int16 BrainCloudComms::GetMaxRetryAttempts(PacketRef packet)
 {
-	return ShouldRetryPacket() ? (int16)_packetTimeouts.Num() - 1 : 0;
+	return ShouldRetryPacket(packet) ? (int16)_packetTimeouts.Num() - 1 : 0;
 }
\ No newline at end of file
@@ -2,20 +2,153 @@
 
 #pragma once
 
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeBool.h"
+#include "ServiceName.h"
+#include "ServiceOperation.h"
+#include "ServerCall.h"
+#include "BCSubmissionQueue.h"
+#include "BCCommsMetrics.h"
+#include "BCPacketCapture.h"
+#include "BCUploadScheduler.h"
+
 class IEventCallback;
 class IRewardCallback;
 class IFileUploadCallback;
 class IGlobalErrorCallback;
 class INetworkErrorCallback;
-class ServerCall;
 class BCFileUploader;
+class BCOfflineJournal;
 class BrainCloudClient;
 class UBCBlueprintRestCallProxyBase;
 
 class BrainCloudComms
 {
-	typedef TSharedRef<TArray<TSharedRef<ServerCall>>> PacketRef;
-	typedef TSharedPtr<TArray<TSharedRef<ServerCall>>> PacketPtr;
+	friend class FBrainCloudCommsBundleMarkerTest;
+	friend class FBrainCloudCommsRejectedSessionTest;
+	friend class FBrainCloudCommsWarmUpTest;
+	friend class FBrainCloudCommsSignatureBenchmark;
+
+	// thread safe as packets are handed between the network thread and the game thread
+	typedef TSharedRef<ServerCall, ESPMode::ThreadSafe> ServerCallRef;
+	typedef TSharedRef<TArray<ServerCallRef>, ESPMode::ThreadSafe> PacketRef;
+	typedef TSharedPtr<TArray<ServerCallRef>, ESPMode::ThreadSafe> PacketPtr;
+
+	/**
+	 * A bundle which has been handed to the http module and is waiting for
+	 * its response. Retry state is kept per packet so that several packets
+	 * can be outstanding at once.
+	 */
+	struct InFlightPacket
+	{
+		InFlightPacket(PacketRef packet, uint64 packetId) : Packet(packet), PacketId(packetId) {}
+
+		PacketRef Packet;
+		uint64 PacketId;
+		FHttpRequestPtr Request;
+		double SentTime = 0.0;
+		int32 RetryCount = 0;
+		bool WaitingForRetry = false;
+		double RetryWaitStart = -1.0;
+		double RetryWaitTime = -1.0;
+		// retries are exhausted, the error is reported once the packet reaches the front
+		bool HasFailed = false;
+		// last jittered retry wait, adaptive timeouts only
+		double RetryBackoff = 0.0;
+		bool RttSampled = false;
+	};
+
+	/**
+	 * Smoothed round trip time of a server url, kept the way tcp does
+	 * (RFC 6298) to derive retry timeouts when adaptive timeouts are on.
+	 */
+	struct RttEstimate
+	{
+		double Srtt = 0.0;
+		double RttVar = 0.0;
+	};
+	typedef TSharedRef<InFlightPacket> InFlightPacketRef;
+
+	/**
+	 * One response of a bundle, located in the raw body by the json scanner.
+	 * Callbacks are handed the original text of the response, only the calls
+	 * the comms layer itself inspects get a parsed object.
+	 */
+	struct ResponseSlice
+	{
+		int32 Start = 0;
+		int32 End = 0;
+		uint32 StatusCode = 0;
+		uint32 ReasonCode = 0;
+		bool HasReasonCode = false;
+		FString StatusMessage;
+		TSharedPtr<FJsonObject> Parsed;
+	};
+
+	/**
+	 * Outcome of a packet, produced by UpdateNetwork and reported to the app
+	 * from RunCallbacks. The response is scanned, and the session state it
+	 * carries applied, before it is queued.
+	 */
+	struct PacketResult
+	{
+		PacketPtr Packet;
+		FString ResponseBody;
+		TArray<ResponseSlice> Responses;
+		int32 EventsStart = INDEX_NONE;
+		int32 EventsEnd = INDEX_NONE;
+		bool IsError = false;
+		uint32 StatusCode = 0;
+		uint32 ReasonCode = 0;
+		FString StatusMessage;
+		// message caching kicked in, the network error callback must be told
+		bool IsNetworkError = false;
+		// a resumed session was turned down, authenticate again before sending more
+		bool IsSessionRejected = false;
+		// the authentication a resumed session stands in for, ResponseBody is its answer
+		IServerCallback *ResumedCallback = nullptr;
+		// the session as this response left it, _sessionId belongs to the network thread
+		FString SessionId;
+		double ReceivedTime = 0.0;
+	};
+	typedef TSharedPtr<PacketResult, ESPMode::ThreadSafe> PacketResultPtr;
+
+	struct DurableOperation
+	{
+		ServiceName Service;
+		ServiceOperation Operation;
+	};
+
+	/**
+	 * A recorded warm up call, only what goes on the wire. The callback of the
+	 * call it was recorded from may be gone by the next authentication.
+	 */
+	struct WarmUpCall
+	{
+		ServiceName Service;
+		ServiceOperation Operation;
+		TArray<uint8> Payload;
+	};
+
+	struct ServicePriority
+	{
+		ServiceName Service;
+		eBCCallPriority Priority;
+	};
+
+	/**
+	 * A packet sent while replaying a capture, answered with the recorded
+	 * response once its recorded round trip has passed.
+	 */
+	struct ReplayedPacket
+	{
+		PacketRef Packet;
+		double DueTime;
+		int32 StatusCode;
+		FString ResponseBody;
+	};
+
+	static const int32 NumPriorityLanes = 3;
 
   public:
 	BrainCloudComms(BrainCloudClient *client);
@@ -27,9 +160,11 @@ class BrainCloudComms
 	bool IsLoggingEnabled() { return _isLoggingEnabled; };
 
 	void AddToQueue(ServerCall *);
-	void ClearSessionId() { _sessionId.Empty(); }
+	void ClearSessionId();
 	void ResetCommunication();
 	void RunCallbacks();
+	void UpdateNetwork();
+	void SetThreaded(bool isThreaded) { _isThreaded = isThreaded; }
 	void Heartbeat();
 	void InsertEndOfMessageBundleMarker();
 
@@ -54,7 +189,7 @@ class BrainCloudComms
 	void DeregisterGlobalErrorCallback();
 
 	//Network error callback
-	void RegisterNetworkErrorCallback(INetworkErrorCallback *networkErrorCallback) { _networkErrorCallback = networkErrorCallback; }
+	void RegisterNetworkErrorCallback(INetworkErrorCallback *networkErrorCallback);
 	void RegisterNetworkErrorCallback(UBCBlueprintRestCallProxyBase *callback);
 	void DeregisterNetworkErrorCallback();
 
@@ -69,12 +204,18 @@ class BrainCloudComms
 	int32 GetUploadLowTransferRateTimeout() { return _uploadLowTransferRateTimeout; }
 	int32 GetUploadLowTransferRateThreshold() { return _uploadLowTransferRateThreshold; }
 	int32 GetUploadOverallTimeout() { return _uploadOverallTimeout; }
+	int32 GetMaxPacketsInFlight() { return _maxPacketsInFlight; }
+	int32 GetSessionExpirySeconds() { return _sessionExpirySeconds; }
+	/** When the given session expires if it sees no more traffic, FDateTime::MinValue() once it is no longer the current session */
+	FDateTime GetSessionExpiresAt(const FString &sessionId);
+	int32 GetMaxBundleMessages() { return _maxBundleMessages; }
+	int32 GetKillSwitchThreshold() { return _killSwitchThreshold; }
 
 	//Setters
 	void SetServerUrl(const FString &serverUrl) { _serverUrl = serverUrl; }
-	void SetSessionId(const FString &sessionId) { _sessionId = sessionId; }
+	void SetSessionId(const FString &sessionId);
 	void SetHeartbeatInterval(int32 heartbeatInterval) { _heartbeatInterval = heartbeatInterval; }
-	void SetPacketTimeouts(const TArray<int32> &packetTimeouts) { _packetTimeouts = packetTimeouts; }
+	void SetPacketTimeouts(const TArray<int32> &packetTimeouts);
 	void SetPacketTimeoutsToDefault();
 	void SetAuthenticationPacketTimeout(int32 timeoutSecs) { _authenticationTimeout = timeoutSecs; }
 	void SetOldStyleStatusMessageErrorCallback(bool useOldStatusMessage) { _useOldStatusMessage = useOldStatusMessage; }
@@ -82,7 +223,18 @@ class BrainCloudComms
 	void SetUploadLowTransferRateTimeout(int32 timeoutSecs) { _uploadLowTransferRateTimeout = timeoutSecs; }
 	void SetUploadLowTransferRateThreshold(int32 bytesPerSec) { _uploadLowTransferRateThreshold = bytesPerSec; }
 	void SetUploadOverallTimeout(int32 seconds) { _uploadOverallTimeout = seconds; }
+	void SetMaxConcurrentUploads(int32 maxUploads) { _uploadScheduler.SetMaxConcurrentUploads(maxUploads); }
+	void SetUploadMaxBytesPerSecond(int32 bytesPerSec) { _uploadScheduler.SetMaxBytesPerSecond(bytesPerSec); }
+	void SetUploadMaxRetries(int32 maxRetries) { _uploadScheduler.SetMaxRetries(maxRetries); }
 	void SetAuthenticated() { _isAuthenticated = true; }
+	void ResumeSession(const FString &sessionId, int32 sessionExpirySeconds, int32 maxBundleMessages, int32 killSwitchThreshold, IServerCallback *reauthenticateCallback,
+					   IServerCallback *callback, const FString &authenticateResponse);
+	void EnableAdaptiveTimeouts(bool enabled) { _adaptiveTimeouts = enabled; }
+	void SetMaxPacketsInFlight(int32 maxPacketsInFlight) { _maxPacketsInFlight = maxPacketsInFlight < 1 ? 1 : maxPacketsInFlight; }
+	void SetBundleWindow(float seconds, int32 frames) { _bundleWindowSeconds = seconds; _bundleWindowFrames = frames; }
+	void SetMaxBundleBytes(int32 maxBundleBytes) { _maxBundleBytes = maxBundleBytes; }
+	void SetServicePriority(ServiceName service, eBCCallPriority priority);
+	void SetBackgroundMaxAge(float seconds) { _backgroundMaxAge = seconds; }
 
 	//File upload
 	void CancelUpload(const FString &fileUploadId);
@@ -95,27 +247,98 @@ class BrainCloudComms
 	void RetryCachedMessages();
 	void FlushCachedMessages(bool sendApiErrorCallbacks);
 
+	//offline journal
+	void EnableOfflineJournal(bool enabled);
+	void AddDurableOperation(ServiceName service, ServiceOperation operation);
+	void SetOfflineJournalMaxSize(int32 maxBytes);
+
+	//metrics
+	void EnableMetrics(bool enabled) { _metrics.SetEnabled(enabled); }
+	BCCommsMetrics &GetMetrics() { return _metrics; }
+
+	//capture and replay
+	bool StartPacketCapture(const FString &path);
+	void StopPacketCapture();
+	bool StartPacketReplay(const FString &path, float speed);
+	void StopPacketReplay();
+
+	//warm up
+	void BeginWarmUpCalls(bool cacheResponses);
+	void EndWarmUpCalls();
+	void ClearWarmUpCalls();
+	FString GetWarmUpResponse(ServiceName service, ServiceOperation operation);
+	void RegisterWarmUpCallback(IServerCallback *callback) { _warmUpCallback = callback; }
+	void DeregisterWarmUpCallback() { _warmUpCallback = nullptr; }
+
   private:
-	void CreateAndSendNextRequestBundle();
+	bool CreateAndSendNextRequestBundle();
+	bool CanSendNextRequestBundle();
+	bool IsAuthenticationBundleNext();
+	bool IsBundleReady();
+	void RestartBundleWindow();
+	int32 GetQueuedCount();
+	uint64 GetBundleMarkerLimit();
+	void DrainSubmissions();
+	bool IsBackgroundOverdue();
+	void AssignPriority(ServerCall &servercall);
 	PacketRef BuildPacket();
-	PacketRef BuildPacket(TSharedRef<ServerCall> sc);
-	#if ENGINE_MINOR_VERSION > 25
-	TSharedRef<IHttpRequest,ESPMode::ThreadSafe> SendPacket(PacketRef packet);
-	#else
-	TSharedRef<IHttpRequest> SendPacket(PacketRef packet);
-	#endif
-	void ResendActivePacket();
-	void FilterIncomingMessages(TSharedRef<ServerCall> servercall, TSharedRef<FJsonObject> response);
-
-	bool ShouldRetryPacket();
-	double GetRetryTimeoutSeconds(int16 retry);
-	int16 GetMaxRetryAttempts();
-
-	FString GetDataString(PacketRef packet, uint64 packetId);
+	PacketRef BuildPacket(ServerCallRef sc);
+	void SendPacket(PacketRef packet);
+	void ResendPacket(InFlightPacketRef inFlight);
+	void UpdateInFlightPackets();
+	void ProcessCompletedPackets();
+	void FilterIncomingMessages(ServerCallRef servercall, TSharedRef<FJsonObject> response, const FString &sessionId);
+	bool ScanResponseBundle(PacketRef requestPacket, PacketResult &result);
+	bool NeedsParsedResponse(ServerCallRef servercall, uint32 statusCode);
+	void UpdateSessionState(PacketRef requestPacket, const PacketResult &result);
+	void UpdateSessionState(ServerCallRef servercall, TSharedRef<FJsonObject> response);
+	void DispatchResults();
+	void QueueError(PacketRef requestPacket, uint32 statusCode, uint32 reasonCode, const FString &statusMessage);
+	INetworkErrorCallback *GetNetworkErrorCallback();
+
+	bool ShouldRetryPacket(PacketRef packet);
+	double GetRetryTimeoutSeconds(PacketRef packet, int16 retry);
+	double GetRetryWaitSeconds(InFlightPacketRef inFlight, double elapsedTime);
+	void AddRttSample(double rtt);
+	int16 GetMaxRetryAttempts(PacketRef packet);
+
+	void WriteRequestBody(PacketRef packet, uint64 packetId, TArray<uint8> &body);
+	// touches no comms state so it may run on any thread
+	static FString GetSignature(const TArray<uint8> &body, const TArray<uint8> &secret);
+	void SetSecretKey(const FString &secretKey);
+	FString BodyToString(const TArray<uint8> &body);
 	void ReportError(PacketRef requestPacket, uint32 statusCode, uint32 reasonCode, const FString statusMessage);
-	void ReportResults(PacketRef requestPacket, TSharedRef<FJsonObject> jsonPacket);
+	void ReportResults(PacketRef requestPacket, const PacketResult &result);
 
 	void ResetErrorCache();
+
+	//offline journal
+	void OpenOfflineJournal();
+	bool IsDurable(const ServerCall &servercall);
+	void JournalServerCall(ServerCall &servercall);
+	void AcknowledgeJournal(PacketRef packet);
+	void ReplayJournal(const FString &profileId);
+
+	//metrics
+	void RecordPacketSent(PacketRef packet);
+	void RecordPacketRetry(PacketRef packet);
+	void RecordPacketResponses(PacketRef packet, const PacketResult &result);
+	void RecordPacketCallbacks(const PacketResult &result);
+
+	//capture and replay
+	void CaptureExchange(InFlightPacketRef inFlight, int32 statusCode, const FString &responseBody);
+	void ReplayPacket(PacketRef packet);
+	void ProcessReplayedPackets();
+
+	//session resume
+	bool IsSessionRejected(const PacketResult &result);
+	void RejectResumedSession(PacketRef packet);
+	void RequeueRejectedCalls();
+
+	//warm up
+	void AppendWarmUpCalls(PacketRef packet);
+	void CacheWarmUpResponse(ServerCallRef servercall, const FString &response);
+
 	void FakeErrorResponse(uint32 statusCode, uint32 reasonCode, const FString statusMessage);
 
 	//kill switch
@@ -132,14 +355,27 @@ class BrainCloudComms
 	FString _statusMessageCache;
 
 	bool _isLoggingEnabled = false;
-	bool _isAuthenticated = false;
+	// written by the network thread, read by the game thread
+	FThreadSafeBool _isAuthenticated;
 	bool _isInitialized = false;
 
+	// a session saved by an earlier run, trusted until its first response
+	bool _isResumedSession = false;
+	bool _isReauthenticating = false;
+	IServerCallback *_resumeCallback = nullptr;
+	// the rejected bundle, held under _queueMutex until the new authentication is queued
+	TArray<ServerCallRef> _rejectedCalls;
+	int32 _sessionExpirySeconds = 0;
+	// pushed back by every successful response
+	FDateTime _sessionExpiresAt = FDateTime::MinValue();
+
 	int32 _bundleId = 0;
 	FString _sessionId;
 
 	FString _serverUrl;
 	FString _secretKey;
+	// _secretKey as utf8, what the signature is computed over
+	TArray<uint8> _secretKeyUtf8;
 	TMap<FString, FString> _secretMap;
 	FString _appId;
 	FString _uploadUrl;
@@ -155,9 +391,20 @@ class BrainCloudComms
 
 	int32 _heartbeatInterval = 0;
 	float _idleTime = 0.0;
-	int32 _retryCount = 0;
 	TArray<int32> _packetTimeouts;
 	int32 _maxBundleMessages = 10;
+
+	// adaptive timeouts, the _packetTimeouts table stays the upper bound
+	bool _adaptiveTimeouts = false;
+	TMap<FString, RttEstimate> _rttEstimates;
+	FRandomStream _retryRandom;
+
+	// optional coalescing of calls made over several frames, the window start is guarded by _queueMutex
+	float _bundleWindowSeconds = 0.0f;
+	int32 _bundleWindowFrames = 0;
+	int32 _maxBundleBytes = 0;
+	double _bundleWindowStartTime = 0.0;
+	uint64 _bundleWindowStartFrame = 0;
 	int32 _authenticationTimeout = 15;
 	bool _useOldStatusMessage = false;
 	bool _errorCallbackOn202 = true;
@@ -166,23 +413,65 @@ class BrainCloudComms
 	int32 _uploadLowTransferRateThreshold = 50;
 	int32 _uploadOverallTimeout = 120;
 
-	TDoubleLinkedList<TSharedRef<ServerCall>> _messageQueue;
-	TArray<TSharedRef<BCFileUploader>> _fileUploads;
+	// calls handed to AddToQueue which are not in a lane yet
+	BCSubmissionQueue _submissions;
+
+	// one lane per eBCCallPriority, newest at the head, guarded by _queueMutex
+	TDoubleLinkedList<ServerCallRef> _messageQueues[NumPriorityLanes];
+	uint64 _queueSequence = 0;
+	// end of bundle markers, each the queue sequence of the last call before it, oldest first
+	TArray<uint64> _bundleMarkers;
+	TArray<ServicePriority> _servicePriorities;
+	// background calls older than this are bundled ahead of interactive ones
+	float _backgroundMaxAge = 5.0f;
+	BCUploadScheduler _uploadScheduler;
 
 	//New!
-	void HandleResponse(int32 statusCode, FString responseBody);
+	void HandleResponse(PacketRef requestPacket, int32 statusCode, const FString &responseBody);
 
 	FCriticalSection _queueMutex;
 	double _requestSentTime = 0.0;
-	bool _waitingForRetry = false;
-	double _retryWaitStart = -1.0;
-	double _retryWaitTime = -1.0;
-	FHttpRequestPtr _activeRequest;
-	PacketPtr _currentPacket;
+
+	// held by UpdateNetwork, guards the in flight packets and session state
+	FCriticalSection _networkMutex;
+	bool _isThreaded = false;
+	TQueue<PacketResultPtr, EQueueMode::Spsc> _results;
+
+	// reused for every bundle, only ever touched under _networkMutex
+	TArray<uint8> _requestBody;
+
+	// packets waiting on a response, ordered by packetId
+	TArray<InFlightPacketRef> _inFlightPackets;
+	int32 _maxPacketsInFlight = 1;
 
 	//caching
 	bool _cacheMessagesOnNetworkError = false;
-	bool _blockingQueue = false;
+	// set by the network thread, read by the game thread in RunCallbacks
+	FThreadSafeBool _blockingQueue;
+
+	//offline journal, created, destroyed and used under _networkMutex
+	FThreadSafeBool _offlineJournalEnabled;
+	int32 _offlineJournalMaxBytes = 1024 * 1024;
+	BCOfflineJournal *_journal = nullptr;
+	TArray<DurableOperation> _durableOperations;
+
+	BCCommsMetrics _metrics;
+
+	//capture and replay, guarded by _networkMutex
+	BCPacketCapture *_capture = nullptr;
+	bool _isReplaying = false;
+	float _replaySpeed = 1.0f;
+	TArray<BCPacketCapture::Exchange> _replayExchanges;
+	int32 _replayIndex = 0;
+	TArray<ReplayedPacket> _replayedPackets;
+
+	//warm up, the recording is guarded by _networkMutex, the callback and cache are game thread only
+	FThreadSafeBool _isRecordingWarmUp;
+	uint32 _warmUpThreadId = 0;
+	bool _cacheWarmUpResponses = false;
+	TArray<WarmUpCall> _warmUpCalls;
+	IServerCallback *_warmUpCallback = nullptr;
+	TMap<FString, FString> _warmUpResponses;
 
 	//For kill switch
 	int32 _killSwitchThreshold = 11;
@@ -13,11 +13,11 @@ BrainCloudCustomEntity::BrainCloudCustomEntity(BrainCloudClient *client) : _clie
 void BrainCloudCustomEntity::createEntity(const FString &entityType, const FString &jsonEntityData, IAcl *jsonEntityAcl, int64 timeToLive, bool isOwned, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::CustomEntityServiceJsonEntityData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
-    message->SetObjectField(OperationParam::CustomEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
-    message->SetNumberField(OperationParam::CustomEntityServiceTimeToLive.getValue(), timeToLive);
-    message->SetBoolField(OperationParam::CustomEntityServiceIsOwned.getValue(), isOwned);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::CustomEntityServiceJsonEntityData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetObjectField(OperationParam::CustomEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
+    message->SetNumberField(OperationParam::CustomEntityServiceTimeToLive.getKey(), timeToLive);
+    message->SetBoolField(OperationParam::CustomEntityServiceIsOwned.getKey(), isOwned);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::CreateEntity, message, callback);
     _client->sendRequest(sc);
@@ -26,9 +26,9 @@ void BrainCloudCustomEntity::createEntity(const FString &entityType, const FStri
 void BrainCloudCustomEntity::deleteEntity(const FString &entityType, const FString &entityId, int version, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getValue(), version);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getKey(), version);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::DeleteEntity, message, callback);
     _client->sendRequest(sc);
@@ -37,8 +37,8 @@ void BrainCloudCustomEntity::deleteEntity(const FString &entityType, const FStri
 void BrainCloudCustomEntity::getCount(const FString &entityType, const FString &whereJson, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::CustomEntityServiceWhereJson.getValue(), JsonUtil::jsonStringToValue(whereJson));
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::CustomEntityServiceWhereJson.getKey(), JsonUtil::jsonStringToValue(whereJson));
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::GetCount, message, callback);
     _client->sendRequest(sc);
@@ -47,8 +47,8 @@ void BrainCloudCustomEntity::getCount(const FString &entityType, const FString &
 void BrainCloudCustomEntity::getEntityPage(const FString &entityType, const FString &context, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::CustomEntityServiceContext.getValue(), JsonUtil::jsonStringToValue(context));
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::CustomEntityServiceContext.getKey(), JsonUtil::jsonStringToValue(context));
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::CustomEntityGetEntityPage, message, callback);
     _client->sendRequest(sc);
@@ -57,9 +57,9 @@ void BrainCloudCustomEntity::getEntityPage(const FString &entityType, const FStr
 void BrainCloudCustomEntity::getEntityPageOffset(const FString &entityType, const FString &context, int pageOffset, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetStringField(OperationParam::CustomEntityServiceContext.getValue(), context);
-    message->SetNumberField(OperationParam::CustomEntityServicePageOffset.getValue(), pageOffset);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetStringField(OperationParam::CustomEntityServiceContext.getKey(), context);
+    message->SetNumberField(OperationParam::CustomEntityServicePageOffset.getKey(), pageOffset);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::CustomEntityGetEntityPageOffset, message, callback);
     _client->sendRequest(sc);
@@ -68,8 +68,8 @@ void BrainCloudCustomEntity::getEntityPageOffset(const FString &entityType, cons
 void BrainCloudCustomEntity::readEntity(const FString &entityType, const FString &entityId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getValue(), entityId);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getKey(), entityId);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::ReadEntity, message, callback);
     _client->sendRequest(sc);
@@ -78,9 +78,9 @@ void BrainCloudCustomEntity::readEntity(const FString &entityType, const FString
 void BrainCloudCustomEntity::incrementData(const FString &entityType, const FString &entityId, const FString &fieldsJson, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getValue(), entityId);
-    message->SetObjectField(OperationParam::CustomEntityServiceFieldsJson.getValue(), JsonUtil::jsonStringToValue(fieldsJson));
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getKey(), entityId);
+    message->SetObjectField(OperationParam::CustomEntityServiceFieldsJson.getKey(), JsonUtil::jsonStringToValue(fieldsJson));
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::IncrementData, message, callback);
     _client->sendRequest(sc);
@@ -89,9 +89,9 @@ void BrainCloudCustomEntity::incrementData(const FString &entityType, const FStr
 void BrainCloudCustomEntity::getRandomEntitiesMatching(const FString &entityType, const FString &whereJson, const int64 &maxReturn, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::CustomEntityServiceWhereJson.getValue(), JsonUtil::jsonStringToValue(whereJson));
-    message->SetNumberField(OperationParam::CustomEntityServiceMaxReturn.getValue(), maxReturn);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::CustomEntityServiceWhereJson.getKey(), JsonUtil::jsonStringToValue(whereJson));
+    message->SetNumberField(OperationParam::CustomEntityServiceMaxReturn.getKey(), maxReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::GetRandomEntitiesMatching, message, callback);
     _client->sendRequest(sc);
@@ -100,12 +100,12 @@ void BrainCloudCustomEntity::getRandomEntitiesMatching(const FString &entityType
 void BrainCloudCustomEntity::updateEntity(const FString &entityType, const FString &entityId, int version, const FString &dataJson, IAcl *jsonEntityAcl, int64 timeToLive, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getValue(), version);
-    message->SetObjectField(OperationParam::CustomEntityServiceDataJson.getValue(), JsonUtil::jsonStringToValue(dataJson));
-    message->SetObjectField(OperationParam::CustomEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
-    message->SetNumberField(OperationParam::CustomEntityServiceTimeToLive.getValue(), timeToLive);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getKey(), version);
+    message->SetObjectField(OperationParam::CustomEntityServiceDataJson.getKey(), JsonUtil::jsonStringToValue(dataJson));
+    message->SetObjectField(OperationParam::CustomEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
+    message->SetNumberField(OperationParam::CustomEntityServiceTimeToLive.getKey(), timeToLive);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::UpdateEntity, message, callback);
     _client->sendRequest(sc);
@@ -114,10 +114,10 @@ void BrainCloudCustomEntity::updateEntity(const FString &entityType, const FStri
 void BrainCloudCustomEntity::updateEntityFields(const FString &entityType, const FString &entityId, int version, const FString &fieldsJson, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getValue(), version);
-    message->SetObjectField(OperationParam::CustomEntityServiceFieldsJson.getValue(), JsonUtil::jsonStringToValue(fieldsJson));
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getKey(), version);
+    message->SetObjectField(OperationParam::CustomEntityServiceFieldsJson.getKey(), JsonUtil::jsonStringToValue(fieldsJson));
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::UpdateEntityFields, message, callback);
     _client->sendRequest(sc);
@@ -126,8 +126,8 @@ void BrainCloudCustomEntity::updateEntityFields(const FString &entityType, const
 void BrainCloudCustomEntity::deleteEntities(const FString &entityType, const FString &deleteCriteria, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::CustomEntityServiceDeleteCriteria.getValue(), JsonUtil::jsonStringToValue(deleteCriteria));
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::CustomEntityServiceDeleteCriteria.getKey(), JsonUtil::jsonStringToValue(deleteCriteria));
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::DeleteEntities, message, callback);
     _client->sendRequest(sc);
@@ -136,7 +136,7 @@ void BrainCloudCustomEntity::deleteEntities(const FString &entityType, const FSt
 void BrainCloudCustomEntity::readSingleton(const FString &entityType, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::ReadSingleton, message, callback);
     _client->sendRequest(sc);
@@ -145,8 +145,8 @@ void BrainCloudCustomEntity::readSingleton(const FString &entityType, IServerCal
 void BrainCloudCustomEntity::deleteSingleton(const FString &entityType, int version, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getValue(), version);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetNumberField(OperationParam::CustomEntityServiceVersion.getKey(), version);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::DeleteSingleton, message, callback);
     _client->sendRequest(sc);
@@ -155,11 +155,11 @@ void BrainCloudCustomEntity::deleteSingleton(const FString &entityType, int vers
 void BrainCloudCustomEntity::updateSingleton(const FString &entityType, int version, const FString &dataJson,  IAcl *jsonEntityAcl, int64 timeToLive, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetNumberField(OperationParam::CustomEntityServiceEntityId.getValue(), version);
-    message->SetObjectField(OperationParam::CustomEntityServiceDataJson.getValue(), JsonUtil::jsonStringToValue(dataJson));
-    message->SetObjectField(OperationParam::CustomEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
-    message->SetNumberField(OperationParam::CustomEntityServiceTimeToLive.getValue(), timeToLive);
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetNumberField(OperationParam::CustomEntityServiceEntityId.getKey(), version);
+    message->SetObjectField(OperationParam::CustomEntityServiceDataJson.getKey(), JsonUtil::jsonStringToValue(dataJson));
+    message->SetObjectField(OperationParam::CustomEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
+    message->SetNumberField(OperationParam::CustomEntityServiceTimeToLive.getKey(), timeToLive);
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::UpdateSingleton, message, callback);
     _client->sendRequest(sc);
@@ -168,9 +168,9 @@ void BrainCloudCustomEntity::updateSingleton(const FString &entityType, int vers
 void BrainCloudCustomEntity::updateSingletonFields(const FString &entityType, int version, const FString &fieldsJson, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getValue(), entityType);
-    message->SetNumberField(OperationParam::CustomEntityServiceEntityId.getValue(), version);
-    message->SetObjectField(OperationParam::CustomEntityServiceFieldsJson.getValue(), JsonUtil::jsonStringToValue(fieldsJson));
+    message->SetStringField(OperationParam::CustomEntityServiceEntityType.getKey(), entityType);
+    message->SetNumberField(OperationParam::CustomEntityServiceEntityId.getKey(), version);
+    message->SetObjectField(OperationParam::CustomEntityServiceFieldsJson.getKey(), JsonUtil::jsonStringToValue(fieldsJson));
 
     ServerCall *sc = new ServerCall(ServiceName::CustomEntity, ServiceOperation::UpdateSingletonFields, message, callback);
     _client->sendRequest(sc);
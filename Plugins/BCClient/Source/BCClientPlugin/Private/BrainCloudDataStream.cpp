@@ -12,11 +12,11 @@ BrainCloudDataStream::BrainCloudDataStream(BrainCloudClient *client) : _client(c
 void BrainCloudDataStream::customPageEvent(const FString &eventName, const FString &jsonEventProperties, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::DataStreamEventName.getValue(), eventName);
+    message->SetStringField(OperationParam::DataStreamEventName.getKey(), eventName);
 
     if (OperationParam::isOptionalParamValid(jsonEventProperties))
     {
-        message->SetObjectField(OperationParam::DataStreamEventProperties.getValue(), JsonUtil::jsonStringToValue(jsonEventProperties));
+        message->SetObjectField(OperationParam::DataStreamEventProperties.getKey(), JsonUtil::jsonStringToValue(jsonEventProperties));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::DataStream, ServiceOperation::CustomPageEvent, message, callback);
@@ -26,11 +26,11 @@ void BrainCloudDataStream::customPageEvent(const FString &eventName, const FStri
 void BrainCloudDataStream::customScreenEvent(const FString &eventName, const FString &jsonEventProperties, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::DataStreamEventName.getValue(), eventName);
+    message->SetStringField(OperationParam::DataStreamEventName.getKey(), eventName);
 
     if (OperationParam::isOptionalParamValid(jsonEventProperties))
     {
-        message->SetObjectField(OperationParam::DataStreamEventProperties.getValue(), JsonUtil::jsonStringToValue(jsonEventProperties));
+        message->SetObjectField(OperationParam::DataStreamEventProperties.getKey(), JsonUtil::jsonStringToValue(jsonEventProperties));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::DataStream, ServiceOperation::CustomScreenEvent, message, callback);
@@ -40,11 +40,11 @@ void BrainCloudDataStream::customScreenEvent(const FString &eventName, const FSt
 void BrainCloudDataStream::customTrackEvent(const FString &eventName, const FString &jsonEventProperties, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::DataStreamEventName.getValue(), eventName);
+    message->SetStringField(OperationParam::DataStreamEventName.getKey(), eventName);
 
     if (OperationParam::isOptionalParamValid(jsonEventProperties))
     {
-        message->SetObjectField(OperationParam::DataStreamEventProperties.getValue(), JsonUtil::jsonStringToValue(jsonEventProperties));
+        message->SetObjectField(OperationParam::DataStreamEventProperties.getKey(), JsonUtil::jsonStringToValue(jsonEventProperties));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::DataStream, ServiceOperation::CustomTrackEvent, message, callback);
@@ -54,14 +54,14 @@ void BrainCloudDataStream::customTrackEvent(const FString &eventName, const FStr
   void BrainCloudDataStream::submitCrashReport(const FString &crashType, const FString &errorMsg, const FString &crashJson, const FString &crashLog, const FString &userName, const FString &userEmail, const FString &userNotes, bool userSubmitted, IServerCallback *callback)
   {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::DataStreamCrashType.getValue(), crashType);
-    message->SetStringField(OperationParam::DataStreamErrorMsg.getValue(), errorMsg);
-    message->SetObjectField(OperationParam::DataStreamCrashJson.getValue(), JsonUtil::jsonStringToValue(crashJson));
-    message->SetStringField(OperationParam::DataStreamCrashLog.getValue(), crashLog);
-    message->SetStringField(OperationParam::DataStreamUserName.getValue(), userName);
-    message->SetStringField(OperationParam::DataStreamUserEmail.getValue(), userEmail);
-    message->SetStringField(OperationParam::DataStreamUserNotes.getValue(), userNotes);
-    message->SetBoolField(OperationParam::DataStreamUserSubmitted.getValue(), userSubmitted);
+    message->SetStringField(OperationParam::DataStreamCrashType.getKey(), crashType);
+    message->SetStringField(OperationParam::DataStreamErrorMsg.getKey(), errorMsg);
+    message->SetObjectField(OperationParam::DataStreamCrashJson.getKey(), JsonUtil::jsonStringToValue(crashJson));
+    message->SetStringField(OperationParam::DataStreamCrashLog.getKey(), crashLog);
+    message->SetStringField(OperationParam::DataStreamUserName.getKey(), userName);
+    message->SetStringField(OperationParam::DataStreamUserEmail.getKey(), userEmail);
+    message->SetStringField(OperationParam::DataStreamUserNotes.getKey(), userNotes);
+    message->SetBoolField(OperationParam::DataStreamUserSubmitted.getKey(), userSubmitted);
       
     ServerCall *sc = new ServerCall(ServiceName::DataStream, ServiceOperation::SubmitCrashReport, message, callback);
     _client->sendRequest(sc);
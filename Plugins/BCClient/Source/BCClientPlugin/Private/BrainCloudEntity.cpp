@@ -13,7 +13,7 @@ BrainCloudEntity::BrainCloudEntity(BrainCloudClient *client) : _client(client){}
 void BrainCloudEntity::getEntity(const FString &entityId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityId.getValue(), entityId);
+    message->SetStringField(OperationParam::EntityServiceEntityId.getKey(), entityId);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::Read, message, callback);
     _client->sendRequest(sc);
@@ -22,7 +22,7 @@ void BrainCloudEntity::getEntity(const FString &entityId, IServerCallback *callb
 void BrainCloudEntity::getSingleton(const FString &entityType, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityType.getValue(), entityType);
+    message->SetStringField(OperationParam::EntityServiceEntityType.getKey(), entityType);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::ReadSingleton, message, callback);
     _client->sendRequest(sc);
@@ -31,9 +31,9 @@ void BrainCloudEntity::getSingleton(const FString &entityType, IServerCallback *
 void BrainCloudEntity::createEntity(const FString &entityType, const FString &jsonEntityData, IAcl *jsonEntityAcl, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::EntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
-    message->SetObjectField(OperationParam::EntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
+    message->SetStringField(OperationParam::EntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::EntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetObjectField(OperationParam::EntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::Create, message, callback);
     _client->sendRequest(sc);
@@ -42,7 +42,7 @@ void BrainCloudEntity::createEntity(const FString &entityType, const FString &js
 void BrainCloudEntity::getEntitiesByType(const FString &entityType, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityType.getValue(), entityType);
+    message->SetStringField(OperationParam::EntityServiceEntityType.getKey(), entityType);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::ReadByType, message, callback);
     _client->sendRequest(sc);
@@ -51,10 +51,10 @@ void BrainCloudEntity::getEntitiesByType(const FString &entityType, IServerCallb
 void BrainCloudEntity::updateEntity(const FString &entityId, const FString &entityType, const FString &jsonEntityData, IAcl *jsonEntityAcl, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityId.getValue(), entityId);
-    message->SetStringField(OperationParam::EntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::EntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
-    message->SetObjectField(OperationParam::EntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
+    message->SetStringField(OperationParam::EntityServiceEntityId.getKey(), entityId);
+    message->SetStringField(OperationParam::EntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::EntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetObjectField(OperationParam::EntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::Update, message, callback);
     _client->sendRequest(sc);
@@ -63,8 +63,8 @@ void BrainCloudEntity::updateEntity(const FString &entityId, const FString &enti
 void BrainCloudEntity::updateSingleton(const FString &entityType, const FString &jsonEntityData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::EntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetStringField(OperationParam::EntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::EntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::UpdateSingleton, message, callback);
     _client->sendRequest(sc);
@@ -73,7 +73,7 @@ void BrainCloudEntity::updateSingleton(const FString &entityType, const FString
 void BrainCloudEntity::deleteEntity(const FString &entityId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityId.getValue(), entityId);
+    message->SetStringField(OperationParam::EntityServiceEntityId.getKey(), entityId);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::Delete, message, callback);
     _client->sendRequest(sc);
@@ -82,7 +82,7 @@ void BrainCloudEntity::deleteEntity(const FString &entityId, IServerCallback *ca
 void BrainCloudEntity::deleteSingleton(const FString &entityType, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityType.getValue(), entityType);
+    message->SetStringField(OperationParam::EntityServiceEntityType.getKey(), entityType);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::DeleteSingleton, message, callback);
     _client->sendRequest(sc);
@@ -91,8 +91,8 @@ void BrainCloudEntity::deleteSingleton(const FString &entityType, IServerCallbac
 void BrainCloudEntity::getSharedEntityForProfileId(const FString &profileId, const FString &entityId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getValue(), profileId);
-    message->SetStringField(OperationParam::EntityServiceEntityId.getValue(), entityId);
+    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getKey(), profileId);
+    message->SetStringField(OperationParam::EntityServiceEntityId.getKey(), entityId);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::ReadSharedEntity, message, callback);
     _client->sendRequest(sc);
@@ -101,7 +101,7 @@ void BrainCloudEntity::getSharedEntityForProfileId(const FString &profileId, con
 void BrainCloudEntity::getSharedEntitiesForProfileId(const FString &profileId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getValue(), profileId);
+    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getKey(), profileId);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::ReadShared, message, callback);
     _client->sendRequest(sc);
@@ -111,14 +111,14 @@ void BrainCloudEntity::getSharedEntitiesListForProfileId(const FString &profileI
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getValue(), profileId);
+    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getKey(), profileId);
     if (OperationParam::isOptionalParamValid(whereJson))
-        message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getValue(), JsonUtil::jsonStringToValue(whereJson));
+        message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getKey(), JsonUtil::jsonStringToValue(whereJson));
 
     if (OperationParam::isOptionalParamValid(orderByJson))
-        message->SetObjectField(OperationParam::GlobalEntityServiceOrderBy.getValue(), JsonUtil::jsonStringToValue(orderByJson));
+        message->SetObjectField(OperationParam::GlobalEntityServiceOrderBy.getKey(), JsonUtil::jsonStringToValue(orderByJson));
 
-    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getValue(), maxReturn);
+    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getKey(), maxReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::ReadSharedEntitesList, message, callback);
     _client->sendRequest(sc);
@@ -127,10 +127,10 @@ void BrainCloudEntity::getSharedEntitiesListForProfileId(const FString &profileI
 void BrainCloudEntity::updateSharedEntity(const FString &entityId, const FString &targetProfileId, const FString &entityType, const FString &jsonEntityData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityId.getValue(), entityId);
-    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getValue(), targetProfileId);
-    message->SetStringField(OperationParam::EntityServiceEntityType.getValue(), entityType);
-    message->SetObjectField(OperationParam::EntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetStringField(OperationParam::EntityServiceEntityId.getKey(), entityId);
+    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getKey(), targetProfileId);
+    message->SetStringField(OperationParam::EntityServiceEntityType.getKey(), entityType);
+    message->SetObjectField(OperationParam::EntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::UpdateShared, message, callback);
     _client->sendRequest(sc);
@@ -141,12 +141,12 @@ void BrainCloudEntity::getList(const FString &whereJson, const FString &orderByJ
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
     if (OperationParam::isOptionalParamValid(whereJson))
-        message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getValue(), JsonUtil::jsonStringToValue(whereJson));
+        message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getKey(), JsonUtil::jsonStringToValue(whereJson));
 
     if (OperationParam::isOptionalParamValid(orderByJson))
-        message->SetObjectField(OperationParam::GlobalEntityServiceOrderBy.getValue(), JsonUtil::jsonStringToValue(orderByJson));
+        message->SetObjectField(OperationParam::GlobalEntityServiceOrderBy.getKey(), JsonUtil::jsonStringToValue(orderByJson));
 
-    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getValue(), maxReturn);
+    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getKey(), maxReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::GetList, message, callback);
     _client->sendRequest(sc);
@@ -155,7 +155,7 @@ void BrainCloudEntity::getList(const FString &whereJson, const FString &orderByJ
 void BrainCloudEntity::getListCount(const FString &whereJson, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getValue(), JsonUtil::jsonStringToValue(whereJson));
+    message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getKey(), JsonUtil::jsonStringToValue(whereJson));
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::GetListCount, message, callback);
     _client->sendRequest(sc);
@@ -164,7 +164,7 @@ void BrainCloudEntity::getListCount(const FString &whereJson, IServerCallback *c
 void BrainCloudEntity::getPage(const FString &context, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::GlobalEntityServiceContext.getValue(), JsonUtil::jsonStringToValue(context));
+    message->SetObjectField(OperationParam::GlobalEntityServiceContext.getKey(), JsonUtil::jsonStringToValue(context));
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::GetPage, message, callback);
     _client->sendRequest(sc);
@@ -173,8 +173,8 @@ void BrainCloudEntity::getPage(const FString &context, IServerCallback *callback
 void BrainCloudEntity::getPageOffset(const FString &context, int32 pageOffset, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceContext.getValue(), context);
-    message->SetNumberField(OperationParam::GlobalEntityServicePageOffset.getValue(), pageOffset);
+    message->SetStringField(OperationParam::GlobalEntityServiceContext.getKey(), context);
+    message->SetNumberField(OperationParam::GlobalEntityServicePageOffset.getKey(), pageOffset);
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::GetPageOffset, message, callback);
     _client->sendRequest(sc);
@@ -183,8 +183,8 @@ void BrainCloudEntity::getPageOffset(const FString &context, int32 pageOffset, I
 void BrainCloudEntity::incrementUserEntityData(const FString &entityId, const FString &jsonData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityId.getValue(), entityId);
-    message->SetObjectField(OperationParam::EntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+    message->SetStringField(OperationParam::EntityServiceEntityId.getKey(), entityId);
+    message->SetObjectField(OperationParam::EntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::IncrementUserEntityData, message, callback);
     _client->sendRequest(sc);
@@ -193,9 +193,9 @@ void BrainCloudEntity::incrementUserEntityData(const FString &entityId, const FS
 void BrainCloudEntity::incrementSharedUserEntityData(const FString &entityId, const FString &targetProfileId, const FString &jsonData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::EntityServiceEntityId.getValue(), entityId);
-    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getValue(), targetProfileId);
-    message->SetObjectField(OperationParam::EntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+    message->SetStringField(OperationParam::EntityServiceEntityId.getKey(), entityId);
+    message->SetStringField(OperationParam::EntityServiceTargetPlayerId.getKey(), targetProfileId);
+    message->SetObjectField(OperationParam::EntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
     ServerCall *sc = new ServerCall(ServiceName::Entity, ServiceOperation::IncrementSharedUserEntityData, message, callback);
     _client->sendRequest(sc);
@@ -14,9 +14,9 @@ void BrainCloudEvent::sendEvent(const FString &toPlayerId, const FString &eventT
 	// See IEventService on the server to make sure these parameter names are in sync
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 	// implicitly fromId: _userId
-	message->SetStringField(OperationParam::EventServiceSendToId.getValue(), toPlayerId);
-	message->SetStringField(OperationParam::EventServiceSendEventType.getValue(), eventType);
-	message->SetObjectField(OperationParam::EventServiceSendEventData.getValue(), JsonUtil::jsonStringToValue(jsonEventData));
+	message->SetStringField(OperationParam::EventServiceSendToId.getKey(), toPlayerId);
+	message->SetStringField(OperationParam::EventServiceSendEventType.getKey(), eventType);
+	message->SetObjectField(OperationParam::EventServiceSendEventData.getKey(), JsonUtil::jsonStringToValue(jsonEventData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Event, ServiceOperation::Send, message, callback);
 	_client->sendRequest(sc);
@@ -27,8 +27,8 @@ void BrainCloudEvent::updateIncomingEventData(const FString &evId, const FString
 	// See IEventService on the server to make sure these parameter names are in sync
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::EvId.getValue(), evId);
-	message->SetObjectField(OperationParam::EventServiceUpdateEventDataData.getValue(), JsonUtil::jsonStringToValue(jsonEventData));
+	message->SetStringField(OperationParam::EvId.getKey(), evId);
+	message->SetObjectField(OperationParam::EventServiceUpdateEventDataData.getKey(), JsonUtil::jsonStringToValue(jsonEventData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Event, ServiceOperation::UpdateEventData, message, callback);
 	_client->sendRequest(sc);
@@ -38,7 +38,7 @@ void BrainCloudEvent::deleteIncomingEvent(const FString &evId, IServerCallback *
 {
 	// See IEventService on the server to make sure these parameter names are in sync
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::EvId.getValue(), evId);
+	message->SetStringField(OperationParam::EvId.getKey(), evId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Event, ServiceOperation::DeleteIncoming, message, callback);
 	_client->sendRequest(sc);
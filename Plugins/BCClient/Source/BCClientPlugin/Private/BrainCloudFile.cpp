@@ -27,12 +27,12 @@ bool BrainCloudFile::uploadFile(
     int64 FileSize = FPlatformFileManager::Get().GetPlatformFile().FileSize(*localPath);
 
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::UploadCloudPath.getValue(), cloudPath);
-    message->SetStringField(OperationParam::UploadCloudFilename.getValue(), cloudFilename);
-    message->SetBoolField(OperationParam::UploadShareable.getValue(), shareable);
-    message->SetBoolField(OperationParam::UploadReplaceIfExists.getValue(), replaceIfExists);
-    message->SetNumberField(OperationParam::UploadFileSize.getValue(), FileSize);
-    message->SetStringField(OperationParam::UploadLocalPath.getValue(), localPath);
+    message->SetStringField(OperationParam::UploadCloudPath.getKey(), cloudPath);
+    message->SetStringField(OperationParam::UploadCloudFilename.getKey(), cloudFilename);
+    message->SetBoolField(OperationParam::UploadShareable.getKey(), shareable);
+    message->SetBoolField(OperationParam::UploadReplaceIfExists.getKey(), replaceIfExists);
+    message->SetNumberField(OperationParam::UploadFileSize.getKey(), FileSize);
+    message->SetStringField(OperationParam::UploadLocalPath.getKey(), localPath);
 
     ServerCall *sc = new ServerCall(ServiceName::File, ServiceOperation::PrepareUserUpload, message, callback);
     _client->sendRequest(sc);
@@ -50,8 +50,8 @@ void BrainCloudFile::listUserFiles(const FString &cloudPath, bool recurse, IServ
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
     if (OperationParam::isOptionalParamValid(cloudPath))
-        message->SetStringField(OperationParam::UploadCloudPath.getValue(), cloudPath);
-    message->SetBoolField(OperationParam::UploadRecurse.getValue(), recurse);
+        message->SetStringField(OperationParam::UploadCloudPath.getKey(), cloudPath);
+    message->SetBoolField(OperationParam::UploadRecurse.getKey(), recurse);
 
     ServerCall *sc = new ServerCall(ServiceName::File, ServiceOperation::ListUserFiles, message, callback);
     _client->sendRequest(sc);
@@ -60,8 +60,8 @@ void BrainCloudFile::listUserFiles(const FString &cloudPath, bool recurse, IServ
 void BrainCloudFile::deleteUserFile(const FString &cloudPath, const FString &cloudFilename, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::UploadCloudPath.getValue(), cloudPath);
-    message->SetStringField(OperationParam::UploadCloudFilename.getValue(), cloudFilename);
+    message->SetStringField(OperationParam::UploadCloudPath.getKey(), cloudPath);
+    message->SetStringField(OperationParam::UploadCloudFilename.getKey(), cloudFilename);
 
     ServerCall *sc = new ServerCall(ServiceName::File, ServiceOperation::DeleteUserFiles, message, callback);
     _client->sendRequest(sc);
@@ -70,8 +70,8 @@ void BrainCloudFile::deleteUserFile(const FString &cloudPath, const FString &clo
 void BrainCloudFile::deleteUserFiles(const FString &cloudPath, bool recurse, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::UploadCloudPath.getValue(), cloudPath);
-    message->SetBoolField(OperationParam::UploadRecurse.getValue(), recurse);
+    message->SetStringField(OperationParam::UploadCloudPath.getKey(), cloudPath);
+    message->SetBoolField(OperationParam::UploadRecurse.getKey(), recurse);
 
     ServerCall *sc = new ServerCall(ServiceName::File, ServiceOperation::DeleteUserFiles, message, callback);
     _client->sendRequest(sc);
@@ -80,8 +80,8 @@ void BrainCloudFile::deleteUserFiles(const FString &cloudPath, bool recurse, ISe
 void BrainCloudFile::getCDNUrl(const FString &cloudPath, const FString &cloudFileName, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::UploadCloudPath.getValue(), cloudPath);
-    message->SetStringField(OperationParam::UploadCloudFilename.getValue(), cloudFileName);
+    message->SetStringField(OperationParam::UploadCloudPath.getKey(), cloudPath);
+    message->SetStringField(OperationParam::UploadCloudFilename.getKey(), cloudFileName);
 
     ServerCall *sc = new ServerCall(ServiceName::File, ServiceOperation::GetCdnUrl, message, callback);
     _client->sendRequest(sc);
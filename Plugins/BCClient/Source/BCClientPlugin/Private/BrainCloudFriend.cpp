@@ -18,8 +18,8 @@ void BrainCloudFriend::getProfileInfoForCredential(const FString &externalId, EB
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::FriendServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::FriendServiceAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
+	message->SetStringField(OperationParam::FriendServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::FriendServiceAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::GetProfileInfoForCredential, message, callback);
 	_client->sendRequest(sc);
@@ -29,8 +29,8 @@ void BrainCloudFriend::getProfileInfoForExternalAuthId(const FString &externalId
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::FriendServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::ExternalAuthType.getValue(), externalAuthType);
+	message->SetStringField(OperationParam::FriendServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::ExternalAuthType.getKey(), externalAuthType);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::GetProfileInfoForExternalAuthId, message, callback);
 	_client->sendRequest(sc);
@@ -40,8 +40,8 @@ void BrainCloudFriend::getExternalIdForProfileId(const FString &profileId, const
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::FriendServiceProfileId.getValue(), profileId);
-	message->SetStringField(OperationParam::FriendServiceAuthenticationType.getValue(), authenticationType);
+	message->SetStringField(OperationParam::FriendServiceProfileId.getKey(), profileId);
+	message->SetStringField(OperationParam::FriendServiceAuthenticationType.getKey(), authenticationType);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::GetExternalIdForProfileId, message, callback);
 	_client->sendRequest(sc);
@@ -51,7 +51,7 @@ void BrainCloudFriend::getSummaryDataForProfileId(const FString &profileId, ISer
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::FriendServiceProfileId.getValue(), profileId);
+	message->SetStringField(OperationParam::FriendServiceProfileId.getKey(), profileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::GetSummaryDataForProfileId, message, callback);
 	_client->sendRequest(sc);
@@ -61,8 +61,8 @@ void BrainCloudFriend::readFriendEntity(const FString &entityId, const FString &
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::FriendServiceEntityId.getValue(), entityId);
-	message->SetStringField(OperationParam::FriendServiceFriendId.getValue(), friendId);
+	message->SetStringField(OperationParam::FriendServiceEntityId.getKey(), entityId);
+	message->SetStringField(OperationParam::FriendServiceFriendId.getKey(), friendId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::ReadFriendEntity, message, callback);
 	_client->sendRequest(sc);
@@ -72,7 +72,7 @@ void BrainCloudFriend::readFriendsEntities(const FString &entityType, IServerCal
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-	message->SetStringField(OperationParam::FriendServiceEntityType.getValue(), entityType);
+	message->SetStringField(OperationParam::FriendServiceEntityType.getKey(), entityType);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::ReadFriendsEntities, message, callback);
 	_client->sendRequest(sc);
@@ -81,7 +81,7 @@ void BrainCloudFriend::readFriendsEntities(const FString &entityType, IServerCal
 void BrainCloudFriend::readFriendUserState(const FString &friendId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::FriendServiceReadPlayerStateFriendId.getValue(), friendId);
+	message->SetStringField(OperationParam::FriendServiceReadPlayerStateFriendId.getKey(), friendId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::ReadFriendsPlayerState, message, callback);
 	_client->sendRequest(sc);
@@ -90,8 +90,8 @@ void BrainCloudFriend::readFriendUserState(const FString &friendId, IServerCallb
 void BrainCloudFriend::findUsersByExactName(const FString &searchText, int32 maxResults, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::FriendServiceSearchText.getValue(), searchText);
-	message->SetNumberField(OperationParam::FriendServiceMaxResults.getValue(), maxResults);
+	message->SetStringField(OperationParam::FriendServiceSearchText.getKey(), searchText);
+	message->SetNumberField(OperationParam::FriendServiceMaxResults.getKey(), maxResults);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::FindUsersByExactName, message, callback);
 	_client->sendRequest(sc);
@@ -100,8 +100,8 @@ void BrainCloudFriend::findUsersByExactName(const FString &searchText, int32 max
 void BrainCloudFriend::findUsersBySubstrName(const FString &searchText, int32 maxResults, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::FriendServiceSearchText.getValue(), searchText);
-	message->SetNumberField(OperationParam::FriendServiceMaxResults.getValue(), maxResults);
+	message->SetStringField(OperationParam::FriendServiceSearchText.getKey(), searchText);
+	message->SetNumberField(OperationParam::FriendServiceMaxResults.getKey(), maxResults);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::FindUsersBySubstrName, message, callback);
 	_client->sendRequest(sc);
@@ -110,7 +110,7 @@ void BrainCloudFriend::findUsersBySubstrName(const FString &searchText, int32 ma
 void BrainCloudFriend::findUserByExactUniversalId(const FString &searchText, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::FriendServiceSearchText.getValue(), searchText);
+	message->SetStringField(OperationParam::FriendServiceSearchText.getKey(), searchText);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::FindUserByExactUniversalId, message, callback);
 	_client->sendRequest(sc);
@@ -119,8 +119,8 @@ void BrainCloudFriend::findUserByExactUniversalId(const FString &searchText, ISe
 void BrainCloudFriend::findUsersByUniversalIdStartingWith(const FString &searchText, int32 maxResults, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::FriendServiceSearchText.getValue(), searchText);
-	message->SetNumberField(OperationParam::FriendServiceMaxResults.getValue(), maxResults);
+	message->SetStringField(OperationParam::FriendServiceSearchText.getKey(), searchText);
+	message->SetNumberField(OperationParam::FriendServiceMaxResults.getKey(), maxResults);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::FindUsersByUniversalIdStartingWith, message, callback);
 	_client->sendRequest(sc);
@@ -129,8 +129,8 @@ void BrainCloudFriend::findUsersByUniversalIdStartingWith(const FString &searchT
 void BrainCloudFriend::findUsersByNameStartingWith(const FString &searchText, int32 maxResults, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::FriendServiceSearchText.getValue(), searchText);
-	message->SetNumberField(OperationParam::FriendServiceMaxResults.getValue(), maxResults);
+	message->SetStringField(OperationParam::FriendServiceSearchText.getKey(), searchText);
+	message->SetNumberField(OperationParam::FriendServiceMaxResults.getKey(), maxResults);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::FindUsersByNameStartingWith, message, callback);
 	_client->sendRequest(sc);
@@ -139,8 +139,8 @@ void BrainCloudFriend::findUsersByNameStartingWith(const FString &searchText, in
 void BrainCloudFriend::listFriends(EFriendPlatform friendPlatform, bool includeSummaryData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetBoolField(OperationParam::FriendServiceIncludeSummaryData.getValue(), includeSummaryData);
-	message->SetStringField(OperationParam::FriendServiceFriendPlatform.getValue(), _platformStrings[friendPlatform]);
+	message->SetBoolField(OperationParam::FriendServiceIncludeSummaryData.getKey(), includeSummaryData);
+	message->SetStringField(OperationParam::FriendServiceFriendPlatform.getKey(), _platformStrings[friendPlatform]);
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::ListFriends, message, callback);
 	_client->sendRequest(sc);
@@ -149,7 +149,7 @@ void BrainCloudFriend::listFriends(EFriendPlatform friendPlatform, bool includeS
 void BrainCloudFriend::addFriends(const TArray<FString> &profileIds, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::FriendServiceProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
+	message->SetArrayField(OperationParam::FriendServiceProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::AddFriends, message, callback);
 	_client->sendRequest(sc);
@@ -158,7 +158,7 @@ void BrainCloudFriend::addFriends(const TArray<FString> &profileIds, IServerCall
 void BrainCloudFriend::removeFriends(const TArray<FString> &profileIds, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::FriendServiceProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
+	message->SetArrayField(OperationParam::FriendServiceProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::RemoveFriends, message, callback);
 	_client->sendRequest(sc);
@@ -167,7 +167,7 @@ void BrainCloudFriend::removeFriends(const TArray<FString> &profileIds, IServerC
 void BrainCloudFriend::getUsersOnlineStatus(const TArray<FString> &profileIds, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::FriendServiceProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
+	message->SetArrayField(OperationParam::FriendServiceProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
 
 	ServerCall *sc = new ServerCall(ServiceName::Friend, ServiceOperation::GetUsersOnlineStatus, message, callback);
 	_client->sendRequest(sc);
@@ -17,7 +17,7 @@ void BrainCloudGamification::setAchievementAwardedDelegate(IServerCallback *call
 void BrainCloudGamification::readAllGamification(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::Read, message, callback);
     _client->sendRequest(sc);
@@ -26,7 +26,7 @@ void BrainCloudGamification::readAllGamification(IServerCallback *callback, bool
 void BrainCloudGamification::readQuests(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadQuests, message, callback);
     _client->sendRequest(sc);
@@ -35,7 +35,7 @@ void BrainCloudGamification::readQuests(IServerCallback *callback, bool includeM
 void BrainCloudGamification::readMilestones(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadMilestones, message, callback);
     _client->sendRequest(sc);
@@ -44,7 +44,7 @@ void BrainCloudGamification::readMilestones(IServerCallback *callback, bool incl
 void BrainCloudGamification::readAchievements(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadAchievements, message, callback);
     _client->sendRequest(sc);
@@ -61,7 +61,7 @@ void BrainCloudGamification::readXpLevelsMetaData(IServerCallback *callback)
 void BrainCloudGamification::readAchievedAchievements(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadAchievedAchievements, message, callback);
     _client->sendRequest(sc);
@@ -70,7 +70,7 @@ void BrainCloudGamification::readAchievedAchievements(IServerCallback *callback,
 void BrainCloudGamification::readCompletedQuests(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadCompletedQuests, message, callback);
     _client->sendRequest(sc);
@@ -79,7 +79,7 @@ void BrainCloudGamification::readCompletedQuests(IServerCallback *callback, bool
 void BrainCloudGamification::readInProgressQuests(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadInProgressQuests, message, callback);
     _client->sendRequest(sc);
@@ -88,7 +88,7 @@ void BrainCloudGamification::readInProgressQuests(IServerCallback *callback, boo
 void BrainCloudGamification::readNotStartedQuests(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadNotStartedQuests, message, callback);
     _client->sendRequest(sc);
@@ -97,7 +97,7 @@ void BrainCloudGamification::readNotStartedQuests(IServerCallback *callback, boo
 void BrainCloudGamification::readQuestsWithStatus(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadQuestsWithStatus, message, callback);
     _client->sendRequest(sc);
@@ -106,7 +106,7 @@ void BrainCloudGamification::readQuestsWithStatus(IServerCallback *callback, boo
 void BrainCloudGamification::readQuestsWithBasicPercentage(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadQuestsWithBasicPercentage, message, callback);
     _client->sendRequest(sc);
@@ -115,7 +115,7 @@ void BrainCloudGamification::readQuestsWithBasicPercentage(IServerCallback *call
 void BrainCloudGamification::readQuestsWithComplexPercentage(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadQuestsWithComplexPercentage, message, callback);
     _client->sendRequest(sc);
@@ -124,7 +124,7 @@ void BrainCloudGamification::readQuestsWithComplexPercentage(IServerCallback *ca
 void BrainCloudGamification::readCompletedMilestones(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadCompletedMilestones, message, callback);
     _client->sendRequest(sc);
@@ -133,7 +133,7 @@ void BrainCloudGamification::readCompletedMilestones(IServerCallback *callback,
 void BrainCloudGamification::readInProgressMilestones(IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadInProgressMilestones, message, callback);
     _client->sendRequest(sc);
@@ -142,8 +142,8 @@ void BrainCloudGamification::readInProgressMilestones(IServerCallback *callback,
 void BrainCloudGamification::readQuestsByCategory(const FString &category, IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GamificationServiceCategory.getValue(), category);
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetStringField(OperationParam::GamificationServiceCategory.getKey(), category);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadQuestsByCategory, message, callback);
     _client->sendRequest(sc);
@@ -152,8 +152,8 @@ void BrainCloudGamification::readQuestsByCategory(const FString &category, IServ
 void BrainCloudGamification::readMilestonesByCategory(const FString &category, IServerCallback *callback, bool includeMetaData)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GamificationServiceCategory.getValue(), category);
-    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getValue(), includeMetaData);
+    message->SetStringField(OperationParam::GamificationServiceCategory.getKey(), category);
+    message->SetBoolField(OperationParam::GamificationServiceIncludeMetaData.getKey(), includeMetaData);
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadMilestonesByCategory, message, callback);
     _client->sendRequest(sc);
@@ -162,7 +162,7 @@ void BrainCloudGamification::readMilestonesByCategory(const FString &category, I
 void BrainCloudGamification::awardAchievements(const TArray<FString> &achievements, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetArrayField(OperationParam::GamificationServiceAchievementsName.getValue(), JsonUtil::arrayToJsonArray(achievements));
+    message->SetArrayField(OperationParam::GamificationServiceAchievementsName.getKey(), JsonUtil::arrayToJsonArray(achievements));
 
     ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::AwardAchievements, message, callback);
     _client->sendRequest(sc);
@@ -173,10 +173,10 @@ void BrainCloudGamification::achievementAwardedCallback(ServiceName serviceName,
     TSharedPtr<FJsonObject> data = JsonUtil::jsonStringToValue(jsonData);
 
     TSharedPtr<FJsonObject> _jsonObj1;
-    if (data->TryGetObjectField(OperationParam::GamificationServiceAchievementsData.getValue(), (const TSharedPtr<FJsonObject> *&)_jsonObj1))
+    if (data->TryGetObjectField(OperationParam::GamificationServiceAchievementsData.getKey(), (const TSharedPtr<FJsonObject> *&)_jsonObj1))
     {
         TArray<TSharedPtr<FJsonValue>> jsonArray;
-        if (_jsonObj1->TryGetArrayField(OperationParam::GamificationServiceAchievementsName.getValue(),
+        if (_jsonObj1->TryGetArrayField(OperationParam::GamificationServiceAchievementsName.getKey(),
                                         (const TArray<TSharedPtr<FJsonValue>> *&)jsonArray))
         {
             if (m_achievementsDelegate != nullptr)
@@ -192,7 +192,7 @@ void BrainCloudGamification::checkForAchievementsToAward(ServiceName serviceName
     TSharedPtr<FJsonObject> data = JsonUtil::jsonStringToValue(jsonData);
 
     TArray<TSharedPtr<FJsonValue>> jsonArray;
-    if (data->TryGetArrayField(OperationParam::GamificationServiceAchievementsData.getValue(), (const TArray<TSharedPtr<FJsonValue>> *&)jsonArray))
+    if (data->TryGetArrayField(OperationParam::GamificationServiceAchievementsData.getKey(), (const TArray<TSharedPtr<FJsonValue>> *&)jsonArray))
     {
         if (m_achievementsDelegate != nullptr)
         {
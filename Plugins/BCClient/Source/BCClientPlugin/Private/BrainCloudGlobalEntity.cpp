@@ -14,10 +14,10 @@ void BrainCloudGlobalEntity::createEntity(const FString &entityType, int64 timeT
                                           const FString &jsonEntityData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityType.getValue(), entityType);
-    message->SetNumberField(OperationParam::GlobalEntityServiceTimeToLive.getValue(), timeToLive);
-    message->SetObjectField(OperationParam::GlobalEntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
-    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityType.getKey(), entityType);
+    message->SetNumberField(OperationParam::GlobalEntityServiceTimeToLive.getKey(), timeToLive);
+    message->SetObjectField(OperationParam::GlobalEntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::Create, message, callback);
     _client->sendRequest(sc);
@@ -27,11 +27,11 @@ void BrainCloudGlobalEntity::createEntityWithIndexedId(const FString &entityType
                                                        IAcl *jsonEntityAcl, const FString &jsonEntityData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityType.getValue(), entityType);
-    message->SetStringField(OperationParam::GlobalEntityServiceIndexedId.getValue(), indexedId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceTimeToLive.getValue(), timeToLive);
-    message->SetObjectField(OperationParam::GlobalEntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
-    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityType.getKey(), entityType);
+    message->SetStringField(OperationParam::GlobalEntityServiceIndexedId.getKey(), indexedId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceTimeToLive.getKey(), timeToLive);
+    message->SetObjectField(OperationParam::GlobalEntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::CreateWithIndexedId, message, callback);
     _client->sendRequest(sc);
@@ -40,9 +40,9 @@ void BrainCloudGlobalEntity::createEntityWithIndexedId(const FString &entityType
 void BrainCloudGlobalEntity::updateEntity(const FString &entityId, int32 version, const FString &jsonEntityData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getValue(), version);
-    message->SetObjectField(OperationParam::GlobalEntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonEntityData));
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getKey(), version);
+    message->SetObjectField(OperationParam::GlobalEntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonEntityData));
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::Update, message, callback);
     _client->sendRequest(sc);
@@ -51,9 +51,9 @@ void BrainCloudGlobalEntity::updateEntity(const FString &entityId, int32 version
 void BrainCloudGlobalEntity::updateEntityAcl(const FString &entityId, int32 version, IAcl *jsonEntityAcl, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getValue(), version);
-    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getKey(), version);
+    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::UpdateAcl, message, callback);
     _client->sendRequest(sc);
@@ -62,9 +62,9 @@ void BrainCloudGlobalEntity::updateEntityAcl(const FString &entityId, int32 vers
 void BrainCloudGlobalEntity::updateEntityTimeToLive(const FString &entityId, int32 version, int64 timeToLive, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getValue(), version);
-    message->SetNumberField(OperationParam::GlobalEntityServiceTimeToLive.getValue(), timeToLive);
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getKey(), version);
+    message->SetNumberField(OperationParam::GlobalEntityServiceTimeToLive.getKey(), timeToLive);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::UpdateTimeToLive, message, callback);
     _client->sendRequest(sc);
@@ -73,8 +73,8 @@ void BrainCloudGlobalEntity::updateEntityTimeToLive(const FString &entityId, int
 void BrainCloudGlobalEntity::deleteEntity(const FString &entityId, int32 version, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getValue(), version);
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getKey(), version);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::Delete, message, callback);
     _client->sendRequest(sc);
@@ -83,7 +83,7 @@ void BrainCloudGlobalEntity::deleteEntity(const FString &entityId, int32 version
 void BrainCloudGlobalEntity::readEntity(const FString &entityId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::Read, message, callback);
     _client->sendRequest(sc);
@@ -94,12 +94,12 @@ void BrainCloudGlobalEntity::getList(const FString &where, const FString &orderB
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
     if (OperationParam::isOptionalParamValid(where))
-        message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getValue(), JsonUtil::jsonStringToValue(where));
+        message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getKey(), JsonUtil::jsonStringToValue(where));
 
     if (OperationParam::isOptionalParamValid(orderBy))
-        message->SetObjectField(OperationParam::GlobalEntityServiceOrderBy.getValue(), JsonUtil::jsonStringToValue(orderBy));
+        message->SetObjectField(OperationParam::GlobalEntityServiceOrderBy.getKey(), JsonUtil::jsonStringToValue(orderBy));
 
-    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getValue(), maxReturn);
+    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getKey(), maxReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::GetList, message, callback);
     _client->sendRequest(sc);
@@ -108,8 +108,8 @@ void BrainCloudGlobalEntity::getList(const FString &where, const FString &orderB
 void BrainCloudGlobalEntity::getListByIndexedId(const FString &entityIndexedId, int32 maxReturn, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceIndexedId.getValue(), entityIndexedId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getValue(), maxReturn);
+    message->SetStringField(OperationParam::GlobalEntityServiceIndexedId.getKey(), entityIndexedId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getKey(), maxReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::GetListByIndexedId, message, callback);
     _client->sendRequest(sc);
@@ -118,7 +118,7 @@ void BrainCloudGlobalEntity::getListByIndexedId(const FString &entityIndexedId,
 void BrainCloudGlobalEntity::getListCount(const FString &where, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getValue(), JsonUtil::jsonStringToValue(where));
+    message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getKey(), JsonUtil::jsonStringToValue(where));
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::GetListCount, message, callback);
     _client->sendRequest(sc);
@@ -127,7 +127,7 @@ void BrainCloudGlobalEntity::getListCount(const FString &where, IServerCallback
 void BrainCloudGlobalEntity::getPage(const FString &context, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::GlobalEntityServiceContext.getValue(), JsonUtil::jsonStringToValue(context));
+    message->SetObjectField(OperationParam::GlobalEntityServiceContext.getKey(), JsonUtil::jsonStringToValue(context));
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::GetPage, message, callback);
     _client->sendRequest(sc);
@@ -136,8 +136,8 @@ void BrainCloudGlobalEntity::getPage(const FString &context, IServerCallback *ca
 void BrainCloudGlobalEntity::getPageOffset(const FString &context, int32 pageOffset, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceContext.getValue(), context);
-    message->SetNumberField(OperationParam::GlobalEntityServicePageOffset.getValue(), pageOffset);
+    message->SetStringField(OperationParam::GlobalEntityServiceContext.getKey(), context);
+    message->SetNumberField(OperationParam::GlobalEntityServicePageOffset.getKey(), pageOffset);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::GetPageOffset, message, callback);
     _client->sendRequest(sc);
@@ -146,8 +146,8 @@ void BrainCloudGlobalEntity::getPageOffset(const FString &context, int32 pageOff
 void BrainCloudGlobalEntity::incrementGlobalEntityData(const FString &entityId, const FString &jsonData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetObjectField(OperationParam::GlobalEntityServiceData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetObjectField(OperationParam::GlobalEntityServiceData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::IncrementGlobalEntityData, message, callback);
     _client->sendRequest(sc);
@@ -156,8 +156,8 @@ void BrainCloudGlobalEntity::incrementGlobalEntityData(const FString &entityId,
 void BrainCloudGlobalEntity::getRandomEntitiesMatching(const FString &where, int32 maxReturn, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getValue(), JsonUtil::jsonStringToValue(where));
-    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getValue(), maxReturn);
+    message->SetObjectField(OperationParam::GlobalEntityServiceWhere.getKey(), JsonUtil::jsonStringToValue(where));
+    message->SetNumberField(OperationParam::GlobalEntityServiceMaxReturn.getKey(), maxReturn);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::GetRandomEntitiesMatching, message, callback);
     _client->sendRequest(sc);
@@ -166,9 +166,9 @@ void BrainCloudGlobalEntity::getRandomEntitiesMatching(const FString &where, int
 void BrainCloudGlobalEntity::updateEntityIndexedId(const FString &entityId, int32 version, const FString &entityIndexedId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getValue(), version);
-    message->SetStringField(OperationParam::GlobalEntityServiceIndexedId.getValue(), entityIndexedId);
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getKey(), version);
+    message->SetStringField(OperationParam::GlobalEntityServiceIndexedId.getKey(), entityIndexedId);
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::UpdateEntityIndexedId, message, callback);
     _client->sendRequest(sc);
@@ -177,10 +177,10 @@ void BrainCloudGlobalEntity::updateEntityIndexedId(const FString &entityId, int3
 void BrainCloudGlobalEntity::updateEntityOwnerAndAcl(const FString &entityId, int32 version, const FString &ownerId, IAcl *jsonEntityAcl, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetStringField(OperationParam::OwnerId.getValue(), ownerId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getValue(), version);
-    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetStringField(OperationParam::OwnerId.getKey(), ownerId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getKey(), version);
+    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::UpdateEntityOwnerAndAcl, message, callback);
     _client->sendRequest(sc);
@@ -189,9 +189,9 @@ void BrainCloudGlobalEntity::updateEntityOwnerAndAcl(const FString &entityId, in
 void BrainCloudGlobalEntity::makeSystemEntity(const FString &entityId, int32 version, IAcl *jsonEntityAcl, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getValue(), entityId);
-    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getValue(), version);
-    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getValue(), jsonEntityAcl->toJsonObject());
+    message->SetStringField(OperationParam::GlobalEntityServiceEntityId.getKey(), entityId);
+    message->SetNumberField(OperationParam::GlobalEntityServiceVersion.getKey(), version);
+    message->SetObjectField(OperationParam::GlobalEntityServiceAcl.getKey(), jsonEntityAcl->toJsonObject());
 
     ServerCall *sc = new ServerCall(ServiceName::GlobalEntity, ServiceOperation::MakeSystemEntity, message, callback);
     _client->sendRequest(sc);
@@ -13,7 +13,7 @@ BrainCloudGlobalFile::BrainCloudGlobalFile(BrainCloudClient *client) : _client(c
 void BrainCloudGlobalFile::getFileInfo(const FString &fileId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GlobalFileFileId.getValue(), fileId);
+	message->SetStringField(OperationParam::GlobalFileFileId.getKey(), fileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::GlobalFile, ServiceOperation::GetFileInfo, message, callback);
 	_client->sendRequest(sc);
@@ -22,8 +22,8 @@ void BrainCloudGlobalFile::getFileInfo(const FString &fileId, IServerCallback *c
 void BrainCloudGlobalFile::getFileInfoSimple(const FString &fileName, const FString &folderPath, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GlobalFileFileName.getValue(), fileName);
-    message->SetStringField(OperationParam::GlobalFileFolderPath.getValue(), folderPath);
+	message->SetStringField(OperationParam::GlobalFileFileName.getKey(), fileName);
+    message->SetStringField(OperationParam::GlobalFileFolderPath.getKey(), folderPath);
 
 	ServerCall *sc = new ServerCall(ServiceName::GlobalFile, ServiceOperation::GetFileInfo, message, callback);
 	_client->sendRequest(sc);
@@ -32,7 +32,7 @@ void BrainCloudGlobalFile::getFileInfoSimple(const FString &fileName, const FStr
 void BrainCloudGlobalFile::getGlobalCDNUrl(const FString &fileId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GlobalFileFileId.getValue(), fileId);
+	message->SetStringField(OperationParam::GlobalFileFileId.getKey(), fileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::GlobalFile, ServiceOperation::GetGlobalCDNUrl, message, callback);
 	_client->sendRequest(sc);
@@ -41,8 +41,8 @@ void BrainCloudGlobalFile::getGlobalCDNUrl(const FString &fileId, IServerCallbac
 void BrainCloudGlobalFile::getGlobalFileList(const FString &folderPath, bool recurse, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GlobalFileFolderPath.getValue(), folderPath);
-    message->SetBoolField(OperationParam::GlobalFileRecurse.getValue(), recurse);
+	message->SetStringField(OperationParam::GlobalFileFolderPath.getKey(), folderPath);
+    message->SetBoolField(OperationParam::GlobalFileRecurse.getKey(), recurse);
 
 	ServerCall *sc = new ServerCall(ServiceName::GlobalFile, ServiceOperation::GetGlobalFileList, message, callback);
 	_client->sendRequest(sc);
@@ -19,7 +19,7 @@ void BrainCloudGlobalStatistics::readAllGlobalStats(IServerCallback *callback)
 void BrainCloudGlobalStatistics::readGlobalStatsSubset(const TArray<FString> &globalStats, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::PlayerStatisticsServiceStats.getValue(), JsonUtil::arrayToJsonArray(globalStats));
+	message->SetArrayField(OperationParam::PlayerStatisticsServiceStats.getKey(), JsonUtil::arrayToJsonArray(globalStats));
 
 	ServerCall *sc = new ServerCall(ServiceName::GlobalGameStatistics, ServiceOperation::ReadSubset, message, callback);
 	_client->sendRequest(sc);
@@ -28,7 +28,7 @@ void BrainCloudGlobalStatistics::readGlobalStatsSubset(const TArray<FString> &gl
 void BrainCloudGlobalStatistics::readGlobalStatsForCategory(const FString &category, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GamificationServiceCategory.getValue(), category);
+	message->SetStringField(OperationParam::GamificationServiceCategory.getKey(), category);
 
 	ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadGameStatisticsByCategory, message, callback);
 	_client->sendRequest(sc);
@@ -37,7 +37,7 @@ void BrainCloudGlobalStatistics::readGlobalStatsForCategory(const FString &categ
 void BrainCloudGlobalStatistics::incrementGlobalGameStat(const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
 	ServerCall *sc = new ServerCall(ServiceName::GlobalGameStatistics, ServiceOperation::UpdateIncrement, message, callback);
 	_client->sendRequest(sc);
@@ -46,7 +46,7 @@ void BrainCloudGlobalStatistics::incrementGlobalGameStat(const FString &jsonData
 void BrainCloudGlobalStatistics::processStatistics(const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	ServerCall *sc = new ServerCall(ServiceName::GlobalGameStatistics, ServiceOperation::ProcessStatistics, message, callback);
 	_client->sendRequest(sc);
 }
\ No newline at end of file
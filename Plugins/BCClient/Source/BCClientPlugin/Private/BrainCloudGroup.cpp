@@ -13,7 +13,7 @@ BrainCloudGroup::BrainCloudGroup(BrainCloudClient *client) : _client(client){};
 void BrainCloudGroup::acceptGroupInvitation(const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::AcceptGroupInvitation, message, callback);
 	_client->sendRequest(sc);
@@ -22,11 +22,11 @@ void BrainCloudGroup::acceptGroupInvitation(const FString &groupId, IServerCallb
 void BrainCloudGroup::addGroupMember(const FString &groupId, const FString &profileId, ERole role, const FString &jsonAttributes, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
-	message->SetStringField(OperationParam::GroupRole.getValue(), roleToString(role));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
+	message->SetStringField(OperationParam::GroupRole.getKey(), roleToString(role));
 	if (OperationParam::isOptionalParamValid(jsonAttributes))
-		message->SetObjectField(OperationParam::GroupAttributes.getValue(), JsonUtil::jsonStringToValue(jsonAttributes));
+		message->SetObjectField(OperationParam::GroupAttributes.getKey(), JsonUtil::jsonStringToValue(jsonAttributes));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::AddGroupMember, message, callback);
 	_client->sendRequest(sc);
@@ -35,11 +35,11 @@ void BrainCloudGroup::addGroupMember(const FString &groupId, const FString &prof
 void BrainCloudGroup::approveGroupJoinRequest(const FString &groupId, const FString &profileId, ERole role, const FString &jsonAttributes, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
-	message->SetStringField(OperationParam::GroupRole.getValue(), roleToString(role));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
+	message->SetStringField(OperationParam::GroupRole.getKey(), roleToString(role));
 	if (OperationParam::isOptionalParamValid(jsonAttributes))
-		message->SetObjectField(OperationParam::GroupAttributes.getValue(), JsonUtil::jsonStringToValue(jsonAttributes));
+		message->SetObjectField(OperationParam::GroupAttributes.getKey(), JsonUtil::jsonStringToValue(jsonAttributes));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ApproveGroupJoinRequest, message, callback);
 	_client->sendRequest(sc);
@@ -48,10 +48,10 @@ void BrainCloudGroup::approveGroupJoinRequest(const FString &groupId, const FStr
 void BrainCloudGroup::autoJoinGroup(const FString &groupType, EAutoJoinStrategy autoJoinStrategy, const FString &dataQueryJson, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupType.getValue(), groupType);
-	message->SetStringField(OperationParam::GroupAutoJoinStrategy.getValue(), AutoJoinStrategyToString(autoJoinStrategy));
+	message->SetStringField(OperationParam::GroupType.getKey(), groupType);
+	message->SetStringField(OperationParam::GroupAutoJoinStrategy.getKey(), AutoJoinStrategyToString(autoJoinStrategy));
 	if (OperationParam::isOptionalParamValid(dataQueryJson))
-		message->SetObjectField(OperationParam::GroupWhere.getValue(), JsonUtil::jsonStringToValue(dataQueryJson));
+		message->SetObjectField(OperationParam::GroupWhere.getKey(), JsonUtil::jsonStringToValue(dataQueryJson));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::AutoJoinGroup, message, callback);
 	_client->sendRequest(sc);
@@ -60,10 +60,10 @@ void BrainCloudGroup::autoJoinGroup(const FString &groupType, EAutoJoinStrategy
 void BrainCloudGroup::autoJoinGroupMulti(const TArray<FString> &groupTypes, EAutoJoinStrategy autoJoinStrategy, const FString &dataQueryJson, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::GroupTypes.getValue(), JsonUtil::arrayToJsonArray(groupTypes));
-	message->SetStringField(OperationParam::GroupAutoJoinStrategy.getValue(), AutoJoinStrategyToString(autoJoinStrategy));
+	message->SetArrayField(OperationParam::GroupTypes.getKey(), JsonUtil::arrayToJsonArray(groupTypes));
+	message->SetStringField(OperationParam::GroupAutoJoinStrategy.getKey(), AutoJoinStrategyToString(autoJoinStrategy));
 	if (OperationParam::isOptionalParamValid(dataQueryJson))
-		message->SetObjectField(OperationParam::GroupWhere.getValue(), JsonUtil::jsonStringToValue(dataQueryJson));
+		message->SetObjectField(OperationParam::GroupWhere.getKey(), JsonUtil::jsonStringToValue(dataQueryJson));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::AutoJoinGroupMulti, message, callback);
 	_client->sendRequest(sc);
@@ -72,8 +72,8 @@ void BrainCloudGroup::autoJoinGroupMulti(const TArray<FString> &groupTypes, EAut
 void BrainCloudGroup::cancelGroupInvitation(const FString &groupId, const FString &profileId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::CancelGroupInvitation, message, callback);
 	_client->sendRequest(sc);
@@ -91,17 +91,17 @@ void BrainCloudGroup::createGroup(
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 	if (OperationParam::isOptionalParamValid(name))
-		message->SetStringField(OperationParam::GroupName.getValue(), name);
-	message->SetStringField(OperationParam::GroupType.getValue(), groupType);
-	message->SetBoolField(OperationParam::GroupIsOpenGroup.getValue(), isOpenGroup);
+		message->SetStringField(OperationParam::GroupName.getKey(), name);
+	message->SetStringField(OperationParam::GroupType.getKey(), groupType);
+	message->SetBoolField(OperationParam::GroupIsOpenGroup.getKey(), isOpenGroup);
 	if (acl != nullptr)
-		message->SetObjectField(OperationParam::GroupAcl.getValue(), acl->toJsonObject());
+		message->SetObjectField(OperationParam::GroupAcl.getKey(), acl->toJsonObject());
 	if (OperationParam::isOptionalParamValid(jsonData))
-		message->SetObjectField(OperationParam::GroupData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::GroupData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	if (OperationParam::isOptionalParamValid(jsonOwnerAttributes))
-		message->SetObjectField(OperationParam::GroupOwnerAttributes.getValue(), JsonUtil::jsonStringToValue(jsonOwnerAttributes));
+		message->SetObjectField(OperationParam::GroupOwnerAttributes.getKey(), JsonUtil::jsonStringToValue(jsonOwnerAttributes));
 	if (OperationParam::isOptionalParamValid(jsonDefaultMemberAttributes))
-		message->SetObjectField(OperationParam::GroupDefaultMemberAttributes.getValue(), JsonUtil::jsonStringToValue(jsonDefaultMemberAttributes));
+		message->SetObjectField(OperationParam::GroupDefaultMemberAttributes.getKey(), JsonUtil::jsonStringToValue(jsonDefaultMemberAttributes));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::CreateGroup, message, callback);
 	_client->sendRequest(sc);
@@ -120,19 +120,19 @@ void BrainCloudGroup::createGroupWithSummaryData(
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 	if (OperationParam::isOptionalParamValid(name))
-		message->SetStringField(OperationParam::GroupName.getValue(), name);
-	message->SetStringField(OperationParam::GroupType.getValue(), groupType);
-	message->SetBoolField(OperationParam::GroupIsOpenGroup.getValue(), isOpenGroup);
+		message->SetStringField(OperationParam::GroupName.getKey(), name);
+	message->SetStringField(OperationParam::GroupType.getKey(), groupType);
+	message->SetBoolField(OperationParam::GroupIsOpenGroup.getKey(), isOpenGroup);
 	if (acl != nullptr)
-		message->SetObjectField(OperationParam::GroupAcl.getValue(), acl->toJsonObject());
+		message->SetObjectField(OperationParam::GroupAcl.getKey(), acl->toJsonObject());
 	if (OperationParam::isOptionalParamValid(jsonData))
-		message->SetObjectField(OperationParam::GroupData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::GroupData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	if (OperationParam::isOptionalParamValid(jsonOwnerAttributes))
-		message->SetObjectField(OperationParam::GroupOwnerAttributes.getValue(), JsonUtil::jsonStringToValue(jsonOwnerAttributes));
+		message->SetObjectField(OperationParam::GroupOwnerAttributes.getKey(), JsonUtil::jsonStringToValue(jsonOwnerAttributes));
 	if (OperationParam::isOptionalParamValid(jsonDefaultMemberAttributes))
-		message->SetObjectField(OperationParam::GroupDefaultMemberAttributes.getValue(), JsonUtil::jsonStringToValue(jsonDefaultMemberAttributes));
+		message->SetObjectField(OperationParam::GroupDefaultMemberAttributes.getKey(), JsonUtil::jsonStringToValue(jsonDefaultMemberAttributes));
 	if (OperationParam::isOptionalParamValid(jsonSummaryData))
-		message->SetObjectField(OperationParam::GroupSummaryData.getValue(), JsonUtil::jsonStringToValue(jsonSummaryData));
+		message->SetObjectField(OperationParam::GroupSummaryData.getKey(), JsonUtil::jsonStringToValue(jsonSummaryData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::CreateGroup, message, callback);
 	_client->sendRequest(sc);
@@ -147,13 +147,13 @@ void BrainCloudGroup::createGroupEntity(
 	IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupEntityType.getValue(), entityType);
-	message->SetBoolField(OperationParam::GroupIsOwnedByGroupMember.getValue(), isOwnedByGroupMember);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupEntityType.getKey(), entityType);
+	message->SetBoolField(OperationParam::GroupIsOwnedByGroupMember.getKey(), isOwnedByGroupMember);
 	if (acl != nullptr)
-		message->SetObjectField(OperationParam::GroupAcl.getValue(), acl->toJsonObject());
+		message->SetObjectField(OperationParam::GroupAcl.getKey(), acl->toJsonObject());
 	if (OperationParam::isOptionalParamValid(jsonData))
-		message->SetObjectField(OperationParam::GroupData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::GroupData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::CreateGroupEntity, message, callback);
 	_client->sendRequest(sc);
@@ -162,8 +162,8 @@ void BrainCloudGroup::createGroupEntity(
 void BrainCloudGroup::deleteGroup(const FString &groupId, int32 version, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::GroupVersion.getValue(), version);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::GroupVersion.getKey(), version);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::DeleteGroup, message, callback);
 	_client->sendRequest(sc);
@@ -172,9 +172,9 @@ void BrainCloudGroup::deleteGroup(const FString &groupId, int32 version, IServer
 void BrainCloudGroup::deleteGroupEntity(const FString &groupId, const FString &entityId, int32 version, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupEntityId.getValue(), entityId);
-	message->SetNumberField(OperationParam::GroupVersion.getValue(), version);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupEntityId.getKey(), entityId);
+	message->SetNumberField(OperationParam::GroupVersion.getKey(), version);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::DeleteGroupEntity, message, callback);
 	_client->sendRequest(sc);
@@ -190,8 +190,8 @@ void BrainCloudGroup::getMyGroups(IServerCallback *callback)
 void BrainCloudGroup::incrementGroupData(const FString &groupId, const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetObjectField(OperationParam::GroupData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetObjectField(OperationParam::GroupData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::IncrementGroupData, message, callback);
 	_client->sendRequest(sc);
@@ -200,9 +200,9 @@ void BrainCloudGroup::incrementGroupData(const FString &groupId, const FString &
 void BrainCloudGroup::incrementGroupEntityData(const FString &groupId, const FString &entityId, const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupEntityId.getValue(), entityId);
-	message->SetObjectField(OperationParam::GroupData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupEntityId.getKey(), entityId);
+	message->SetObjectField(OperationParam::GroupData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::IncrementGroupEntityData, message, callback);
 	_client->sendRequest(sc);
@@ -211,11 +211,11 @@ void BrainCloudGroup::incrementGroupEntityData(const FString &groupId, const FSt
 void BrainCloudGroup::inviteGroupMember(const FString &groupId, const FString &profileId, ERole role, const FString &jsonAttributes, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
-	message->SetStringField(OperationParam::GroupRole.getValue(), roleToString(role));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
+	message->SetStringField(OperationParam::GroupRole.getKey(), roleToString(role));
 	if (OperationParam::isOptionalParamValid(jsonAttributes))
-		message->SetObjectField(OperationParam::GroupAttributes.getValue(), JsonUtil::jsonStringToValue(jsonAttributes));
+		message->SetObjectField(OperationParam::GroupAttributes.getKey(), JsonUtil::jsonStringToValue(jsonAttributes));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::InviteGroupMember, message, callback);
 	_client->sendRequest(sc);
@@ -224,7 +224,7 @@ void BrainCloudGroup::inviteGroupMember(const FString &groupId, const FString &p
 void BrainCloudGroup::joinGroup(const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::JoinGroup, message, callback);
 	_client->sendRequest(sc);
@@ -233,7 +233,7 @@ void BrainCloudGroup::joinGroup(const FString &groupId, IServerCallback *callbac
 void BrainCloudGroup::leaveGroup(const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::LeaveGroup, message, callback);
 	_client->sendRequest(sc);
@@ -242,7 +242,7 @@ void BrainCloudGroup::leaveGroup(const FString &groupId, IServerCallback *callba
 void BrainCloudGroup::listGroupsPage(const FString &jsonContext, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetObjectField(OperationParam::GroupContext.getValue(), JsonUtil::jsonStringToValue(jsonContext));
+	message->SetObjectField(OperationParam::GroupContext.getKey(), JsonUtil::jsonStringToValue(jsonContext));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ListGroupsPage, message, callback);
 	_client->sendRequest(sc);
@@ -251,8 +251,8 @@ void BrainCloudGroup::listGroupsPage(const FString &jsonContext, IServerCallback
 void BrainCloudGroup::listGroupsPageByOffset(const FString &encodedContext, int32 pageOffset, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupContext.getValue(), encodedContext);
-	message->SetNumberField(OperationParam::GroupPageOffset.getValue(), pageOffset);
+	message->SetStringField(OperationParam::GroupContext.getKey(), encodedContext);
+	message->SetNumberField(OperationParam::GroupPageOffset.getKey(), pageOffset);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ListGroupsPageByOffset, message, callback);
 	_client->sendRequest(sc);
@@ -261,7 +261,7 @@ void BrainCloudGroup::listGroupsPageByOffset(const FString &encodedContext, int3
 void BrainCloudGroup::listGroupsWithMember(const FString &profileId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ListGroupsWithMember, message, callback);
 	_client->sendRequest(sc);
@@ -270,7 +270,7 @@ void BrainCloudGroup::listGroupsWithMember(const FString &profileId, IServerCall
 void BrainCloudGroup::readGroup(const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ReadGroup, message, callback);
 	_client->sendRequest(sc);
@@ -279,7 +279,7 @@ void BrainCloudGroup::readGroup(const FString &groupId, IServerCallback *callbac
 void BrainCloudGroup::readGroupData(const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ReadGroupData, message, callback);
 	_client->sendRequest(sc);
@@ -288,7 +288,7 @@ void BrainCloudGroup::readGroupData(const FString &groupId, IServerCallback *cal
 void BrainCloudGroup::readGroupEntitiesPage(const FString &jsonContext, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetObjectField(OperationParam::GroupContext.getValue(), JsonUtil::jsonStringToValue(jsonContext));
+	message->SetObjectField(OperationParam::GroupContext.getKey(), JsonUtil::jsonStringToValue(jsonContext));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ReadGroupEntitiesPage, message, callback);
 	_client->sendRequest(sc);
@@ -297,8 +297,8 @@ void BrainCloudGroup::readGroupEntitiesPage(const FString &jsonContext, IServerC
 void BrainCloudGroup::readGroupEntitiesPageByOffset(const FString &encodedContext, int32 pageOffset, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupContext.getValue(), encodedContext);
-	message->SetNumberField(OperationParam::GroupPageOffset.getValue(), pageOffset);
+	message->SetStringField(OperationParam::GroupContext.getKey(), encodedContext);
+	message->SetNumberField(OperationParam::GroupPageOffset.getKey(), pageOffset);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ReadGroupEntitiesPageByOffset, message, callback);
 	_client->sendRequest(sc);
@@ -307,8 +307,8 @@ void BrainCloudGroup::readGroupEntitiesPageByOffset(const FString &encodedContex
 void BrainCloudGroup::readGroupEntity(const FString &groupId, const FString &entityId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupEntityId.getValue(), entityId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupEntityId.getKey(), entityId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ReadGroupEntity, message, callback);
 	_client->sendRequest(sc);
@@ -317,7 +317,7 @@ void BrainCloudGroup::readGroupEntity(const FString &groupId, const FString &ent
 void BrainCloudGroup::readGroupMembers(const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::ReadGroupMembers, message, callback);
 	_client->sendRequest(sc);
@@ -326,7 +326,7 @@ void BrainCloudGroup::readGroupMembers(const FString &groupId, IServerCallback *
 void BrainCloudGroup::rejectGroupInvitation(const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::RejectGroupInvitation, message, callback);
 	_client->sendRequest(sc);
@@ -335,8 +335,8 @@ void BrainCloudGroup::rejectGroupInvitation(const FString &groupId, IServerCallb
 void BrainCloudGroup::rejectGroupJoinRequest(const FString &groupId, const FString &profileId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::RejectGroupJoinRequest, message, callback);
 	_client->sendRequest(sc);
@@ -345,8 +345,8 @@ void BrainCloudGroup::rejectGroupJoinRequest(const FString &groupId, const FStri
 void BrainCloudGroup::removeGroupMember(const FString &groupId, const FString &profileId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::RemoveGroupMember, message, callback);
 	_client->sendRequest(sc);
@@ -355,9 +355,9 @@ void BrainCloudGroup::removeGroupMember(const FString &groupId, const FString &p
 void BrainCloudGroup::updateGroupData(const FString &groupId, int32 version, const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::GroupVersion.getValue(), version);
-	message->SetObjectField(OperationParam::GroupData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::GroupVersion.getKey(), version);
+	message->SetObjectField(OperationParam::GroupData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::UpdateGroupData, message, callback);
 	_client->sendRequest(sc);
@@ -366,11 +366,11 @@ void BrainCloudGroup::updateGroupData(const FString &groupId, int32 version, con
 void BrainCloudGroup::updateGroupEntityData(const FString &groupId, const FString &entityId, int32 version, const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupEntityId.getValue(), entityId);
-	message->SetNumberField(OperationParam::GroupVersion.getValue(), version);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupEntityId.getKey(), entityId);
+	message->SetNumberField(OperationParam::GroupVersion.getKey(), version);
 	if (OperationParam::isOptionalParamValid(jsonData))
-		message->SetObjectField(OperationParam::GroupData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::GroupData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::UpdateGroupEntity, message, callback);
 	_client->sendRequest(sc);
@@ -379,11 +379,11 @@ void BrainCloudGroup::updateGroupEntityData(const FString &groupId, const FStrin
 void BrainCloudGroup::updateGroupMember(const FString &groupId, const FString &profileId, ERole role, const FString &jsonAttributes, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupProfileId.getValue(), profileId);
-	message->SetStringField(OperationParam::GroupRole.getValue(), roleToString(role));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupProfileId.getKey(), profileId);
+	message->SetStringField(OperationParam::GroupRole.getKey(), roleToString(role));
 	if (OperationParam::isOptionalParamValid(jsonAttributes))
-		message->SetObjectField(OperationParam::GroupAttributes.getValue(), JsonUtil::jsonStringToValue(jsonAttributes));
+		message->SetObjectField(OperationParam::GroupAttributes.getKey(), JsonUtil::jsonStringToValue(jsonAttributes));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::UpdateGroupMember, message, callback);
 	_client->sendRequest(sc);
@@ -392,8 +392,8 @@ void BrainCloudGroup::updateGroupMember(const FString &groupId, const FString &p
 void BrainCloudGroup::updateGroupName(const FString &groupId, const FString &name, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::GroupName.getValue(), name);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::GroupName.getKey(), name);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::UpdateGroupName, message, callback);
 	_client->sendRequest(sc);
@@ -402,8 +402,8 @@ void BrainCloudGroup::updateGroupName(const FString &groupId, const FString &nam
 void BrainCloudGroup::setGroupOpen(const FString &groupId, bool isOpenGroup, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetBoolField(OperationParam::GroupIsOpenGroup.getValue(), isOpenGroup);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetBoolField(OperationParam::GroupIsOpenGroup.getKey(), isOpenGroup);
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::SetGroupOpen, message, callback);
 	_client->sendRequest(sc);
@@ -412,10 +412,10 @@ void BrainCloudGroup::setGroupOpen(const FString &groupId, bool isOpenGroup, ISe
 void BrainCloudGroup::updateGroupSummaryData(const FString &groupId, int32 version,  const FString &jsonSummaryData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::GroupVersion.getValue(), version);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::GroupVersion.getKey(), version);
 	if (OperationParam::isOptionalParamValid(jsonSummaryData))
-		message->SetObjectField(OperationParam::GroupSummaryData.getValue(), JsonUtil::jsonStringToValue(jsonSummaryData));
+		message->SetObjectField(OperationParam::GroupSummaryData.getKey(), JsonUtil::jsonStringToValue(jsonSummaryData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::UpdateGroupSummaryData, message, callback);
 	_client->sendRequest(sc);
@@ -425,8 +425,8 @@ void BrainCloudGroup::getRandomGroupsMatching(const FString &jsonWhere, int32 ma
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 	if (OperationParam::isOptionalParamValid(jsonWhere))
-		message->SetObjectField(OperationParam::GroupWhere.getValue(), JsonUtil::jsonStringToValue(jsonWhere));
-	message->SetNumberField(OperationParam::GroupMaxReturn.getValue(), maxReturn);
+		message->SetObjectField(OperationParam::GroupWhere.getKey(), JsonUtil::jsonStringToValue(jsonWhere));
+	message->SetNumberField(OperationParam::GroupMaxReturn.getKey(), maxReturn);
 	
 	ServerCall *sc = new ServerCall(ServiceName::Group, ServiceOperation::GetRandomGroupsMatching, message, callback);
 	_client->sendRequest(sc);
@@ -12,8 +12,8 @@ BrainCloudIdentity::BrainCloudIdentity(BrainCloudClient *client) : _client(clien
 void BrainCloudIdentity::attachBlockchainIdentity(const FString &blockchainConfig, const FString &publicKey, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceBlockchainConfig.getValue(), blockchainConfig);
-	message->SetStringField(OperationParam::IdentityServicePublicKey.getValue(), publicKey);
+	message->SetStringField(OperationParam::IdentityServiceBlockchainConfig.getKey(), blockchainConfig);
+	message->SetStringField(OperationParam::IdentityServicePublicKey.getKey(), publicKey);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::AttachBlockchainIdentity, message, callback);
 	_client->sendRequest(sc);
@@ -22,7 +22,7 @@ void BrainCloudIdentity::attachBlockchainIdentity(const FString &blockchainConfi
 void BrainCloudIdentity::detachBlockchainIdentity(const FString &blockchainConfig, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceBlockchainConfig.getValue(), blockchainConfig);
+	message->SetStringField(OperationParam::IdentityServiceBlockchainConfig.getKey(), blockchainConfig);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::DetachBlockchainIdentity, message, callback);
 	_client->sendRequest(sc);
@@ -195,7 +195,7 @@ void BrainCloudIdentity::switchToSingletonChildProfile(const FString &childGameI
 void BrainCloudIdentity::switchToParentProfile(const FString &parentLevelName, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::AuthenticationServiceAuthenticationLevelName.getValue(), parentLevelName);
+	message->SetStringField(OperationParam::AuthenticationServiceAuthenticationLevelName.getKey(), parentLevelName);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::SwitchToParentProfile, message, callback);
 	_client->sendRequest(sc);
@@ -204,7 +204,7 @@ void BrainCloudIdentity::switchToParentProfile(const FString &parentLevelName, I
 void BrainCloudIdentity::getChildProfiles(bool includeSummaryData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetBoolField(OperationParam::PlayerStateServiceIncludeSummaryData.getValue(), includeSummaryData);
+	message->SetBoolField(OperationParam::PlayerStateServiceIncludeSummaryData.getKey(), includeSummaryData);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::GetChildProfiles, message, callback);
 	_client->sendRequest(sc);
@@ -227,9 +227,9 @@ void BrainCloudIdentity::getExpiredIdentities(IServerCallback *callback)
 void BrainCloudIdentity::refreshIdentity(const FString &externalId, const FString &authenticationToken, EBCAuthType authenticationType, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getValue(), authenticationToken);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getKey(), authenticationToken);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::RefreshIdentity, message, callback);
 	_client->sendRequest(sc);
@@ -239,10 +239,10 @@ void BrainCloudIdentity::changeEmailIdentity(const FString &oldEmailAddress, con
 											 bool updateContactEmail, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceOldEmailAddress.getValue(), oldEmailAddress);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getValue(), password);
-	message->SetStringField(OperationParam::IdentityServiceNewEmailAddress.getValue(), newEmailAddress);
-	message->SetBoolField(OperationParam::IdentityServiceUpdateContactEmail.getValue(), updateContactEmail);
+	message->SetStringField(OperationParam::IdentityServiceOldEmailAddress.getKey(), oldEmailAddress);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getKey(), password);
+	message->SetStringField(OperationParam::IdentityServiceNewEmailAddress.getKey(), newEmailAddress);
+	message->SetBoolField(OperationParam::IdentityServiceUpdateContactEmail.getKey(), updateContactEmail);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::ChangeEmailIdentity, message, callback);
 	_client->sendRequest(sc);
@@ -252,14 +252,14 @@ void BrainCloudIdentity::attachParentWithIdentity(const FString &externalId, con
 												  const FString &externalAuthName, bool forceCreate, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getValue(), authenticationToken);
-	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
-	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getValue(), forceCreate);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getKey(), authenticationToken);
+	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
+	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getKey(), forceCreate);
 
 	if (OperationParam::isOptionalParamValid(externalAuthName))
 	{
-		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalAuthName.getValue(), externalAuthName);
+		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalAuthName.getKey(), externalAuthName);
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::AttachParentWithIdentity, message, callback);
@@ -277,15 +277,15 @@ void BrainCloudIdentity::attachPeerProfile(const FString &peer, const FString &e
 										   const FString &externalAuthName, bool forceCreate, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::Peer.getValue(), peer);
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getValue(), authenticationToken);
-	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
-	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getValue(), forceCreate);
+	message->SetStringField(OperationParam::Peer.getKey(), peer);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getKey(), authenticationToken);
+	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
+	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getKey(), forceCreate);
 
 	if (OperationParam::isOptionalParamValid(externalAuthName))
 	{
-		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalAuthName.getValue(), externalAuthName);
+		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateExternalAuthName.getKey(), externalAuthName);
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::AttachPeerProfile, message, callback);
@@ -295,7 +295,7 @@ void BrainCloudIdentity::attachPeerProfile(const FString &peer, const FString &e
 void BrainCloudIdentity::detachPeer(const FString &peer, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::Peer.getValue(), peer);
+	message->SetStringField(OperationParam::Peer.getKey(), peer);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::DetachPeer, message, callback);
 	_client->sendRequest(sc);
@@ -311,7 +311,7 @@ void BrainCloudIdentity::getPeerProfiles(IServerCallback *callback)
 void BrainCloudIdentity::attachNonLoginUniversalId(const FString &externalId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::AttachNonLoginUniversalId, message, callback);
 	_client->sendRequest(sc);
 }
@@ -319,7 +319,7 @@ void BrainCloudIdentity::attachNonLoginUniversalId(const FString &externalId, IS
 void BrainCloudIdentity::updateUniversalIDLogin(const FString &externalId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::UpdateUniversalIdLogin, message, callback);
 	_client->sendRequest(sc);
 }
@@ -328,9 +328,9 @@ void BrainCloudIdentity::updateUniversalIDLogin(const FString &externalId, IServ
 void BrainCloudIdentity::attachIdentity(const FString &externalId, const FString &authenticationToken, EBCAuthType authenticationType, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getValue(), authenticationToken);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getKey(), authenticationToken);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::Attach, message, callback);
 	_client->sendRequest(sc);
@@ -339,9 +339,9 @@ void BrainCloudIdentity::attachIdentity(const FString &externalId, const FString
 void BrainCloudIdentity::mergeIdentity(const FString &externalId, const FString &authenticationToken, EBCAuthType authenticationType, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getValue(), authenticationToken);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateAuthenticationToken.getKey(), authenticationToken);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::Merge, message, callback);
 	_client->sendRequest(sc);
@@ -350,9 +350,9 @@ void BrainCloudIdentity::mergeIdentity(const FString &externalId, const FString
 void BrainCloudIdentity::detachIdentity(const FString &externalId, EBCAuthType authenticationType, bool continueAnon, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::IdentityServiceExternalId.getValue(), externalId);
-	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getValue(), BCAuthType::EnumToString(authenticationType));
-	message->SetBoolField(OperationParam::IdentityServiceConfirmAnonymous.getValue(), continueAnon);
+	message->SetStringField(OperationParam::IdentityServiceExternalId.getKey(), externalId);
+	message->SetStringField(OperationParam::IdentityServiceAuthenticationType.getKey(), BCAuthType::EnumToString(authenticationType));
+	message->SetBoolField(OperationParam::IdentityServiceConfirmAnonymous.getKey(), continueAnon);
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::Detach, message, callback);
 	_client->sendRequest(sc);
@@ -365,17 +365,17 @@ void BrainCloudIdentity::switchToChildProfile(const FString &childProfileId, con
 
 	if (OperationParam::isOptionalParamValid(childProfileId))
 	{
-		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateProfileId.getValue(), childProfileId);
+		message->SetStringField(OperationParam::AuthenticateServiceAuthenticateProfileId.getKey(), childProfileId);
 	}
 
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getValue(), childGameId);
-	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getValue(), forceCreate);
-	message->SetBoolField(OperationParam::IdentityServiceForceSingleton.getValue(), forceSingleton);
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateGameId.getKey(), childGameId);
+	message->SetBoolField(OperationParam::AuthenticateServiceAuthenticateForceCreate.getKey(), forceCreate);
+	message->SetBoolField(OperationParam::IdentityServiceForceSingleton.getKey(), forceSingleton);
 
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateReleasePlatform.getValue(), brainCloudClientRef->getReleasePlatform());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateCountryCode.getValue(), "");		//brainCloudClientRef->getCountryCode());
-	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateLanguageCode.getValue(), "");	//brainCloudClientRef->getLanguageCode());
-	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTimeZoneOffset.getValue(), 0.0); // brainCloudClientRef->getTimezoneOffset());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateReleasePlatform.getKey(), brainCloudClientRef->getReleasePlatform());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateCountryCode.getKey(), "");		//brainCloudClientRef->getCountryCode());
+	message->SetStringField(OperationParam::AuthenticateServiceAuthenticateLanguageCode.getKey(), "");	//brainCloudClientRef->getLanguageCode());
+	message->SetNumberField(OperationParam::AuthenticateServiceAuthenticateTimeZoneOffset.getKey(), 0.0); // brainCloudClientRef->getTimezoneOffset());
 
 	ServerCall *sc = new ServerCall(ServiceName::Identity, ServiceOperation::SwitchToChildProfile, message, callback);
 	_client->sendRequest(sc);
@@ -14,7 +14,7 @@ BrainCloudItemCatalog::BrainCloudItemCatalog(BrainCloudClient *client) : _client
 	{
 		TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-		message->SetStringField(OperationParam::ItemCatalogServiceDefId.getValue(), defId);
+		message->SetStringField(OperationParam::ItemCatalogServiceDefId.getKey(), defId);
 		
 		ServerCall *sc = new ServerCall(ServiceName::ItemCatalog, ServiceOperation::GetCatalogItemDefinition, message, callback);
 		_client->sendRequest(sc);
@@ -24,7 +24,7 @@ BrainCloudItemCatalog::BrainCloudItemCatalog(BrainCloudClient *client) : _client
 	{
 		TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 		
-		message->SetObjectField(OperationParam::ItemCatalogServiceContext.getValue(), JsonUtil::jsonStringToValue(context));
+		message->SetObjectField(OperationParam::ItemCatalogServiceContext.getKey(), JsonUtil::jsonStringToValue(context));
 		
 		ServerCall *sc = new ServerCall(ServiceName::ItemCatalog, ServiceOperation::GetCatalogItemsPage, message, callback);
 		_client->sendRequest(sc);
@@ -34,8 +34,8 @@ BrainCloudItemCatalog::BrainCloudItemCatalog(BrainCloudClient *client) : _client
 	{
 		TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-		message->SetStringField(OperationParam::ItemCatalogServiceContext.getValue(), context);
-		message->SetNumberField(OperationParam::ItemCatalogServicePageOffset.getValue(), pageOffset);
+		message->SetStringField(OperationParam::ItemCatalogServiceContext.getKey(), context);
+		message->SetNumberField(OperationParam::ItemCatalogServicePageOffset.getKey(), pageOffset);
 		
 		ServerCall *sc = new ServerCall(ServiceName::ItemCatalog, ServiceOperation::GetCatalogItemsPageOffset, message, callback);
 		_client->sendRequest(sc);
@@ -12,8 +12,8 @@ BrainCloudLeaderboard::BrainCloudLeaderboard(BrainCloudClient *client) : _client
 void BrainCloudLeaderboard::getSocialLeaderboard(const FString &leaderboardId, bool replaceName, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetBoolField(OperationParam::LeaderboardServiceReplaceName.getValue(), replaceName);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetBoolField(OperationParam::LeaderboardServiceReplaceName.getKey(), replaceName);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetSocialLeaderboard, message, callback);
 	_client->sendRequest(sc);
@@ -22,9 +22,9 @@ void BrainCloudLeaderboard::getSocialLeaderboard(const FString &leaderboardId, b
 void BrainCloudLeaderboard::getSocialLeaderboardByVersion(const FString &leaderboardId, bool replaceName, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetBoolField(OperationParam::LeaderboardServiceReplaceName.getValue(), replaceName);
-	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetBoolField(OperationParam::LeaderboardServiceReplaceName.getKey(), replaceName);
+	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetSocialLeaderboardByVersion, message, callback);
 	_client->sendRequest(sc);
@@ -33,9 +33,9 @@ void BrainCloudLeaderboard::getSocialLeaderboardByVersion(const FString &leaderb
 void BrainCloudLeaderboard::getMultiSocialLeaderboard(const TArray<FString> &leaderboardIds, int32 leaderboardResultCount, bool replaceName, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::LeaderboardServiceLeaderboardIds.getValue(), JsonUtil::arrayToJsonArray(leaderboardIds));
-	message->SetNumberField(OperationParam::LeaderboardServiceLeaderboardResultCount.getValue(), leaderboardResultCount);
-	message->SetBoolField(OperationParam::LeaderboardServiceReplaceName.getValue(), replaceName);
+	message->SetArrayField(OperationParam::LeaderboardServiceLeaderboardIds.getKey(), JsonUtil::arrayToJsonArray(leaderboardIds));
+	message->SetNumberField(OperationParam::LeaderboardServiceLeaderboardResultCount.getKey(), leaderboardResultCount);
+	message->SetBoolField(OperationParam::LeaderboardServiceReplaceName.getKey(), replaceName);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetMultiSocialLeaderboard, message, callback);
 	_client->sendRequest(sc);
@@ -49,13 +49,13 @@ void BrainCloudLeaderboard::getGlobalLeaderboardPage(const FString &leaderboardI
 void BrainCloudLeaderboard::getGlobalLeaderboardPageByVersion(const FString &leaderboardId, ESortOrder sortOrder, int32 startIndex, int32 endIndex, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getValue(), leaderboardSortOrderToString(sortOrder));
-	message->SetNumberField(OperationParam::LeaderboardServiceStartIndex.getValue(), startIndex);
-	message->SetNumberField(OperationParam::LeaderboardServiceEndIndex.getValue(), endIndex);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getKey(), leaderboardSortOrderToString(sortOrder));
+	message->SetNumberField(OperationParam::LeaderboardServiceStartIndex.getKey(), startIndex);
+	message->SetNumberField(OperationParam::LeaderboardServiceEndIndex.getKey(), endIndex);
 
 	if (versionId != -1)
-		message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getValue(), versionId);
+		message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGlobalLeaderboardPage, message, callback);
 	_client->sendRequest(sc);
@@ -69,13 +69,13 @@ void BrainCloudLeaderboard::getGlobalLeaderboardView(const FString &leaderboardI
 void BrainCloudLeaderboard::getGlobalLeaderboardViewByVersion(const FString &leaderboardId, ESortOrder sortOrder, int32 beforeCount, int32 afterCount, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getValue(), leaderboardSortOrderToString(sortOrder));
-	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getValue(), beforeCount);
-	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getValue(), afterCount);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getKey(), leaderboardSortOrderToString(sortOrder));
+	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getKey(), beforeCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getKey(), afterCount);
 
 	if (versionId != -1)
-		message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getValue(), versionId);
+		message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGlobalLeaderboardView, message, callback);
 	_client->sendRequest(sc);
@@ -84,7 +84,7 @@ void BrainCloudLeaderboard::getGlobalLeaderboardViewByVersion(const FString &lea
 void BrainCloudLeaderboard::getGlobalLeaderboardEntryCount(const FString &leaderboardId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGlobalLeaderboardEntryCount, message, callback);
 	_client->sendRequest(sc);
@@ -93,7 +93,7 @@ void BrainCloudLeaderboard::getGlobalLeaderboardEntryCount(const FString &leader
 void BrainCloudLeaderboard::getGlobalLeaderboardVersions(const FString &leaderboardId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGlobalLeaderboardVersions, message, callback);
 	_client->sendRequest(sc);
@@ -102,9 +102,9 @@ void BrainCloudLeaderboard::getGlobalLeaderboardVersions(const FString &leaderbo
 void BrainCloudLeaderboard::postScore(const FString &leaderboardId, int32 score, const FString &jsonOtherData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonOtherData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonOtherData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScore, message, callback);
 	_client->sendRequest(sc);
@@ -115,17 +115,17 @@ void BrainCloudLeaderboard::postScoreToDynamicLeaderboard(const FString &leaderb
 														  int32 retainedCount, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getValue(), *leaderboardTypeToString(leaderboardType));
-	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getValue(), *leaderboardRotationTypeToString(rotationType));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getKey(), *leaderboardTypeToString(leaderboardType));
+	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getKey(), *leaderboardRotationTypeToString(rotationType));
 
 	if (rotationStart > FDateTime::Now())
-		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getValue(), rotationStart.ToUnixTimestamp() * 1000);
+		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getKey(), rotationStart.ToUnixTimestamp() * 1000);
 
-	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getValue(), retainedCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getKey(), retainedCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScoreDynamic, message, callback);
 	_client->sendRequest(sc);
@@ -135,17 +135,17 @@ void BrainCloudLeaderboard::postScoreToDynamicLeaderboardDays(const FString &lea
 															  ESocialLeaderboardType leaderboardType, const FDateTime &rotationStart, int32 retainedCount, int32 numDaysToRotate, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonData));
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getValue(), *leaderboardTypeToString(leaderboardType));
-	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getValue(), "DAYS");
-	message->SetNumberField(OperationParam::NumDaysToRotate.getValue(), numDaysToRotate);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getKey(), *leaderboardTypeToString(leaderboardType));
+	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getKey(), "DAYS");
+	message->SetNumberField(OperationParam::NumDaysToRotate.getKey(), numDaysToRotate);
 
 	if (rotationStart > FDateTime::Now())
-		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getValue(), rotationStart.ToUnixTimestamp() * 1000);
+		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getKey(), rotationStart.ToUnixTimestamp() * 1000);
 
-	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getValue(), retainedCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getKey(), retainedCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScoreDynamic, message, callback);
 	_client->sendRequest(sc);
@@ -156,17 +156,17 @@ void BrainCloudLeaderboard::postScoreToDynamicLeaderboardUTC(const FString &lead
 														  int32 retainedCount, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonData));
 
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getValue(), *leaderboardTypeToString(leaderboardType));
-	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getValue(), *leaderboardRotationTypeToString(rotationType));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getKey(), *leaderboardTypeToString(leaderboardType));
+	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getKey(), *leaderboardRotationTypeToString(rotationType));
 
 //	if (rotationStart > FDateTime::Now())
-		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getValue(), rotationStart);
+		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getKey(), rotationStart);
 
-	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getValue(), retainedCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getKey(), retainedCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScoreDynamic, message, callback);
 	_client->sendRequest(sc);
@@ -176,17 +176,17 @@ void BrainCloudLeaderboard::postScoreToDynamicLeaderboardDaysUTC(const FString &
 															  ESocialLeaderboardType leaderboardType, const int64 &rotationStart, int32 retainedCount, int32 numDaysToRotate, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonData));
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getValue(), *leaderboardTypeToString(leaderboardType));
-	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getValue(), "DAYS");
-	message->SetNumberField(OperationParam::NumDaysToRotate.getValue(), numDaysToRotate);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getKey(), *leaderboardTypeToString(leaderboardType));
+	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getKey(), "DAYS");
+	message->SetNumberField(OperationParam::NumDaysToRotate.getKey(), numDaysToRotate);
 
 	//if (rotationStart > FDateTime::Now())
-		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getValue(), rotationStart);
+		message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getKey(), rotationStart);
 
-	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getValue(), retainedCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceRetainedCount.getKey(), retainedCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScoreDynamic, message, callback);
 	_client->sendRequest(sc);
@@ -195,8 +195,8 @@ void BrainCloudLeaderboard::postScoreToDynamicLeaderboardDaysUTC(const FString &
 void BrainCloudLeaderboard::removePlayerScore(const FString &leaderboardId, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::ProfileIds.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::ProfileIds.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::RemovePlayerScore, message, callback);
 	_client->sendRequest(sc);
@@ -205,8 +205,8 @@ void BrainCloudLeaderboard::removePlayerScore(const FString &leaderboardId, int3
 void BrainCloudLeaderboard::playerTournamentReward(const FString &eventName, uint64 multiplier, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceEventName.getValue(), eventName);
-	message->SetNumberField(OperationParam::LeaderboardServiceEventMultiplier.getValue(), multiplier);
+	message->SetStringField(OperationParam::LeaderboardServiceEventName.getKey(), eventName);
+	message->SetNumberField(OperationParam::LeaderboardServiceEventMultiplier.getKey(), multiplier);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::RewardTournament, message, callback);
 	_client->sendRequest(sc);
@@ -215,8 +215,8 @@ void BrainCloudLeaderboard::playerTournamentReward(const FString &eventName, uin
 void BrainCloudLeaderboard::getGroupSocialLeaderboard(const FString &leaderboardId, const FString &groupId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGroupSocialLeaderboard, message, callback);
 	_client->sendRequest(sc);
@@ -225,9 +225,9 @@ void BrainCloudLeaderboard::getGroupSocialLeaderboard(const FString &leaderboard
 void BrainCloudLeaderboard::getGroupSocialLeaderboardByVersion(const FString &leaderboardId, const FString &groupId, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGroupSocialLeaderboardByVersion, message, callback);
 	_client->sendRequest(sc);
@@ -236,8 +236,8 @@ void BrainCloudLeaderboard::getGroupSocialLeaderboardByVersion(const FString &le
 void BrainCloudLeaderboard::getPlayersSocialLeaderboard(const FString &leaderboardId, const TArray<FString> profileIds, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetArrayField(OperationParam::ProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetArrayField(OperationParam::ProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetPlayersSocialLeaderboard, message, callback);
 	_client->sendRequest(sc);
@@ -246,9 +246,9 @@ void BrainCloudLeaderboard::getPlayersSocialLeaderboard(const FString &leaderboa
 void BrainCloudLeaderboard::getPlayersSocialLeaderboardByVersion(const FString &leaderboardId, const TArray<FString> profileIds, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetArrayField(OperationParam::ProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
-	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetArrayField(OperationParam::ProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
+	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetPlayersSocialLeaderboardByVersion, message, callback);
 	_client->sendRequest(sc);
@@ -264,8 +264,8 @@ void BrainCloudLeaderboard::listAllLeaderboards(IServerCallback *callback)
 void BrainCloudLeaderboard::getPlayerScore(const FString &leaderboardId, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::ProfileIds.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::ProfileIds.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetPlayerScore, message, callback);
 	_client->sendRequest(sc);
@@ -274,7 +274,7 @@ void BrainCloudLeaderboard::getPlayerScore(const FString &leaderboardId, int32 v
 void BrainCloudLeaderboard::getPlayerScoresFromLeaderboards(const TArray<FString> leaderboardIds, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::LeaderboardServiceLeaderboardIds.getValue(), JsonUtil::arrayToJsonArray(leaderboardIds));
+	message->SetArrayField(OperationParam::LeaderboardServiceLeaderboardIds.getKey(), JsonUtil::arrayToJsonArray(leaderboardIds));
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetPlayerScoresFromLeaderboards, message, callback);
 	_client->sendRequest(sc);
@@ -283,10 +283,10 @@ void BrainCloudLeaderboard::getPlayerScoresFromLeaderboards(const TArray<FString
 void BrainCloudLeaderboard::postScoreToGroupLeaderboard(const FString &leaderboardId, const FString &groupId, int32 score, const FString &jsonOtherData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonOtherData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonOtherData));
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScoreToGroupLeaderboard, message, callback);
 	_client->sendRequest(sc);
@@ -296,17 +296,17 @@ void BrainCloudLeaderboard::postScoreToDynamicGroupLeaderboard(const FString &le
 																ERotationType rotationType, const FDateTime &rotationStart, int32 retainedCount, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonOtherData));
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getValue(), *leaderboardTypeToString(leaderboardType));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonOtherData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getKey(), *leaderboardTypeToString(leaderboardType));
 
 	if (rotationStart > FDateTime::Now())
-	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getValue(), *leaderboardRotationTypeToString(rotationType));
+	message->SetStringField(OperationParam::LeaderboardServiceRotationType.getKey(), *leaderboardRotationTypeToString(rotationType));
 
-	message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getValue(), rotationStart.ToUnixTimestamp() * 1000);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), retainedCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getKey(), rotationStart.ToUnixTimestamp() * 1000);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), retainedCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScoreToDynamicGroupLeaderboard, message, callback);
 	_client->sendRequest(sc);
@@ -316,17 +316,17 @@ void BrainCloudLeaderboard::postScoreToDynamicGroupLeaderboardUTC(const FString
 																ERotationType rotationType, const int64 &rotationStart, int32 retainedCount, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetObjectField(OperationParam::LeaderboardServiceData.getValue(), JsonUtil::jsonStringToValue(jsonOtherData));
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getValue(), *leaderboardTypeToString(leaderboardType));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetObjectField(OperationParam::LeaderboardServiceData.getKey(), JsonUtil::jsonStringToValue(jsonOtherData));
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardType.getKey(), *leaderboardTypeToString(leaderboardType));
 
 	// if (rotationStart > FDateTime::Now())
-	// message->SetStringField(OperationParam::LeaderboardServiceRotationType.getValue(), *leaderboardRotationTypeToString(rotationType));
+	// message->SetStringField(OperationParam::LeaderboardServiceRotationType.getKey(), *leaderboardRotationTypeToString(rotationType));
 
-	message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getValue(), rotationStart);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), retainedCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceRotationResetTime.getKey(), rotationStart);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), retainedCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::PostScoreToDynamicGroupLeaderboard, message, callback);
 	_client->sendRequest(sc);
@@ -335,10 +335,10 @@ void BrainCloudLeaderboard::postScoreToDynamicGroupLeaderboardUTC(const FString
 void BrainCloudLeaderboard::removeGroupScore(const FString &leaderboardId, const FString &groupId, int32 score, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::LeaderboardServiceScore.getValue(), score);
-	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::LeaderboardServiceScore.getKey(), score);
+	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::RemoveGroupScore, message, callback);
 	_client->sendRequest(sc);
@@ -347,11 +347,11 @@ void BrainCloudLeaderboard::removeGroupScore(const FString &leaderboardId, const
 void BrainCloudLeaderboard::getGroupLeaderboardView(const FString &leaderboardId, const FString &groupId, ESortOrder sortOrder, int32 beforeCount, int32 afterCount, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getValue(), leaderboardSortOrderToString(sortOrder));
-	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getValue(), beforeCount);
-	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getValue(), afterCount);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getKey(), leaderboardSortOrderToString(sortOrder));
+	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getKey(), beforeCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getKey(), afterCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGroupLeaderboardView, message, callback);
 	_client->sendRequest(sc);
@@ -360,12 +360,12 @@ void BrainCloudLeaderboard::getGroupLeaderboardView(const FString &leaderboardId
 void BrainCloudLeaderboard::getGroupLeaderboardViewByVersion(const FString &leaderboardId, const FString &groupId, int32 versionId, ESortOrder sortOrder, int32 beforeCount, int32 afterCount, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getValue(), versionId);
-	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getValue(), leaderboardSortOrderToString(sortOrder));
-	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getValue(), beforeCount);
-	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getValue(), afterCount);
+	message->SetStringField(OperationParam::LeaderboardServiceLeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::LeaderboardServiceVersionId.getKey(), versionId);
+	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getKey(), leaderboardSortOrderToString(sortOrder));
+	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getKey(), beforeCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getKey(), afterCount);
 
 	ServerCall *sc = new ServerCall(ServiceName::Leaderboard, ServiceOperation::GetGroupLeaderboardView, message, callback);
 	_client->sendRequest(sc);
@@ -27,16 +27,16 @@ void BrainCloudLobby::findLobby(const FString &in_roomType, int32 in_rating, int
                                 IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyRoomType.getValue(), in_roomType);
-    message->SetNumberField(OperationParam::LobbyRating.getValue(), in_rating);
-    message->SetNumberField(OperationParam::LobbyMaxSteps.getValue(), in_maxSteps);
-    message->SetObjectField(OperationParam::LobbyAlgorithm.getValue(), JsonUtil::jsonStringToValue(in_algoJson));
-    message->SetObjectField(OperationParam::LobbyFilterJson.getValue(), JsonUtil::jsonStringToValue(in_filterJson));
-    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getValue(), in_timeoutSecs);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetStringField(OperationParam::LobbyRoomType.getKey(), in_roomType);
+    message->SetNumberField(OperationParam::LobbyRating.getKey(), in_rating);
+    message->SetNumberField(OperationParam::LobbyMaxSteps.getKey(), in_maxSteps);
+    message->SetObjectField(OperationParam::LobbyAlgorithm.getKey(), JsonUtil::jsonStringToValue(in_algoJson));
+    message->SetObjectField(OperationParam::LobbyFilterJson.getKey(), JsonUtil::jsonStringToValue(in_filterJson));
+    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getKey(), in_timeoutSecs);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::FindLobby, message, in_callback);
     _client->sendRequest(sc);
@@ -48,16 +48,16 @@ void BrainCloudLobby::findLobbyWithPingData(const FString &in_roomType, int32 in
                                 IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyRoomType.getValue(), in_roomType);
-    message->SetNumberField(OperationParam::LobbyRating.getValue(), in_rating);
-    message->SetNumberField(OperationParam::LobbyMaxSteps.getValue(), in_maxSteps);
-    message->SetObjectField(OperationParam::LobbyAlgorithm.getValue(), JsonUtil::jsonStringToValue(in_algoJson));
-    message->SetObjectField(OperationParam::LobbyFilterJson.getValue(), JsonUtil::jsonStringToValue(in_filterJson));
-    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getValue(), in_timeoutSecs);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetStringField(OperationParam::LobbyRoomType.getKey(), in_roomType);
+    message->SetNumberField(OperationParam::LobbyRating.getKey(), in_rating);
+    message->SetNumberField(OperationParam::LobbyMaxSteps.getKey(), in_maxSteps);
+    message->SetObjectField(OperationParam::LobbyAlgorithm.getKey(), JsonUtil::jsonStringToValue(in_algoJson));
+    message->SetObjectField(OperationParam::LobbyFilterJson.getKey(), JsonUtil::jsonStringToValue(in_filterJson));
+    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getKey(), in_timeoutSecs);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     attachPingDataAndSend(message, ServiceOperation::FindLobbyWithPingData, in_callback);
 }
@@ -67,15 +67,15 @@ void BrainCloudLobby::createLobby(const FString &in_roomType, int32 in_rating, i
                                   const FString &in_configJson, const TArray<FString> &in_otherUserCxIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyRoomType.getValue(), in_roomType);
-    message->SetNumberField(OperationParam::LobbyRating.getValue(), in_rating);
-    message->SetNumberField(OperationParam::LobbyMaxSteps.getValue(), in_maxSteps);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
+    message->SetStringField(OperationParam::LobbyRoomType.getKey(), in_roomType);
+    message->SetNumberField(OperationParam::LobbyRating.getKey(), in_rating);
+    message->SetNumberField(OperationParam::LobbyMaxSteps.getKey(), in_maxSteps);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
 
-    message->SetObjectField(OperationParam::LobbySettings.getValue(), JsonUtil::jsonStringToValue(in_configJson));
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetObjectField(OperationParam::LobbySettings.getKey(), JsonUtil::jsonStringToValue(in_configJson));
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::CreateLobby, message, in_callback);
     _client->sendRequest(sc);
@@ -86,15 +86,15 @@ void BrainCloudLobby::createLobbyWithPingData(const FString &in_roomType, int32
                                   const FString &in_configJson, const TArray<FString> &in_otherUserCxIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyRoomType.getValue(), in_roomType);
-    message->SetNumberField(OperationParam::LobbyRating.getValue(), in_rating);
-    message->SetNumberField(OperationParam::LobbyMaxSteps.getValue(), in_maxSteps);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
+    message->SetStringField(OperationParam::LobbyRoomType.getKey(), in_roomType);
+    message->SetNumberField(OperationParam::LobbyRating.getKey(), in_rating);
+    message->SetNumberField(OperationParam::LobbyMaxSteps.getKey(), in_maxSteps);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
 
-    message->SetObjectField(OperationParam::LobbySettings.getValue(), JsonUtil::jsonStringToValue(in_configJson));
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetObjectField(OperationParam::LobbySettings.getKey(), JsonUtil::jsonStringToValue(in_configJson));
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     attachPingDataAndSend(message, ServiceOperation::CreateLobbyWithPingData, in_callback);
 }
@@ -105,17 +105,17 @@ void BrainCloudLobby::findOrCreateLobby(const FString &in_roomType, int32 in_rat
                                         const FString &in_configJson, const TArray<FString> &in_otherUserCxIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyRoomType.getValue(), in_roomType);
-    message->SetNumberField(OperationParam::LobbyRating.getValue(), in_rating);
-    message->SetNumberField(OperationParam::LobbyMaxSteps.getValue(), in_maxSteps);
-    message->SetObjectField(OperationParam::LobbyAlgorithm.getValue(), JsonUtil::jsonStringToValue(in_algoJson));
-    message->SetObjectField(OperationParam::LobbyFilterJson.getValue(), JsonUtil::jsonStringToValue(in_filterJson));
-    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getValue(), in_timeoutSecs);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
-    message->SetObjectField(OperationParam::LobbySettings.getValue(), JsonUtil::jsonStringToValue(in_configJson));
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetStringField(OperationParam::LobbyRoomType.getKey(), in_roomType);
+    message->SetNumberField(OperationParam::LobbyRating.getKey(), in_rating);
+    message->SetNumberField(OperationParam::LobbyMaxSteps.getKey(), in_maxSteps);
+    message->SetObjectField(OperationParam::LobbyAlgorithm.getKey(), JsonUtil::jsonStringToValue(in_algoJson));
+    message->SetObjectField(OperationParam::LobbyFilterJson.getKey(), JsonUtil::jsonStringToValue(in_filterJson));
+    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getKey(), in_timeoutSecs);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
+    message->SetObjectField(OperationParam::LobbySettings.getKey(), JsonUtil::jsonStringToValue(in_configJson));
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::FindOrCreateLobby, message, in_callback);
     _client->sendRequest(sc);
@@ -127,17 +127,17 @@ void BrainCloudLobby::findOrCreateLobbyWithPingData(const FString &in_roomType,
                                         const FString &in_configJson, const TArray<FString> &in_otherUserCxIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyRoomType.getValue(), in_roomType);
-    message->SetNumberField(OperationParam::LobbyRating.getValue(), in_rating);
-    message->SetNumberField(OperationParam::LobbyMaxSteps.getValue(), in_maxSteps);
-    message->SetObjectField(OperationParam::LobbyAlgorithm.getValue(), JsonUtil::jsonStringToValue(in_algoJson));
-    message->SetObjectField(OperationParam::LobbyFilterJson.getValue(), JsonUtil::jsonStringToValue(in_filterJson));
-    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getValue(), in_timeoutSecs);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
-    message->SetObjectField(OperationParam::LobbySettings.getValue(), JsonUtil::jsonStringToValue(in_configJson));
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetStringField(OperationParam::LobbyRoomType.getKey(), in_roomType);
+    message->SetNumberField(OperationParam::LobbyRating.getKey(), in_rating);
+    message->SetNumberField(OperationParam::LobbyMaxSteps.getKey(), in_maxSteps);
+    message->SetObjectField(OperationParam::LobbyAlgorithm.getKey(), JsonUtil::jsonStringToValue(in_algoJson));
+    message->SetObjectField(OperationParam::LobbyFilterJson.getKey(), JsonUtil::jsonStringToValue(in_filterJson));
+    message->SetNumberField(OperationParam::LobbyTimeoutSeconds.getKey(), in_timeoutSecs);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
+    message->SetObjectField(OperationParam::LobbySettings.getKey(), JsonUtil::jsonStringToValue(in_configJson));
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     attachPingDataAndSend(message, ServiceOperation::FindOrCreateLobbyWithPingData, in_callback);
 }
@@ -145,7 +145,7 @@ void BrainCloudLobby::findOrCreateLobbyWithPingData(const FString &in_roomType,
 void BrainCloudLobby::getLobbyData(const FString &in_lobbyID, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::GetLobbyData, message, in_callback);
     _client->sendRequest(sc);
@@ -154,9 +154,9 @@ void BrainCloudLobby::getLobbyData(const FString &in_lobbyID, IServerCallback *i
 void BrainCloudLobby::updateReady(const FString &in_lobbyID, bool in_isReady, const FString &in_extraJson, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::UpdateReady, message, in_callback);
     _client->sendRequest(sc);
@@ -165,8 +165,8 @@ void BrainCloudLobby::updateReady(const FString &in_lobbyID, bool in_isReady, co
 void BrainCloudLobby::updateSettings(const FString &in_lobbyID, const FString &in_configJson, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
-    message->SetObjectField(OperationParam::LobbySettings.getValue(), JsonUtil::jsonStringToValue(in_configJson));
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
+    message->SetObjectField(OperationParam::LobbySettings.getKey(), JsonUtil::jsonStringToValue(in_configJson));
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::UpdateSettings, message, in_callback);
     _client->sendRequest(sc);
@@ -175,8 +175,8 @@ void BrainCloudLobby::updateSettings(const FString &in_lobbyID, const FString &i
 void BrainCloudLobby::switchTeam(const FString &in_lobbyID, const FString &in_teamCode, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::SwitchTeam, message, in_callback);
     _client->sendRequest(sc);
@@ -185,8 +185,8 @@ void BrainCloudLobby::switchTeam(const FString &in_lobbyID, const FString &in_te
 void BrainCloudLobby::sendSignal(const FString &in_lobbyID, const FString &in_signalJson, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
-    message->SetObjectField(OperationParam::LobbySignalData.getValue(), JsonUtil::jsonStringToValue(in_signalJson));
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
+    message->SetObjectField(OperationParam::LobbySignalData.getKey(), JsonUtil::jsonStringToValue(in_signalJson));
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::SendSignal, message, in_callback);
     _client->sendRequest(sc);
@@ -195,11 +195,11 @@ void BrainCloudLobby::sendSignal(const FString &in_lobbyID, const FString &in_si
 void BrainCloudLobby::joinLobby(const FString &in_lobbyID, bool in_isReady, const FString &in_extraJson, const FString &in_teamCode, const TArray<FString> &in_otherUserCxIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::JoinLobby, message, in_callback);
     _client->sendRequest(sc);
@@ -208,11 +208,11 @@ void BrainCloudLobby::joinLobby(const FString &in_lobbyID, bool in_isReady, cons
 void BrainCloudLobby::joinLobbyWithPingData(const FString &in_lobbyID, bool in_isReady, const FString &in_extraJson, const FString &in_teamCode, const TArray<FString> &in_otherUserCxIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
-    message->SetBoolField(OperationParam::LobbyIsReady.getValue(), in_isReady);
-    message->SetObjectField(OperationParam::LobbyExtraJson.getValue(), JsonUtil::jsonStringToValue(in_extraJson));
-    message->SetStringField(OperationParam::LobbyTeamCode.getValue(), in_teamCode);
-    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getValue(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
+    message->SetBoolField(OperationParam::LobbyIsReady.getKey(), in_isReady);
+    message->SetObjectField(OperationParam::LobbyExtraJson.getKey(), JsonUtil::jsonStringToValue(in_extraJson));
+    message->SetStringField(OperationParam::LobbyTeamCode.getKey(), in_teamCode);
+    message->SetArrayField(OperationParam::LobbyOtherUserCxIds.getKey(), JsonUtil::arrayToJsonArray(in_otherUserCxIds));
 
     attachPingDataAndSend(message, ServiceOperation::JoinLobbyWithPingData, in_callback);
 }
@@ -220,7 +220,7 @@ void BrainCloudLobby::joinLobbyWithPingData(const FString &in_lobbyID, bool in_i
 void BrainCloudLobby::leaveLobby(const FString &in_lobbyID, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::LeaveLobby, message, in_callback);
     _client->sendRequest(sc);
@@ -229,8 +229,8 @@ void BrainCloudLobby::leaveLobby(const FString &in_lobbyID, IServerCallback *in_
 void BrainCloudLobby::removeMember(const FString &in_lobbyID, const FString &in_connectionId, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyIdentifier.getValue(), in_lobbyID);
-    message->SetStringField(OperationParam::LobbyConnectionId.getValue(), in_connectionId);
+    message->SetStringField(OperationParam::LobbyIdentifier.getKey(), in_lobbyID);
+    message->SetStringField(OperationParam::LobbyConnectionId.getKey(), in_connectionId);
 
     ServerCall *sc = new ServerCall(ServiceName::Lobby, ServiceOperation::RemoveMember, message, in_callback);
     _client->sendRequest(sc);
@@ -239,8 +239,8 @@ void BrainCloudLobby::removeMember(const FString &in_lobbyID, const FString &in_
 void BrainCloudLobby::cancelFindRequest(const FString& in_lobbyType, IServerCallback* in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::LobbyRoomType.getValue(), in_lobbyType);
-    message->SetStringField(OperationParam::LobbyConnectionId.getValue(), _client->getRTTConnectionId());
+    message->SetStringField(OperationParam::LobbyRoomType.getKey(), in_lobbyType);
+    message->SetStringField(OperationParam::LobbyConnectionId.getKey(), _client->getRTTConnectionId());
 
     ServerCall* sc = new ServerCall(ServiceName::Lobby, ServiceOperation::CancelFindRequest, message, in_callback);
     _client->sendRequest(sc);
@@ -250,7 +250,7 @@ void BrainCloudLobby::getRegionsForLobbies(const TArray<FString> &in_roomTypes,
 {
     _regionsForLobbiesCallback = in_callback;
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetArrayField(OperationParam::LobbyTypes.getValue(), JsonUtil::arrayToJsonArray(in_roomTypes));
+    message->SetArrayField(OperationParam::LobbyTypes.getKey(), JsonUtil::arrayToJsonArray(in_roomTypes));
 
     // pass in our own handler of this callback, 
     ServerCall* sc = new ServerCall(ServiceName::Lobby, ServiceOperation::GetRegionsForLobbies, message, this);
@@ -380,7 +380,7 @@ void BrainCloudLobby::attachPingDataAndSend(TSharedRef<FJsonObject> message, Ser
     bool hasPingData = _pingData.IsValid();
     if (hasPingData)
     {
-        message->SetObjectField(OperationParam::PingData.getValue(),  _pingData);
+        message->SetObjectField(OperationParam::PingData.getKey(),  _pingData);
         ServerCall* sc = new ServerCall(ServiceName::Lobby, serviceOperation, message, in_callback);
         _client->sendRequest(sc);
     }
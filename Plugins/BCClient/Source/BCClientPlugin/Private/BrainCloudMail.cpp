@@ -12,9 +12,9 @@ BrainCloudMail::BrainCloudMail(BrainCloudClient *client) : _client(client){};
 void BrainCloudMail::sendBasicEmail(const FString &profileId, const FString &subject, const FString &body, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::ProfileId.getValue(), profileId);
-	message->SetStringField(OperationParam::Subject.getValue(), subject);
-	message->SetStringField(OperationParam::Body.getValue(), body);
+	message->SetStringField(OperationParam::ProfileId.getKey(), profileId);
+	message->SetStringField(OperationParam::Subject.getKey(), subject);
+	message->SetStringField(OperationParam::Body.getKey(), body);
 
 	ServerCall *sc = new ServerCall(ServiceName::Mail, ServiceOperation::SendBasicEmail, message, callback);
 	_client->sendRequest(sc);
@@ -23,8 +23,8 @@ void BrainCloudMail::sendBasicEmail(const FString &profileId, const FString &sub
 void BrainCloudMail::sendAdvancedEmail(const FString &profileId, const FString &jsonServiceParams, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::ProfileId.getValue(), profileId);
-	message->SetObjectField(OperationParam::ServiceParams.getValue(), JsonUtil::jsonStringToValue(jsonServiceParams));
+	message->SetStringField(OperationParam::ProfileId.getKey(), profileId);
+	message->SetObjectField(OperationParam::ServiceParams.getKey(), JsonUtil::jsonStringToValue(jsonServiceParams));
 
 	ServerCall *sc = new ServerCall(ServiceName::Mail, ServiceOperation::SendAdvancedEmail, message, callback);
 	_client->sendRequest(sc);
@@ -33,8 +33,8 @@ void BrainCloudMail::sendAdvancedEmail(const FString &profileId, const FString &
 void BrainCloudMail::sendAdvancedEmailByAddress(const FString &emailAddress, const FString &jsonServiceParams, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::EmailAddress.getValue(), emailAddress);
-	message->SetObjectField(OperationParam::ServiceParams.getValue(), JsonUtil::jsonStringToValue(jsonServiceParams));
+	message->SetStringField(OperationParam::EmailAddress.getKey(), emailAddress);
+	message->SetObjectField(OperationParam::ServiceParams.getKey(), JsonUtil::jsonStringToValue(jsonServiceParams));
 
 	ServerCall *sc = new ServerCall(ServiceName::Mail, ServiceOperation::SendAdvancedEmailByAddress, message, callback);
 	_client->sendRequest(sc);
@@ -19,7 +19,7 @@ void BrainCloudMatchmaking::read(IServerCallback *callback)
 void BrainCloudMatchmaking::setPlayerRating(int32 playerRating, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::MatchMakingServicePlayerRating.getValue(), playerRating);
+    message->SetNumberField(OperationParam::MatchMakingServicePlayerRating.getKey(), playerRating);
 
     ServerCall *sc = new ServerCall(ServiceName::MatchMaking, ServiceOperation::SetPlayerRating, message, callback);
     _client->sendRequest(sc);
@@ -35,7 +35,7 @@ void BrainCloudMatchmaking::resetPlayerRating(IServerCallback *callback)
 void BrainCloudMatchmaking::incrementPlayerRating(int32 increment, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::MatchMakingServicePlayerRating.getValue(), increment);
+    message->SetNumberField(OperationParam::MatchMakingServicePlayerRating.getKey(), increment);
 
     ServerCall *sc = new ServerCall(ServiceName::MatchMaking, ServiceOperation::IncrementPlayerRating, message, callback);
     _client->sendRequest(sc);
@@ -44,7 +44,7 @@ void BrainCloudMatchmaking::incrementPlayerRating(int32 increment, IServerCallba
 void BrainCloudMatchmaking::decrementPlayerRating(int32 decrement, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::MatchMakingServicePlayerRating.getValue(), decrement);
+    message->SetNumberField(OperationParam::MatchMakingServicePlayerRating.getKey(), decrement);
 
     ServerCall *sc = new ServerCall(ServiceName::MatchMaking, ServiceOperation::DecrementPlayerRating, message, callback);
     _client->sendRequest(sc);
@@ -60,7 +60,7 @@ void BrainCloudMatchmaking::turnShieldOn(IServerCallback *callback)
 void BrainCloudMatchmaking::turnShieldOnFor(int32 minutes, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::MatchMakingServiceMinutes.getValue(), minutes);
+    message->SetNumberField(OperationParam::MatchMakingServiceMinutes.getKey(), minutes);
 
     ServerCall *sc = new ServerCall(ServiceName::MatchMaking, ServiceOperation::ShieldOnFor, message, callback);
     _client->sendRequest(sc);
@@ -76,7 +76,7 @@ void BrainCloudMatchmaking::turnShieldOff(IServerCallback *callback)
 void BrainCloudMatchmaking::incrementShieldOnFor(int32 minutes, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::MatchMakingServiceMinutes.getValue(), minutes);
+    message->SetNumberField(OperationParam::MatchMakingServiceMinutes.getKey(), minutes);
 
     ServerCall *sc = new ServerCall(ServiceName::MatchMaking, ServiceOperation::IncrementShieldOnFor, message, callback);
     _client->sendRequest(sc);
@@ -90,12 +90,12 @@ void BrainCloudMatchmaking::findPlayers(int32 rangeDelta, int32 numMatches, ISer
 void BrainCloudMatchmaking::findPlayersWithAttributes(int32 rangeDelta, int32 numMatches, const FString &jsonAttributes, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::MatchMakingServiceRangeDelta.getValue(), rangeDelta);
-    message->SetNumberField(OperationParam::MatchMakingServiceNumMatches.getValue(), numMatches);
+    message->SetNumberField(OperationParam::MatchMakingServiceRangeDelta.getKey(), rangeDelta);
+    message->SetNumberField(OperationParam::MatchMakingServiceNumMatches.getKey(), numMatches);
 
     if (OperationParam::isOptionalParamValid(jsonAttributes))
     {
-        message->SetObjectField(OperationParam::MatchMakingServiceAttributes.getValue(), JsonUtil::jsonStringToValue(jsonAttributes));
+        message->SetObjectField(OperationParam::MatchMakingServiceAttributes.getKey(), JsonUtil::jsonStringToValue(jsonAttributes));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::MatchMaking, ServiceOperation::FindPlayers, message, callback);
@@ -115,17 +115,17 @@ void BrainCloudMatchmaking::findPlayersWithAttributesUsingFilter(
     IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::MatchMakingServiceRangeDelta.getValue(), rangeDelta);
-    message->SetNumberField(OperationParam::MatchMakingServiceNumMatches.getValue(), numMatches);
+    message->SetNumberField(OperationParam::MatchMakingServiceRangeDelta.getKey(), rangeDelta);
+    message->SetNumberField(OperationParam::MatchMakingServiceNumMatches.getKey(), numMatches);
 
     if (OperationParam::isOptionalParamValid(jsonExtraParms))
     {
-        message->SetObjectField(OperationParam::MatchMakingServiceExtraParams.getValue(), JsonUtil::jsonStringToValue(jsonExtraParms));
+        message->SetObjectField(OperationParam::MatchMakingServiceExtraParams.getKey(), JsonUtil::jsonStringToValue(jsonExtraParms));
     }
 
     if (OperationParam::isOptionalParamValid(jsonAttributes))
     {
-        message->SetObjectField(OperationParam::MatchMakingServiceAttributes.getValue(), JsonUtil::jsonStringToValue(jsonAttributes));
+        message->SetObjectField(OperationParam::MatchMakingServiceAttributes.getKey(), JsonUtil::jsonStringToValue(jsonAttributes));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::MatchMaking, ServiceOperation::FindPlayersUsingFilter, message, callback);
@@ -12,8 +12,8 @@ BrainCloudMessaging::BrainCloudMessaging(BrainCloudClient *client) : _client(cli
 void BrainCloudMessaging::deleteMessages(const FString &in_msgBox, const TArray<FString> &in_msgsIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::MessagingMessageBox.getValue(), in_msgBox);
-    message->SetArrayField(OperationParam::MessagingMessageIds.getValue(), JsonUtil::arrayToJsonArray(in_msgsIds));
+    message->SetStringField(OperationParam::MessagingMessageBox.getKey(), in_msgBox);
+    message->SetArrayField(OperationParam::MessagingMessageIds.getKey(), JsonUtil::arrayToJsonArray(in_msgsIds));
 
     ServerCall *sc = new ServerCall(ServiceName::Messaging, ServiceOperation::DeleteMessages, message, in_callback);
     _client->sendRequest(sc);
@@ -38,9 +38,9 @@ void BrainCloudMessaging::getMessageCounts(IServerCallback *in_callback)
 void BrainCloudMessaging::getMessages(const FString &in_msgBox, const TArray<FString> &in_msgsIds, bool in_markAsRead, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::MessagingMessageBox.getValue(), in_msgBox);
-    message->SetArrayField(OperationParam::MessagingMessageIds.getValue(), JsonUtil::arrayToJsonArray(in_msgsIds));
-    message->SetBoolField(OperationParam::MessagingMarkAsRead.getValue(), in_markAsRead);
+    message->SetStringField(OperationParam::MessagingMessageBox.getKey(), in_msgBox);
+    message->SetArrayField(OperationParam::MessagingMessageIds.getKey(), JsonUtil::arrayToJsonArray(in_msgsIds));
+    message->SetBoolField(OperationParam::MessagingMarkAsRead.getKey(), in_markAsRead);
 
     ServerCall *sc = new ServerCall(ServiceName::Messaging, ServiceOperation::GetMessages, message, in_callback);
     _client->sendRequest(sc);
@@ -49,7 +49,7 @@ void BrainCloudMessaging::getMessages(const FString &in_msgBox, const TArray<FSt
 void BrainCloudMessaging::getMessagesPage(const FString &in_context, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::MessagingContext.getValue(), JsonUtil::jsonStringToValue(in_context));
+    message->SetObjectField(OperationParam::MessagingContext.getKey(), JsonUtil::jsonStringToValue(in_context));
 
     ServerCall *sc = new ServerCall(ServiceName::Messaging, ServiceOperation::GetMessagesPage, message, in_callback);
     _client->sendRequest(sc);
@@ -58,8 +58,8 @@ void BrainCloudMessaging::getMessagesPage(const FString &in_context, IServerCall
 void BrainCloudMessaging::getMessagesPageOffset(const FString &in_context, int32 in_pageOffset, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::MessagingContext.getValue(), in_context);
-    message->SetNumberField(OperationParam::MessagingPageOffset.getValue(), in_pageOffset);
+    message->SetStringField(OperationParam::MessagingContext.getKey(), in_context);
+    message->SetNumberField(OperationParam::MessagingPageOffset.getKey(), in_pageOffset);
 
     ServerCall *sc = new ServerCall(ServiceName::Messaging, ServiceOperation::GetMessagesPageOffset, message, in_callback);
     _client->sendRequest(sc);
@@ -68,8 +68,8 @@ void BrainCloudMessaging::getMessagesPageOffset(const FString &in_context, int32
 void BrainCloudMessaging::markMessagesRead(const FString &in_msgBox, const TArray<FString> &in_msgsIds, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::MessagingMessageBox.getValue(), in_msgBox);
-    message->SetArrayField(OperationParam::MessagingMessageIds.getValue(), JsonUtil::arrayToJsonArray(in_msgsIds));
+    message->SetStringField(OperationParam::MessagingMessageBox.getKey(), in_msgBox);
+    message->SetArrayField(OperationParam::MessagingMessageIds.getKey(), JsonUtil::arrayToJsonArray(in_msgsIds));
 
     ServerCall *sc = new ServerCall(ServiceName::Messaging, ServiceOperation::MarkMessagesRead, message, in_callback);
     _client->sendRequest(sc);
@@ -78,8 +78,8 @@ void BrainCloudMessaging::markMessagesRead(const FString &in_msgBox, const TArra
 void BrainCloudMessaging::sendMessage(const TArray<FString> &in_toProfileIds, const FString &in_contentJson, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetArrayField(OperationParam::MessagingToProfileIds.getValue(), JsonUtil::arrayToJsonArray(in_toProfileIds));
-    message->SetObjectField(OperationParam::MessagingContent.getValue(), JsonUtil::jsonStringToValue(in_contentJson));
+    message->SetArrayField(OperationParam::MessagingToProfileIds.getKey(), JsonUtil::arrayToJsonArray(in_toProfileIds));
+    message->SetObjectField(OperationParam::MessagingContent.getKey(), JsonUtil::jsonStringToValue(in_contentJson));
 
     ServerCall *sc = new ServerCall(ServiceName::Messaging, ServiceOperation::SEND_MESSAGE, message, in_callback);
     _client->sendRequest(sc);
@@ -88,8 +88,8 @@ void BrainCloudMessaging::sendMessage(const TArray<FString> &in_toProfileIds, co
 void BrainCloudMessaging::sendMessageSimple(const TArray<FString> &in_toProfileIds, const FString &in_messageText, IServerCallback *in_callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetArrayField(OperationParam::MessagingToProfileIds.getValue(), JsonUtil::arrayToJsonArray(in_toProfileIds));
-    message->SetStringField(OperationParam::MessagingText.getValue(), in_messageText);
+    message->SetArrayField(OperationParam::MessagingToProfileIds.getKey(), JsonUtil::arrayToJsonArray(in_toProfileIds));
+    message->SetStringField(OperationParam::MessagingText.getKey(), in_messageText);
 
     ServerCall *sc = new ServerCall(ServiceName::Messaging, ServiceOperation::SendMessageSimple, message, in_callback);
     _client->sendRequest(sc);
@@ -12,8 +12,8 @@ BrainCloudOneWayMatch::BrainCloudOneWayMatch(BrainCloudClient *client) : _client
 void BrainCloudOneWayMatch::startMatch(const FString &otherPlayerId, int32 rangeDelta, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::OneWayMatchServicePlayerId.getValue(), otherPlayerId);
-    message->SetNumberField(OperationParam::OneWayMatchServiceRangeDelta.getValue(), rangeDelta);
+    message->SetStringField(OperationParam::OneWayMatchServicePlayerId.getKey(), otherPlayerId);
+    message->SetNumberField(OperationParam::OneWayMatchServiceRangeDelta.getKey(), rangeDelta);
 
     ServerCall *sc = new ServerCall(ServiceName::OneWayMatch, ServiceOperation::StartMatch, message, callback);
     _client->sendRequest(sc);
@@ -22,7 +22,7 @@ void BrainCloudOneWayMatch::startMatch(const FString &otherPlayerId, int32 range
 void BrainCloudOneWayMatch::cancelMatch(const FString &playbackStreamId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::OneWayMatchServicePlaybackStreamId.getValue(), playbackStreamId);
+    message->SetStringField(OperationParam::OneWayMatchServicePlaybackStreamId.getKey(), playbackStreamId);
 
     ServerCall *sc = new ServerCall(ServiceName::OneWayMatch, ServiceOperation::CancelMatch, message, callback);
     _client->sendRequest(sc);
@@ -31,7 +31,7 @@ void BrainCloudOneWayMatch::cancelMatch(const FString &playbackStreamId, IServer
 void BrainCloudOneWayMatch::completeMatch(const FString &playbackStreamId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::OneWayMatchServicePlaybackStreamId.getValue(), playbackStreamId);
+    message->SetStringField(OperationParam::OneWayMatchServicePlaybackStreamId.getKey(), playbackStreamId);
 
     ServerCall *sc = new ServerCall(ServiceName::OneWayMatch, ServiceOperation::CompleteMatch, message, callback);
     _client->sendRequest(sc);
@@ -12,8 +12,8 @@ BrainCloudPlaybackStream::BrainCloudPlaybackStream(BrainCloudClient *client) : _
 void BrainCloudPlaybackStream::startStream(const FString &targetPlayerId, bool includeSharedData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlaybackStreamServiceTargetPlayerId.getValue(), targetPlayerId);
-    message->SetBoolField(OperationParam::PlaybackStreamServiceIncludeSharedData.getValue(), includeSharedData);
+    message->SetStringField(OperationParam::PlaybackStreamServiceTargetPlayerId.getKey(), targetPlayerId);
+    message->SetBoolField(OperationParam::PlaybackStreamServiceIncludeSharedData.getKey(), includeSharedData);
 
     ServerCall *sc = new ServerCall(ServiceName::PlaybackStream, ServiceOperation::StartStream, message, callback);
     _client->sendRequest(sc);
@@ -22,7 +22,7 @@ void BrainCloudPlaybackStream::startStream(const FString &targetPlayerId, bool i
 void BrainCloudPlaybackStream::readStream(const FString &playbackStreamId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getValue(), playbackStreamId);
+    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getKey(), playbackStreamId);
 
     ServerCall *sc = new ServerCall(ServiceName::PlaybackStream, ServiceOperation::ReadStream, message, callback);
     _client->sendRequest(sc);
@@ -31,7 +31,7 @@ void BrainCloudPlaybackStream::readStream(const FString &playbackStreamId, IServ
 void BrainCloudPlaybackStream::endStream(const FString &playbackStreamId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getValue(), playbackStreamId);
+    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getKey(), playbackStreamId);
 
     ServerCall *sc = new ServerCall(ServiceName::PlaybackStream, ServiceOperation::EndStream, message, callback);
     _client->sendRequest(sc);
@@ -40,7 +40,7 @@ void BrainCloudPlaybackStream::endStream(const FString &playbackStreamId, IServe
 void BrainCloudPlaybackStream::deleteStream(const FString &playbackStreamId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getValue(), playbackStreamId);
+    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getKey(), playbackStreamId);
 
     ServerCall *sc = new ServerCall(ServiceName::PlaybackStream, ServiceOperation::DeleteStream, message, callback);
     _client->sendRequest(sc);
@@ -49,9 +49,9 @@ void BrainCloudPlaybackStream::deleteStream(const FString &playbackStreamId, ISe
 void BrainCloudPlaybackStream::addEvent(const FString &playbackStreamId, const FString &jsonEventData, const FString &jsonSummary, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getValue(), playbackStreamId);
-    message->SetObjectField(OperationParam::PlaybackStreamServiceEventData.getValue(), JsonUtil::jsonStringToValue(jsonEventData));
-    message->SetObjectField(OperationParam::PlaybackStreamServiceSummary.getValue(), JsonUtil::jsonStringToValue(jsonSummary));
+    message->SetStringField(OperationParam::PlaybackStreamServicePlaybackStreamId.getKey(), playbackStreamId);
+    message->SetObjectField(OperationParam::PlaybackStreamServiceEventData.getKey(), JsonUtil::jsonStringToValue(jsonEventData));
+    message->SetObjectField(OperationParam::PlaybackStreamServiceSummary.getKey(), JsonUtil::jsonStringToValue(jsonSummary));
 
     ServerCall *sc = new ServerCall(ServiceName::PlaybackStream, ServiceOperation::AddEvent, message, callback);
     _client->sendRequest(sc);
@@ -60,8 +60,8 @@ void BrainCloudPlaybackStream::addEvent(const FString &playbackStreamId, const F
 void BrainCloudPlaybackStream::getRecentStreamsForInitiatingPlayer(const FString &initiatingPlayerId, int32 maxNumStreams, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlaybackStreamServiceInitiatingPlayerId.getValue(), initiatingPlayerId);
-    message->SetNumberField(OperationParam::PlaybackStreamServiceMaxNumberOfStreams.getValue(), maxNumStreams);
+    message->SetStringField(OperationParam::PlaybackStreamServiceInitiatingPlayerId.getKey(), initiatingPlayerId);
+    message->SetNumberField(OperationParam::PlaybackStreamServiceMaxNumberOfStreams.getKey(), maxNumStreams);
 
     ServerCall *sc = new ServerCall(ServiceName::PlaybackStream, ServiceOperation::GetRecentStreamsForInitiatingPlayer, message, callback);
     _client->sendRequest(sc);
@@ -70,8 +70,8 @@ void BrainCloudPlaybackStream::getRecentStreamsForInitiatingPlayer(const FString
 void BrainCloudPlaybackStream::getRecentStreamsForTargetPlayer(const FString &targetPlayerId, int32 maxNumStreams, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlaybackStreamServiceTargetPlayerId.getValue(), targetPlayerId);
-    message->SetNumberField(OperationParam::PlaybackStreamServiceMaxNumberOfStreams.getValue(), maxNumStreams);
+    message->SetStringField(OperationParam::PlaybackStreamServiceTargetPlayerId.getKey(), targetPlayerId);
+    message->SetNumberField(OperationParam::PlaybackStreamServiceMaxNumberOfStreams.getKey(), maxNumStreams);
 
     ServerCall *sc = new ServerCall(ServiceName::PlaybackStream, ServiceOperation::GetRecentStreamsForTargetPlayer, message, callback);
     _client->sendRequest(sc);
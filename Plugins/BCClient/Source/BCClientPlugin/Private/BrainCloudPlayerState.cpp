@@ -14,7 +14,7 @@ void BrainCloudPlayerState::readUserState(IServerCallback *callback, const FStri
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
     if (entityTypeFilter.Len() > 0)
     {
-        message->SetStringField(OperationParam::PlayerStateServiceReadEntitySubtype.getValue(), entityTypeFilter);
+        message->SetStringField(OperationParam::PlayerStateServiceReadEntitySubtype.getKey(), entityTypeFilter);
     }
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::Read, message, callback);
@@ -50,7 +50,7 @@ void BrainCloudPlayerState::updateUserName(const FString &name, IServerCallback
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
     if (name.Len() > 0)
     {
-        message->SetStringField(OperationParam::PlayerStateServiceUpdateNameData.getValue(), name);
+        message->SetStringField(OperationParam::PlayerStateServiceUpdateNameData.getKey(), name);
     }
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::UpdateName, message, callback);
@@ -65,7 +65,7 @@ void BrainCloudPlayerState::updateName(const FString &name, IServerCallback *cal
 void BrainCloudPlayerState::updateSummaryFriendData(const FString &jsonSummaryData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::PlayerStateServiceUpdateSummaryFriendData.getValue(), JsonUtil::jsonStringToValue(jsonSummaryData));
+    message->SetObjectField(OperationParam::PlayerStateServiceUpdateSummaryFriendData.getKey(), JsonUtil::jsonStringToValue(jsonSummaryData));
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::UpdateSummary, message, callback);
     _client->sendRequest(sc);
@@ -82,8 +82,8 @@ void BrainCloudPlayerState::getAttributes(IServerCallback *callback)
 void BrainCloudPlayerState::updateAttributes(const FString &jsonAttributes, bool wipeExisting, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetField(OperationParam::PlayerStateServiceAttributes.getValue(), JsonUtil::jsonStringToActualValue(jsonAttributes));
-    message->SetBoolField(OperationParam::PlayerStateServiceWipeExisting.getValue(), wipeExisting);
+    message->SetField(OperationParam::PlayerStateServiceAttributes.getKey(), JsonUtil::jsonStringToActualValue(jsonAttributes));
+    message->SetBoolField(OperationParam::PlayerStateServiceWipeExisting.getKey(), wipeExisting);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::UpdateAttributes, message, callback);
     _client->sendRequest(sc);
@@ -92,7 +92,7 @@ void BrainCloudPlayerState::updateAttributes(const FString &jsonAttributes, bool
 void BrainCloudPlayerState::removeAttributes(const TArray<FString> &attributeNames, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetArrayField(OperationParam::PlayerStateServiceAttributes.getValue(), JsonUtil::arrayToJsonArray(attributeNames));
+    message->SetArrayField(OperationParam::PlayerStateServiceAttributes.getKey(), JsonUtil::arrayToJsonArray(attributeNames));
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::RemoveAttributes, message, callback);
     _client->sendRequest(sc);
@@ -101,7 +101,7 @@ void BrainCloudPlayerState::removeAttributes(const TArray<FString> &attributeNam
 void BrainCloudPlayerState::updateUserPictureUrl(const FString &pictureUrl, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlayerStateServicePictureUrl.getValue(), pictureUrl);
+    message->SetStringField(OperationParam::PlayerStateServicePictureUrl.getKey(), pictureUrl);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::UpdatePlayerPicture, message, callback);
     _client->sendRequest(sc);
@@ -110,7 +110,7 @@ void BrainCloudPlayerState::updateUserPictureUrl(const FString &pictureUrl, ISer
 void BrainCloudPlayerState::updateContactEmail(const FString &contactEmail, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlayerStateServiceContactEmail.getValue(), contactEmail);
+    message->SetStringField(OperationParam::PlayerStateServiceContactEmail.getKey(), contactEmail);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::UpdateContactEmail, message, callback);
     _client->sendRequest(sc);
@@ -120,7 +120,7 @@ void BrainCloudPlayerState::updateContactEmail(const FString &contactEmail, ISer
 void BrainCloudPlayerState::clearUserStatus(const FString &statusName, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getValue(), statusName);
+    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getKey(), statusName);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::ClearUserStatus, message, callback);
     _client->sendRequest(sc);
@@ -129,9 +129,9 @@ void BrainCloudPlayerState::clearUserStatus(const FString &statusName, IServerCa
 void BrainCloudPlayerState::extendUserStatus(const FString &statusName, int additionalSecs, const FString &details, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getValue(), statusName);
-    message->SetNumberField(OperationParam::PlayerStateServiceAdditionalSecs.getValue(), additionalSecs);
-    message->SetObjectField(OperationParam::PlayerStateServiceDetails.getValue(), JsonUtil::jsonStringToValue(details));
+    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getKey(), statusName);
+    message->SetNumberField(OperationParam::PlayerStateServiceAdditionalSecs.getKey(), additionalSecs);
+    message->SetObjectField(OperationParam::PlayerStateServiceDetails.getKey(), JsonUtil::jsonStringToValue(details));
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::ExtendUserStatus, message, callback);
     _client->sendRequest(sc);
@@ -140,7 +140,7 @@ void BrainCloudPlayerState::extendUserStatus(const FString &statusName, int addi
 void BrainCloudPlayerState::getUserStatus(const FString &statusName, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getValue(), statusName);
+    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getKey(), statusName);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::GetUserStatus, message, callback);
     _client->sendRequest(sc);
@@ -149,9 +149,9 @@ void BrainCloudPlayerState::getUserStatus(const FString &statusName, IServerCall
 void BrainCloudPlayerState::setUserStatus(const FString &statusName, int durationSecs, const FString &details, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getValue(), statusName);
-    message->SetNumberField(OperationParam::PlayerStateServiceDurationSecs.getValue(), durationSecs);
-    message->SetObjectField(OperationParam::PlayerStateServiceDetails.getValue(), JsonUtil::jsonStringToValue(details));
+    message->SetStringField(OperationParam::PlayerStateServiceStatusName.getKey(), statusName);
+    message->SetNumberField(OperationParam::PlayerStateServiceDurationSecs.getKey(), durationSecs);
+    message->SetObjectField(OperationParam::PlayerStateServiceDetails.getKey(), JsonUtil::jsonStringToValue(details));
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::SetUserStatus, message, callback);
     _client->sendRequest(sc);
@@ -160,7 +160,7 @@ void BrainCloudPlayerState::setUserStatus(const FString &statusName, int duratio
 void BrainCloudPlayerState::updateTimeZoneOffset(int32 timeZoneOffset, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::PlayerStateServiceTimeZoneOffset.getValue(), timeZoneOffset);
+    message->SetNumberField(OperationParam::PlayerStateServiceTimeZoneOffset.getKey(), timeZoneOffset);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::UpdateTimeZoneOffset, message, callback);
     _client->sendRequest(sc);
@@ -169,7 +169,7 @@ void BrainCloudPlayerState::updateTimeZoneOffset(int32 timeZoneOffset, IServerCa
 void BrainCloudPlayerState::updateLanguageCode(const FString &languageCode, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PlayerStateServiceLanguageCode.getValue(), languageCode);
+    message->SetStringField(OperationParam::PlayerStateServiceLanguageCode.getKey(), languageCode);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerState, ServiceOperation::UpdateLanguageCode, message, callback);
     _client->sendRequest(sc);
@@ -19,7 +19,7 @@ void BrainCloudPlayerStatistics::readAllUserStats(IServerCallback *callback)
 void BrainCloudPlayerStatistics::readUserStatsSubset(const TArray<FString> &playerStats, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::PlayerStatisticsServiceStats.getValue(), JsonUtil::arrayToJsonArray(playerStats));
+	message->SetArrayField(OperationParam::PlayerStatisticsServiceStats.getKey(), JsonUtil::arrayToJsonArray(playerStats));
 	ServerCall *sc = new ServerCall(ServiceName::PlayerStatistics, ServiceOperation::ReadSubset, message, callback);
 	_client->sendRequest(sc);
 }
@@ -27,7 +27,7 @@ void BrainCloudPlayerStatistics::readUserStatsSubset(const TArray<FString> &play
 void BrainCloudPlayerStatistics::readUserStatisticsByCategory(const FString &category, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GamificationServiceCategory.getValue(), category);
+	message->SetStringField(OperationParam::GamificationServiceCategory.getKey(), category);
 
 	ServerCall *sc = new ServerCall(ServiceName::Gamification, ServiceOperation::ReadPlayerStatisticsByCategory, message, callback);
 	_client->sendRequest(sc);
@@ -43,7 +43,7 @@ void BrainCloudPlayerStatistics::resetAllUserStats(IServerCallback *callback)
 void BrainCloudPlayerStatistics::incrementUserStats(const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	ServerCall *sc = new ServerCall(ServiceName::PlayerStatistics, ServiceOperation::Update, message, callback);
 	_client->sendRequest(sc);
 }
@@ -58,7 +58,7 @@ void BrainCloudPlayerStatistics::getNextExperienceLevel(IServerCallback *callbac
 void BrainCloudPlayerStatistics::incrementExperiencePoints(int32 xpValue, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetNumberField(OperationParam::PlayerStatisticsExperiencePoints.getValue(), xpValue);
+	message->SetNumberField(OperationParam::PlayerStatisticsExperiencePoints.getKey(), xpValue);
 	ServerCall *sc = new ServerCall(ServiceName::PlayerStatistics, ServiceOperation::Update, message, callback);
 	_client->sendRequest(sc);
 }
@@ -66,7 +66,7 @@ void BrainCloudPlayerStatistics::incrementExperiencePoints(int32 xpValue, IServe
 void BrainCloudPlayerStatistics::setExperiencePoints(int32 xpValue, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetNumberField(OperationParam::PlayerStatisticsExperiencePoints.getValue(), xpValue);
+	message->SetNumberField(OperationParam::PlayerStatisticsExperiencePoints.getKey(), xpValue);
 	ServerCall *sc = new ServerCall(ServiceName::PlayerStatistics, ServiceOperation::SetXpPoints, message, callback);
 	_client->sendRequest(sc);
 }
@@ -74,7 +74,7 @@ void BrainCloudPlayerStatistics::setExperiencePoints(int32 xpValue, IServerCallb
 void BrainCloudPlayerStatistics::processStatistics(const FString &jsonData, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getValue(), JsonUtil::jsonStringToValue(jsonData));
+	message->SetObjectField(OperationParam::PlayerStatisticsServiceStats.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	ServerCall *sc = new ServerCall(ServiceName::PlayerStatistics, ServiceOperation::ProcessStatistics, message, callback);
 	_client->sendRequest(sc);
 }
\ No newline at end of file
@@ -13,8 +13,8 @@ void BrainCloudPlayerStatisticsEvent::triggerStatsEvent(const FString &eventName
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetStringField(OperationParam::PlayerStatisticEventServiceEventName.getValue(), eventName);
-    message->SetNumberField(OperationParam::PlayerStatisticEventServiceEventMultiplier.getValue(), eventMultiplier);
+    message->SetStringField(OperationParam::PlayerStatisticEventServiceEventName.getKey(), eventName);
+    message->SetNumberField(OperationParam::PlayerStatisticEventServiceEventMultiplier.getKey(), eventMultiplier);
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerStatisticsEvent, ServiceOperation::Trigger, message, callback);
     _client->sendRequest(sc);
@@ -24,7 +24,7 @@ void BrainCloudPlayerStatisticsEvent::triggerStatsEvents(const FString &jsonData
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetField(OperationParam::PlayerStatisticEventServiceEvents.getValue(), JsonUtil::jsonStringToActualValue(jsonData));
+    message->SetField(OperationParam::PlayerStatisticEventServiceEvents.getKey(), JsonUtil::jsonStringToActualValue(jsonData));
 
     ServerCall *sc = new ServerCall(ServiceName::PlayerStatisticsEvent, ServiceOperation::TriggerMultiple, message, callback);
     _client->sendRequest(sc);
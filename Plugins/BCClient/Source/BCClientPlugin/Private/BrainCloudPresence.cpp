@@ -19,8 +19,8 @@ void BrainCloudPresence::forcePush(IServerCallback *callback)
 void BrainCloudPresence::getPresenceOfFriends(const FString &platform, bool includeOffline, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PresenceServicePlatform.getValue(), platform);
-    message->SetBoolField(OperationParam::PresenceServiceIncludeOffline.getValue(), includeOffline);
+    message->SetStringField(OperationParam::PresenceServicePlatform.getKey(), platform);
+    message->SetBoolField(OperationParam::PresenceServiceIncludeOffline.getKey(), includeOffline);
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::GetPresenceOfFriends, message, callback);
     _client->sendRequest(sc);
@@ -29,8 +29,8 @@ void BrainCloudPresence::getPresenceOfFriends(const FString &platform, bool incl
 void BrainCloudPresence::getPresenceOfGroup(const FString &groupId, bool includeOffline, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PresenceServiceGroupId.getValue(), groupId);
-    message->SetBoolField(OperationParam::PresenceServiceIncludeOffline.getValue(), includeOffline);
+    message->SetStringField(OperationParam::PresenceServiceGroupId.getKey(), groupId);
+    message->SetBoolField(OperationParam::PresenceServiceIncludeOffline.getKey(), includeOffline);
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::GetPresenceOfGroup, message, callback);
     _client->sendRequest(sc);
@@ -39,8 +39,8 @@ void BrainCloudPresence::getPresenceOfGroup(const FString &groupId, bool include
 void BrainCloudPresence::getPresenceOfUsers(const TArray<FString> &profileIds, bool includeOffline, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetArrayField(OperationParam::PresenceServiceProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
-    message->SetBoolField(OperationParam::PresenceServiceIncludeOffline.getValue(), includeOffline);
+    message->SetArrayField(OperationParam::PresenceServiceProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
+    message->SetBoolField(OperationParam::PresenceServiceIncludeOffline.getKey(), includeOffline);
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::GetPresenceOfUsers, message, callback);
     _client->sendRequest(sc);
@@ -49,8 +49,8 @@ void BrainCloudPresence::getPresenceOfUsers(const TArray<FString> &profileIds, b
 void BrainCloudPresence::registerListenersForFriends(const FString &platform, bool biderectional, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PresenceServicePlatform.getValue(), platform);
-    message->SetBoolField(OperationParam::PresenceServiceBidirectional.getValue(), biderectional);
+    message->SetStringField(OperationParam::PresenceServicePlatform.getKey(), platform);
+    message->SetBoolField(OperationParam::PresenceServiceBidirectional.getKey(), biderectional);
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::RegisterListenersForFriends, message, callback);
     _client->sendRequest(sc);
@@ -59,8 +59,8 @@ void BrainCloudPresence::registerListenersForFriends(const FString &platform, bo
 void BrainCloudPresence::registerListenersForGroup(const FString &groupId, bool biderectional, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::PresenceServiceGroupId.getValue(), groupId);
-    message->SetBoolField(OperationParam::PresenceServiceBidirectional.getValue(), biderectional);
+    message->SetStringField(OperationParam::PresenceServiceGroupId.getKey(), groupId);
+    message->SetBoolField(OperationParam::PresenceServiceBidirectional.getKey(), biderectional);
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::RegisterListenersForGroup, message, callback);
     _client->sendRequest(sc);
@@ -69,8 +69,8 @@ void BrainCloudPresence::registerListenersForGroup(const FString &groupId, bool
 void BrainCloudPresence::registerListenersForProfiles(const TArray<FString> &profileIds, bool bidirectional, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetArrayField(OperationParam::PresenceServiceProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
-    message->SetBoolField(OperationParam::PresenceServiceBidirectional.getValue(), bidirectional);
+    message->SetArrayField(OperationParam::PresenceServiceProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
+    message->SetBoolField(OperationParam::PresenceServiceBidirectional.getKey(), bidirectional);
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::RegisterListenersForProfiles, message, callback);
     _client->sendRequest(sc);
@@ -79,7 +79,7 @@ void BrainCloudPresence::registerListenersForProfiles(const TArray<FString> &pro
 void BrainCloudPresence::setVisibility(bool visible, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetBoolField(OperationParam::PresenceServiceVisible.getValue(), visible);
+    message->SetBoolField(OperationParam::PresenceServiceVisible.getKey(), visible);
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::SetVisibility, message, callback);
     _client->sendRequest(sc);
@@ -95,7 +95,7 @@ void BrainCloudPresence::stopListening(IServerCallback *callback)
 void BrainCloudPresence::updateActivity(const FString &activity, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetObjectField(OperationParam::PresenceServiceActivity.getValue(), JsonUtil::jsonStringToValue(activity));
+    message->SetObjectField(OperationParam::PresenceServiceActivity.getKey(), JsonUtil::jsonStringToValue(activity));
 
     ServerCall *sc = new ServerCall(ServiceName::Presence, ServiceOperation::UpdateActivity, message, callback);
     _client->sendRequest(sc);
@@ -14,14 +14,14 @@ void BrainCloudProfanity::profanityCheck(const FString &text, const FString &lan
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetStringField(OperationParam::ProfanityText.getValue(), text);
+    message->SetStringField(OperationParam::ProfanityText.getKey(), text);
 
     if (OperationParam::isOptionalParamValid(languages))
-        message->SetStringField(OperationParam::ProfanityFlagEmail.getValue(), languages);
+        message->SetStringField(OperationParam::ProfanityFlagEmail.getKey(), languages);
 
-    message->SetBoolField(OperationParam::ProfanityFlagEmail.getValue(), flagEmail);
-    message->SetBoolField(OperationParam::ProfanityFlagPhone.getValue(), flagPhone);
-    message->SetBoolField(OperationParam::ProfanityFlagUrls.getValue(), flagUrls);
+    message->SetBoolField(OperationParam::ProfanityFlagEmail.getKey(), flagEmail);
+    message->SetBoolField(OperationParam::ProfanityFlagPhone.getKey(), flagPhone);
+    message->SetBoolField(OperationParam::ProfanityFlagUrls.getKey(), flagUrls);
 
     ServerCall *sc = new ServerCall(ServiceName::Profanity, ServiceOperation::ProfanityCheck, message, callback);
     _client->sendRequest(sc);
@@ -32,15 +32,15 @@ void BrainCloudProfanity::profanityReplaceText(const FString &text, const FStrin
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetStringField(OperationParam::ProfanityText.getValue(), text);
-    message->SetStringField(OperationParam::ProfanityReplaceSymbol.getValue(), replaceSymbol);
+    message->SetStringField(OperationParam::ProfanityText.getKey(), text);
+    message->SetStringField(OperationParam::ProfanityReplaceSymbol.getKey(), replaceSymbol);
 
     if (OperationParam::isOptionalParamValid(languages))
-        message->SetStringField(OperationParam::ProfanityFlagEmail.getValue(), languages);
+        message->SetStringField(OperationParam::ProfanityFlagEmail.getKey(), languages);
 
-    message->SetBoolField(OperationParam::ProfanityFlagEmail.getValue(), flagEmail);
-    message->SetBoolField(OperationParam::ProfanityFlagPhone.getValue(), flagPhone);
-    message->SetBoolField(OperationParam::ProfanityFlagUrls.getValue(), flagUrls);
+    message->SetBoolField(OperationParam::ProfanityFlagEmail.getKey(), flagEmail);
+    message->SetBoolField(OperationParam::ProfanityFlagPhone.getKey(), flagPhone);
+    message->SetBoolField(OperationParam::ProfanityFlagUrls.getKey(), flagUrls);
 
     ServerCall *sc = new ServerCall(ServiceName::Profanity, ServiceOperation::ProfanityReplaceText, message, callback);
     _client->sendRequest(sc);
@@ -51,14 +51,14 @@ void BrainCloudProfanity::profanityIdentifyBadWords(const FString &text, const F
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetStringField(OperationParam::ProfanityText.getValue(), text);
+    message->SetStringField(OperationParam::ProfanityText.getKey(), text);
 
     if (OperationParam::isOptionalParamValid(languages))
-        message->SetStringField(OperationParam::ProfanityFlagEmail.getValue(), languages);
+        message->SetStringField(OperationParam::ProfanityFlagEmail.getKey(), languages);
 
-    message->SetBoolField(OperationParam::ProfanityFlagEmail.getValue(), flagEmail);
-    message->SetBoolField(OperationParam::ProfanityFlagPhone.getValue(), flagPhone);
-    message->SetBoolField(OperationParam::ProfanityFlagUrls.getValue(), flagUrls);
+    message->SetBoolField(OperationParam::ProfanityFlagEmail.getKey(), flagEmail);
+    message->SetBoolField(OperationParam::ProfanityFlagPhone.getKey(), flagPhone);
+    message->SetBoolField(OperationParam::ProfanityFlagUrls.getKey(), flagUrls);
 
     ServerCall *sc = new ServerCall(ServiceName::Profanity, ServiceOperation::ProfanityIdenitfyBadWords, message, callback);
     _client->sendRequest(sc);
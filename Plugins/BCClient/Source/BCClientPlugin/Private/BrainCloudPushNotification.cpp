@@ -20,8 +20,8 @@ void BrainCloudPushNotification::deregisterAllPushNotificationDeviceTokens(IServ
 void BrainCloudPushNotification::deregisterPushNotificationDeviceToken(EBCPlatform platform, const FString &token, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceType.getValue(), BCPlatform::EnumToString(platform));
-	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceToken.getValue(), token);
+	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceType.getKey(), BCPlatform::EnumToString(platform));
+	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceToken.getKey(), token);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::Deregister, message, callback);
 	_client->sendRequest(sc);
@@ -35,8 +35,8 @@ void BrainCloudPushNotification::registerPushNotificationDeviceToken(EBCPlatform
 void BrainCloudPushNotification::registerPushNotificationDeviceToken(const FString &type, const FString &token, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceType.getValue(), type);
-	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceToken.getValue(), token);
+	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceType.getKey(), type);
+	message->SetStringField(OperationParam::PushNotificationRegisterParamDeviceToken.getKey(), token);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::Register, message, callback);
 	_client->sendRequest(sc);
@@ -45,8 +45,8 @@ void BrainCloudPushNotification::registerPushNotificationDeviceToken(const FStri
 void BrainCloudPushNotification::sendSimplePushNotification(const FString &toProfileId, const FString &message, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> messageObj = MakeShareable(new FJsonObject());
-	messageObj->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getValue(), toProfileId);
-	messageObj->SetStringField(OperationParam::PushNotificationSendParamMessage.getValue(), message);
+	messageObj->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getKey(), toProfileId);
+	messageObj->SetStringField(OperationParam::PushNotificationSendParamMessage.getKey(), message);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendSimple, messageObj, callback);
 	_client->sendRequest(sc);
@@ -60,12 +60,12 @@ void BrainCloudPushNotification::sendRichPushNotification(const FString &toProfi
 void BrainCloudPushNotification::sendRichPushNotificationWithParams(const FString &toProfileId, int32 notificationTemplateId, const FString &substitutionJson, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getValue(), toProfileId);
-	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getValue(), notificationTemplateId);
+	message->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getKey(), toProfileId);
+	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getKey(), notificationTemplateId);
 
 	if (OperationParam::isOptionalParamValid(substitutionJson))
 	{
-		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getValue(), JsonUtil::jsonStringToValue(substitutionJson));
+		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getKey(), JsonUtil::jsonStringToValue(substitutionJson));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendRich, message, callback);
@@ -75,12 +75,12 @@ void BrainCloudPushNotification::sendRichPushNotificationWithParams(const FStrin
 void BrainCloudPushNotification::sendTemplatedPushNotificationToGroup(const FString &groupId, int32 notificationTemplateId, const FString &substitutionsJson, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getValue(), notificationTemplateId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getKey(), notificationTemplateId);
 
 	if (OperationParam::isOptionalParamValid(substitutionsJson))
 	{
-		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getValue(), JsonUtil::jsonStringToValue(substitutionsJson));
+		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getKey(), JsonUtil::jsonStringToValue(substitutionsJson));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendTemplatedToGroup, message, callback);
@@ -90,12 +90,12 @@ void BrainCloudPushNotification::sendTemplatedPushNotificationToGroup(const FStr
 void BrainCloudPushNotification::sendNormalizedPushNotificationToGroup(const FString &groupId, const FString &alertContentJson, const FString &customDataJson, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
-	message->SetObjectField(OperationParam::AlertContent.getValue(), JsonUtil::jsonStringToValue(alertContentJson));
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
+	message->SetObjectField(OperationParam::AlertContent.getKey(), JsonUtil::jsonStringToValue(alertContentJson));
 
 	if (OperationParam::isOptionalParamValid(customDataJson))
 	{
-		message->SetObjectField(OperationParam::CustomData.getValue(), JsonUtil::jsonStringToValue(customDataJson));
+		message->SetObjectField(OperationParam::CustomData.getKey(), JsonUtil::jsonStringToValue(customDataJson));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendNormalizedToGroup, message, callback);
@@ -105,24 +105,24 @@ void BrainCloudPushNotification::sendNormalizedPushNotificationToGroup(const FSt
 void BrainCloudPushNotification::scheduleRawPushNotificationUTC(const FString &profileId, const FString &fcmContent, const FString &iosContent, const FString &facebookContent, int64 startTime, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::ProfileId.getValue(), profileId);
+	message->SetStringField(OperationParam::ProfileId.getKey(), profileId);
 
 	if (OperationParam::isOptionalParamValid(fcmContent))
 	{
-		message->SetObjectField(OperationParam::FcmContent.getValue(), JsonUtil::jsonStringToValue(fcmContent));
+		message->SetObjectField(OperationParam::FcmContent.getKey(), JsonUtil::jsonStringToValue(fcmContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(iosContent))
 	{
-		message->SetObjectField(OperationParam::IosContent.getValue(), JsonUtil::jsonStringToValue(iosContent));
+		message->SetObjectField(OperationParam::IosContent.getKey(), JsonUtil::jsonStringToValue(iosContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(facebookContent))
 	{
-		message->SetObjectField(OperationParam::FacebookContent.getValue(), JsonUtil::jsonStringToValue(facebookContent));
+		message->SetObjectField(OperationParam::FacebookContent.getKey(), JsonUtil::jsonStringToValue(facebookContent));
 	}
 
-	message->SetNumberField(OperationParam::StartTimeUTC.getValue(), startTime);
+	message->SetNumberField(OperationParam::StartTimeUTC.getKey(), startTime);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::ScheduledRawNotifcation, message, callback);
 	_client->sendRequest(sc);
@@ -131,24 +131,24 @@ void BrainCloudPushNotification::scheduleRawPushNotificationUTC(const FString &p
 void BrainCloudPushNotification::scheduleRawPushNotificationMinutes(const FString &profileId, const FString &fcmContent, const FString &iosContent, const FString &facebookContent, int32 minutesFromNow, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::ProfileId.getValue(), profileId);
+	message->SetStringField(OperationParam::ProfileId.getKey(), profileId);
 
 	if (OperationParam::isOptionalParamValid(fcmContent))
 	{
-		message->SetObjectField(OperationParam::FcmContent.getValue(), JsonUtil::jsonStringToValue(fcmContent));
+		message->SetObjectField(OperationParam::FcmContent.getKey(), JsonUtil::jsonStringToValue(fcmContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(iosContent))
 	{
-		message->SetObjectField(OperationParam::IosContent.getValue(), JsonUtil::jsonStringToValue(iosContent));
+		message->SetObjectField(OperationParam::IosContent.getKey(), JsonUtil::jsonStringToValue(iosContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(facebookContent))
 	{
-		message->SetObjectField(OperationParam::FacebookContent.getValue(), JsonUtil::jsonStringToValue(facebookContent));
+		message->SetObjectField(OperationParam::FacebookContent.getKey(), JsonUtil::jsonStringToValue(facebookContent));
 	}
 
-	message->SetNumberField(OperationParam::MinutesFromNow.getValue(), minutesFromNow);
+	message->SetNumberField(OperationParam::MinutesFromNow.getKey(), minutesFromNow);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::ScheduledRawNotifcation, message, callback);
 	_client->sendRequest(sc);
@@ -157,21 +157,21 @@ void BrainCloudPushNotification::scheduleRawPushNotificationMinutes(const FStrin
 void BrainCloudPushNotification::sendRawPushNotification(const FString &profileId, const FString &fcmContent, const FString &iosContent, const FString &facebookContent, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getValue(), profileId);
+	message->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getKey(), profileId);
 
 	if (OperationParam::isOptionalParamValid(fcmContent))
 	{
-		message->SetObjectField(OperationParam::FcmContent.getValue(), JsonUtil::jsonStringToValue(fcmContent));
+		message->SetObjectField(OperationParam::FcmContent.getKey(), JsonUtil::jsonStringToValue(fcmContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(iosContent))
 	{
-		message->SetObjectField(OperationParam::IosContent.getValue(), JsonUtil::jsonStringToValue(iosContent));
+		message->SetObjectField(OperationParam::IosContent.getKey(), JsonUtil::jsonStringToValue(iosContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(facebookContent))
 	{
-		message->SetObjectField(OperationParam::FacebookContent.getValue(), JsonUtil::jsonStringToValue(facebookContent));
+		message->SetObjectField(OperationParam::FacebookContent.getKey(), JsonUtil::jsonStringToValue(facebookContent));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendRaw, message, callback);
@@ -181,21 +181,21 @@ void BrainCloudPushNotification::sendRawPushNotification(const FString &profileI
 void BrainCloudPushNotification::sendRawPushNotificationBatch(const TArray<FString> profileIds, const FString &fcmContent, const FString &iosContent, const FString &facebookContent, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::ProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
+	message->SetArrayField(OperationParam::ProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
 
 	if (OperationParam::isOptionalParamValid(fcmContent))
 	{
-		message->SetObjectField(OperationParam::FcmContent.getValue(), JsonUtil::jsonStringToValue(fcmContent));
+		message->SetObjectField(OperationParam::FcmContent.getKey(), JsonUtil::jsonStringToValue(fcmContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(iosContent))
 	{
-		message->SetObjectField(OperationParam::IosContent.getValue(), JsonUtil::jsonStringToValue(iosContent));
+		message->SetObjectField(OperationParam::IosContent.getKey(), JsonUtil::jsonStringToValue(iosContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(facebookContent))
 	{
-		message->SetObjectField(OperationParam::FacebookContent.getValue(), JsonUtil::jsonStringToValue(facebookContent));
+		message->SetObjectField(OperationParam::FacebookContent.getKey(), JsonUtil::jsonStringToValue(facebookContent));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendRawBatch, message, callback);
@@ -205,21 +205,21 @@ void BrainCloudPushNotification::sendRawPushNotificationBatch(const TArray<FStri
 void BrainCloudPushNotification::sendRawPushNotificationToGroup(const FString &groupId, const FString &fcmContent, const FString &iosContent, const FString &facebookContent, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::GroupId.getValue(), groupId);
+	message->SetStringField(OperationParam::GroupId.getKey(), groupId);
 
 	if (OperationParam::isOptionalParamValid(fcmContent))
 	{
-		message->SetObjectField(OperationParam::FcmContent.getValue(), JsonUtil::jsonStringToValue(fcmContent));
+		message->SetObjectField(OperationParam::FcmContent.getKey(), JsonUtil::jsonStringToValue(fcmContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(iosContent))
 	{
-		message->SetObjectField(OperationParam::IosContent.getValue(), JsonUtil::jsonStringToValue(iosContent));
+		message->SetObjectField(OperationParam::IosContent.getKey(), JsonUtil::jsonStringToValue(iosContent));
 	}
 
 	if (OperationParam::isOptionalParamValid(facebookContent))
 	{
-		message->SetObjectField(OperationParam::FacebookContent.getValue(), JsonUtil::jsonStringToValue(facebookContent));
+		message->SetObjectField(OperationParam::FacebookContent.getKey(), JsonUtil::jsonStringToValue(facebookContent));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendRawToGroup, message, callback);
@@ -229,15 +229,15 @@ void BrainCloudPushNotification::sendRawPushNotificationToGroup(const FString &g
 void BrainCloudPushNotification::scheduleNormalizedPushNotificationUTC(const FString &profileId, const FString &alertContentJson, const FString &customDataJson, const int64 startTime, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getValue(), profileId);
-	message->SetObjectField(OperationParam::AlertContent.getValue(), JsonUtil::jsonStringToValue(alertContentJson));
+	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getKey(), profileId);
+	message->SetObjectField(OperationParam::AlertContent.getKey(), JsonUtil::jsonStringToValue(alertContentJson));
 
 	if (OperationParam::isOptionalParamValid(customDataJson))
 	{
-		message->SetObjectField(OperationParam::CustomData.getValue(), JsonUtil::jsonStringToValue(customDataJson));
+		message->SetObjectField(OperationParam::CustomData.getKey(), JsonUtil::jsonStringToValue(customDataJson));
 	}
 
-	message->SetNumberField(OperationParam::StartTimeUTC.getValue(), startTime);
+	message->SetNumberField(OperationParam::StartTimeUTC.getKey(), startTime);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::ScheduleNormalizedNotifcation, message, callback);
 	_client->sendRequest(sc);
@@ -246,15 +246,15 @@ void BrainCloudPushNotification::scheduleNormalizedPushNotificationUTC(const FSt
 void BrainCloudPushNotification::scheduleNormalizedPushNotificationMinutes(const FString &profileId, const FString &alertContentJson, const FString &customDataJson, const int32 minutesFromNow, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getValue(), profileId);
-	message->SetObjectField(OperationParam::AlertContent.getValue(), JsonUtil::jsonStringToValue(alertContentJson));
+	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getKey(), profileId);
+	message->SetObjectField(OperationParam::AlertContent.getKey(), JsonUtil::jsonStringToValue(alertContentJson));
 
 	if (OperationParam::isOptionalParamValid(customDataJson))
 	{
-		message->SetObjectField(OperationParam::CustomData.getValue(), JsonUtil::jsonStringToValue(customDataJson));
+		message->SetObjectField(OperationParam::CustomData.getKey(), JsonUtil::jsonStringToValue(customDataJson));
 	}
 
-	message->SetNumberField(OperationParam::MinutesFromNow.getValue(), minutesFromNow);
+	message->SetNumberField(OperationParam::MinutesFromNow.getKey(), minutesFromNow);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::ScheduleNormalizedNotifcation, message, callback);
 	_client->sendRequest(sc);
@@ -263,15 +263,15 @@ void BrainCloudPushNotification::scheduleNormalizedPushNotificationMinutes(const
 void BrainCloudPushNotification::scheduleRichPushNotificationUTC(const FString &profileId, const int32 notificationTemplateId, const FString &substitutionJson, const int64 startTime, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getValue(), profileId);
-	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getValue(), notificationTemplateId);
+	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getKey(), profileId);
+	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getKey(), notificationTemplateId);
 
 	if (OperationParam::isOptionalParamValid(substitutionJson))
 	{
-		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getValue(), JsonUtil::jsonStringToValue(substitutionJson));
+		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getKey(), JsonUtil::jsonStringToValue(substitutionJson));
 	}
 
-	message->SetNumberField(OperationParam::StartTimeUTC.getValue(), startTime);
+	message->SetNumberField(OperationParam::StartTimeUTC.getKey(), startTime);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::ScheduledRichNotifcation, message, callback);
 	_client->sendRequest(sc);
@@ -280,15 +280,15 @@ void BrainCloudPushNotification::scheduleRichPushNotificationUTC(const FString &
 void BrainCloudPushNotification::scheduleRichPushNotificationMinutes(const FString &profileId, const int32 notificationTemplateId, const FString &substitutionJson, const int32 minutesFromNow, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getValue(), profileId);
-	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getValue(), notificationTemplateId);
+	message->SetStringField(OperationParam::PushNotificationSendParamProfileId.getKey(), profileId);
+	message->SetNumberField(OperationParam::PushNotificationSendParamNotificationTemplateId.getKey(), notificationTemplateId);
 
 	if (OperationParam::isOptionalParamValid(substitutionJson))
 	{
-		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getValue(), JsonUtil::jsonStringToValue(substitutionJson));
+		message->SetObjectField(OperationParam::PushNotificationSendParamSubstitution.getKey(), JsonUtil::jsonStringToValue(substitutionJson));
 	}
 
-	message->SetNumberField(OperationParam::StartTimeUTC.getValue(), minutesFromNow);
+	message->SetNumberField(OperationParam::StartTimeUTC.getKey(), minutesFromNow);
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::ScheduledRichNotifcation, message, callback);
 	_client->sendRequest(sc);
@@ -297,12 +297,12 @@ void BrainCloudPushNotification::scheduleRichPushNotificationMinutes(const FStri
 void BrainCloudPushNotification::sendNormalizedPushNotification(const FString &toProfileId, const FString &alertContentJson, const FString &customDataJson, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getValue(), toProfileId);
-	message->SetObjectField(OperationParam::AlertContent.getValue(), JsonUtil::jsonStringToValue(alertContentJson));
+	message->SetStringField(OperationParam::PushNotificationSendParamToPlayerId.getKey(), toProfileId);
+	message->SetObjectField(OperationParam::AlertContent.getKey(), JsonUtil::jsonStringToValue(alertContentJson));
 
 	if (OperationParam::isOptionalParamValid(customDataJson))
 	{
-		message->SetObjectField(OperationParam::CustomData.getValue(), JsonUtil::jsonStringToValue(customDataJson));
+		message->SetObjectField(OperationParam::CustomData.getKey(), JsonUtil::jsonStringToValue(customDataJson));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendNormalized, message, callback);
@@ -312,12 +312,12 @@ void BrainCloudPushNotification::sendNormalizedPushNotification(const FString &t
 void BrainCloudPushNotification::sendNormalizedPushNotificationBatch(const TArray<FString> profileIds, const FString &alertContentJson, const FString &customDataJson, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetArrayField(OperationParam::ProfileIds.getValue(), JsonUtil::arrayToJsonArray(profileIds));
-	message->SetObjectField(OperationParam::AlertContent.getValue(), JsonUtil::jsonStringToValue(alertContentJson));
+	message->SetArrayField(OperationParam::ProfileIds.getKey(), JsonUtil::arrayToJsonArray(profileIds));
+	message->SetObjectField(OperationParam::AlertContent.getKey(), JsonUtil::jsonStringToValue(alertContentJson));
 
 	if (OperationParam::isOptionalParamValid(customDataJson))
 	{
-		message->SetObjectField(OperationParam::CustomData.getValue(), JsonUtil::jsonStringToValue(customDataJson));
+		message->SetObjectField(OperationParam::CustomData.getKey(), JsonUtil::jsonStringToValue(customDataJson));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::PushNotification, ServiceOperation::SendNormalizedBatch, message, callback);
@@ -119,7 +119,7 @@ void BrainCloudRTTComms::disableRTT()
 	}
 	else
 	{
-		processRegisteredListeners(ServiceName::RTTRegistration.getValue().ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RTT_CLIENT_ERROR, "DisableRTT Called"));
+		processRegisteredListeners(FString(ServiceName::RTTRegistration.getValue()).ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RTT_CLIENT_ERROR, "DisableRTT Called"));
 	}
 }
 
@@ -135,18 +135,21 @@ BCRTTConnectionStatus BrainCloudRTTComms::getConnectionStatus()
 
 void BrainCloudRTTComms::RunCallbacks()
 {
-#if PLATFORM_UWP
-#if ENGINE_MINOR_VERSION <24
-#if PLATFORM_HTML5
-#endif
-#endif
-#else
-	if (m_lwsContext != nullptr)
+	// when threaded the network thread services the socket
+	if (!m_isThreaded)
+		ServiceSockets();
+
+	TArray<RTTSocketEvent> socketEvents;
 	{
-		lws_callback_on_writable_all_protocol(m_lwsContext, &protocols[0]);
-		lws_service(m_lwsContext, 0);
+		FScopeLock Lock(&m_rttMutex);
+		socketEvents = MoveTemp(m_socketEvents);
+		m_socketEvents.Reset();
+	}
+
+	for (int32 i = 0; i < socketEvents.Num(); ++i)
+	{
+		processSocketEvent(socketEvents[i]);
 	}
-#endif
 
 	if (isRTTEnabled())
 	{
@@ -164,6 +167,23 @@ void BrainCloudRTTComms::RunCallbacks()
 	}
 }
 
+void BrainCloudRTTComms::ServiceSockets()
+{
+#if PLATFORM_UWP
+#if ENGINE_MINOR_VERSION <24
+#if PLATFORM_HTML5
+#endif
+#endif
+#else
+	FScopeLock Lock(&m_rttMutex);
+	if (m_lwsContext != nullptr)
+	{
+		lws_callback_on_writable_all_protocol(m_lwsContext, &protocols[0]);
+		lws_service(m_lwsContext, 0);
+	}
+#endif
+}
+
 #if PLATFORM_UWP
 #if ENGINE_MINOR_VERSION <24
 #if PLATFORM_HTML5
@@ -240,18 +260,18 @@ int BrainCloudRTTComms::callback_echo(struct lws *wsi, enum lws_callback_reasons
 void BrainCloudRTTComms::registerRTTCallback(ServiceName in_serviceName, UBCBlueprintRTTCallProxyBase *callback)
 {
 	callback->AddToRoot();
-	m_registeredRTTBluePrintCallbacks.Emplace(in_serviceName.getValue().ToLower(), callback);
+	m_registeredRTTBluePrintCallbacks.Emplace(FString(in_serviceName.getValue()).ToLower(), callback);
 }
 
 // regular c++ overtyped, does nothing memory wise
 void BrainCloudRTTComms::registerRTTCallback(ServiceName in_serviceName, IRTTCallback *callback)
 {
-	m_registeredRTTCallbacks.Emplace(in_serviceName.getValue().ToLower(), callback);
+	m_registeredRTTCallbacks.Emplace(FString(in_serviceName.getValue()).ToLower(), callback);
 }
 
 void BrainCloudRTTComms::deregisterRTTCallback(ServiceName in_serviceName)
 {
-	FString serviceName = in_serviceName.getValue().ToLower();
+	FString serviceName = FString(in_serviceName.getValue()).ToLower();
 	if (m_registeredRTTBluePrintCallbacks.Contains(serviceName))
 	{
 		m_registeredRTTBluePrintCallbacks[serviceName]->RemoveFromRoot();
@@ -298,6 +318,11 @@ void BrainCloudRTTComms::disconnect()
 	if (!isRTTEnabled()) return;
 
 	m_rttConnectionStatus = BCRTTConnectionStatus::DISCONNECTING;
+
+	// the network thread may be servicing the socket
+	FScopeLock Lock(&m_rttMutex);
+	m_socketEvents.Empty();
+
 	// clear everything
 	if (m_connectedSocket != nullptr && m_commsPtr != nullptr)
 	{
@@ -468,6 +493,7 @@ void BrainCloudRTTComms::startReceivingWebSocket()
 
 void BrainCloudRTTComms::setupWebSocket(const FString &in_url)
 {
+	FScopeLock Lock(&m_rttMutex);
 #if PLATFORM_UWP
 #if ENGINE_MINOR_VERSION <24
 #if PLATFORM_HTML5
@@ -538,23 +564,22 @@ void BrainCloudRTTComms::webSocket_OnClose()
 	if (m_client->isLoggingEnabled())
 		UE_LOG(LogBrainCloudComms, Log, TEXT("Connection closed"));
 
-	m_websocketStatus = BCWebsocketStatus::CLOSED;
-	processRegisteredListeners(ServiceName::RTTRegistration.getValue().ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR,"Could not connect at this time"));
+	FScopeLock Lock(&m_rttMutex);
+	m_socketEvents.Add(RTTSocketEvent(BCWebsocketStatus::CLOSED, TEXT("")));
 }
 
 void BrainCloudRTTComms::websocket_OnOpen()
 {
-	// first time connecting? send the server connection call
-	m_rttConnectionStatus = BCRTTConnectionStatus::CONNECTING;
-	m_websocketStatus = BCWebsocketStatus::OPEN;
-	send(buildConnectionRequest());
+	FScopeLock Lock(&m_rttMutex);
+	m_socketEvents.Add(RTTSocketEvent(BCWebsocketStatus::OPEN, TEXT("")));
 }
 
 void BrainCloudRTTComms::webSocket_OnMessage(TArray<uint8> in_data)
 {
-	m_websocketStatus = BCWebsocketStatus::MESSAGE;
 	FString parsedMessage = BrainCloudRelay::BCBytesToString(in_data.GetData(), in_data.Num());
-	onRecv(parsedMessage);
+
+	FScopeLock Lock(&m_rttMutex);
+	m_socketEvents.Add(RTTSocketEvent(BCWebsocketStatus::MESSAGE, parsedMessage));
 }
 
 void BrainCloudRTTComms::webSocket_OnError(const FString &in_message)
@@ -562,8 +587,36 @@ void BrainCloudRTTComms::webSocket_OnError(const FString &in_message)
 	if (m_client->isLoggingEnabled())
 		UE_LOG(LogBrainCloudComms, Log, TEXT("Error: %s"), *in_message);
 
-	m_websocketStatus = BCWebsocketStatus::SOCKETERROR;
-	processRegisteredListeners(ServiceName::RTTRegistration.getValue().ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, in_message));
+	FScopeLock Lock(&m_rttMutex);
+	m_socketEvents.Add(RTTSocketEvent(BCWebsocketStatus::SOCKETERROR, in_message));
+}
+
+void BrainCloudRTTComms::processSocketEvent(const RTTSocketEvent &in_event)
+{
+	m_websocketStatus = in_event.Status;
+	switch (in_event.Status)
+	{
+	case BCWebsocketStatus::OPEN:
+		// first time connecting? send the server connection call
+		m_rttConnectionStatus = BCRTTConnectionStatus::CONNECTING;
+		send(buildConnectionRequest());
+		break;
+
+	case BCWebsocketStatus::CLOSED:
+		processRegisteredListeners(FString(ServiceName::RTTRegistration.getValue()).ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, "Could not connect at this time"));
+		break;
+
+	case BCWebsocketStatus::MESSAGE:
+		onRecv(in_event.Message);
+		break;
+
+	case BCWebsocketStatus::SOCKETERROR:
+		processRegisteredListeners(FString(ServiceName::RTTRegistration.getValue()).ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, in_event.Message));
+		break;
+
+	default:
+		break;
+	}
 }
 
 void BrainCloudRTTComms::onRecv(const FString &in_message)
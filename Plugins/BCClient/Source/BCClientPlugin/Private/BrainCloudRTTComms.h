@@ -45,6 +45,8 @@ class BrainCloudRTTComms : public IServerCallback
 	bool isRTTEnabled();
 	BCRTTConnectionStatus getConnectionStatus();
 	void RunCallbacks();
+	void ServiceSockets();
+	void SetThreaded(bool in_isThreaded) { m_isThreaded = in_isThreaded; }
 
 	void registerRTTCallback(ServiceName in_serviceName, IRTTCallback *callback);
 	void registerRTTCallback(ServiceName in_serviceName, UBCBlueprintRTTCallProxyBase *callback);
@@ -72,6 +74,15 @@ class BrainCloudRTTComms : public IServerCallback
 	void webSocket_OnError(const FString &in_error);
 
   private:
+	// raised by the socket, possibly on the network thread, and handled from RunCallbacks
+	struct RTTSocketEvent
+	{
+		RTTSocketEvent(BCWebsocketStatus in_status, const FString &in_message) : Status(in_status), Message(in_message) {}
+		BCWebsocketStatus Status;
+		FString Message;
+	};
+
+	void processSocketEvent(const RTTSocketEvent &in_event);
 	void connectWebSocket();
 	void disconnect();
 
@@ -124,5 +135,10 @@ class BrainCloudRTTComms : public IServerCallback
 
 	struct lws_context *m_lwsContext;
 
+	// guards the socket and the queued socket events
+	FCriticalSection m_rttMutex;
+	TArray<RTTSocketEvent> m_socketEvents;
+	bool m_isThreaded = false;
+
 	FString BCBytesToString(const uint8* in, int32 count);
 };
@@ -13,10 +13,10 @@ void BrainCloudRedemptionCode::redeemCode(const FString &scanCode, const FString
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetStringField(OperationParam::RedemptionCodeServiceScanCode.getValue(), scanCode);
-    message->SetStringField(OperationParam::RedemptionCodeServiceCodeType.getValue(), codeType);
+    message->SetStringField(OperationParam::RedemptionCodeServiceScanCode.getKey(), scanCode);
+    message->SetStringField(OperationParam::RedemptionCodeServiceCodeType.getKey(), codeType);
     if (OperationParam::isOptionalParamValid(customRedemptionInfo))
-        message->SetStringField(OperationParam::RedemptionCodeServiceCustomRedemptionInfo.getValue(), customRedemptionInfo);
+        message->SetStringField(OperationParam::RedemptionCodeServiceCustomRedemptionInfo.getKey(), customRedemptionInfo);
 
     ServerCall *sc = new ServerCall(ServiceName::RedemptionCode, ServiceOperation::RedeemCode, message, callback);
     _client->sendRequest(sc);
@@ -27,7 +27,7 @@ void BrainCloudRedemptionCode::getRedeemedCodes(const FString &codeType, IServer
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
     if (OperationParam::isOptionalParamValid(codeType))
-        message->SetStringField(OperationParam::RedemptionCodeServiceCodeType.getValue(), codeType);
+        message->SetStringField(OperationParam::RedemptionCodeServiceCodeType.getKey(), codeType);
 
     ServerCall *sc = new ServerCall(ServiceName::RedemptionCode, ServiceOperation::GetRedeemedCodes, message, callback);
     _client->sendRequest(sc);
@@ -50,24 +50,39 @@ void BrainCloudRelay::deregisterDataCallback()
 }
 
 void BrainCloudRelay::send(const TArray<uint8> &in_data, const uint64 in_target, bool in_reliable, bool in_ordered, int in_channel)
+{
+	send(in_data.GetData(), in_data.Num(), in_target, in_reliable, in_ordered, in_channel);
+}
+
+void BrainCloudRelay::send(const uint8 *in_data, int32 in_size, const uint64 in_target, bool in_reliable, bool in_ordered, int in_channel)
 {
 	if (in_target == BrainCloudRelayComms::TO_ALL_PLAYERS)
 	{
-		sendToAll(in_data, in_reliable, in_ordered, in_channel);
+		sendToAll(in_data, in_size, in_reliable, in_ordered, in_channel);
 	}
 	else
 	{
 		uint64 playerMask = (uint64)1 << in_target;
-    	_relayComms->sendRelay(in_data, playerMask, in_reliable, in_ordered, in_channel);
+    	_relayComms->sendRelay(in_data, in_size, playerMask, in_reliable, in_ordered, in_channel);
 	}
 }
 
 void BrainCloudRelay::sendToPlayers(const TArray<uint8> &in_data, const uint64 in_playerMask, bool in_reliable, bool in_ordered, int in_channel)
 {
-    _relayComms->sendRelay(in_data, in_playerMask, in_reliable, in_ordered, in_channel);
+    _relayComms->sendRelay(in_data.GetData(), in_data.Num(), in_playerMask, in_reliable, in_ordered, in_channel);
+}
+
+void BrainCloudRelay::sendToPlayers(const uint8 *in_data, int32 in_size, const uint64 in_playerMask, bool in_reliable, bool in_ordered, int in_channel)
+{
+    _relayComms->sendRelay(in_data, in_size, in_playerMask, in_reliable, in_ordered, in_channel);
 }
 
 void BrainCloudRelay::sendToAll(const TArray<uint8> &in_data, bool in_reliable, bool in_ordered, int in_channel)
+{
+	sendToAll(in_data.GetData(), in_data.Num(), in_reliable, in_ordered, in_channel);
+}
+
+void BrainCloudRelay::sendToAll(const uint8 *in_data, int32 in_size, bool in_reliable, bool in_ordered, int in_channel)
 {
 	const auto& myProfileId = _client->getAuthenticationService()->getProfileId();
 	auto myNetId = _relayComms->getNetIdForProfileId(myProfileId);
@@ -75,7 +90,7 @@ void BrainCloudRelay::sendToAll(const TArray<uint8> &in_data, bool in_reliable,
 	uint64 myBit = (uint64)1 << (uint64)myNetId;
 	uint64 myInvertedBits = ~myBit;
 	uint64 playerMask = BrainCloudRelayComms::TO_ALL_PLAYERS & myInvertedBits;
-    _relayComms->sendRelay(in_data, playerMask, in_reliable, in_ordered, in_channel);
+    _relayComms->sendRelay(in_data, in_size, playerMask, in_reliable, in_ordered, in_channel);
 }
 
 const FString &BrainCloudRelay::getOwnerProfileId() const
@@ -98,6 +113,36 @@ void BrainCloudRelay::setPingInterval(float in_interval)
     _relayComms->setPingInterval(in_interval);
 }
 
+void BrainCloudRelay::setChannelLimits(int in_channel, int in_sendWindow, int in_receiveBuffer)
+{
+    _relayComms->setChannelLimits(in_channel, in_sendWindow, in_receiveBuffer);
+}
+
+void BrainCloudRelay::enableSendBatching(bool in_enabled, int in_maxBatchSize)
+{
+    _relayComms->enableSendBatching(in_enabled, in_maxBatchSize);
+}
+
+void BrainCloudRelay::flush()
+{
+    _relayComms->flushSendBatches();
+}
+
+FBC_RelayStats BrainCloudRelay::getStats() const
+{
+    return _relayComms->getStats();
+}
+
+int64 BrainCloudRelay::getSendAllocationCount() const
+{
+    return _relayComms->getSendAllocationCount();
+}
+
+int64 BrainCloudRelay::getSendAllocatedBytes() const
+{
+    return _relayComms->getSendAllocatedBytes();
+}
+
 FString BrainCloudRelay::BCBytesToString(const uint8* in, int32 count)
 {
 	FString result2;
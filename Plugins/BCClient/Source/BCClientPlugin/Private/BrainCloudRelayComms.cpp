@@ -23,6 +23,9 @@
 
 #include "BCRelayCommsProxy.h"
 #include "WebSocketBase.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
 #include <iostream>
 #include "Runtime/Launch/Resources/Version.h"
 
@@ -58,6 +61,49 @@ static const struct lws_extension extsRS[] = {
 static const int RELIABLE_BIT = 0x8000;
 static const int ORDERED_BIT = 0x4000;
 
+// udp has no connection, these stand in for the socket opening and closing
+static const double UDP_CONNECT_RESEND_INTERVAL = 0.5;
+static const double UDP_CONNECT_TIMEOUT = 10.0;
+static const double UDP_RECEIVE_TIMEOUT = 10.0;
+
+// reliable packets are resent with the retransmit timeout doubling each time
+static const double MIN_RETRANSMIT_TIMEOUT = 0.05;
+static const double MAX_RETRANSMIT_TIMEOUT = 2.0;
+static const double INITIAL_RETRANSMIT_TIMEOUT = 0.25;
+static const double RELIABLE_TIMEOUT = 10.0;
+
+// length prefix, control byte, reliable header and player mask
+static const int RELAY_HEADER_LENGTH = 11;
+// pooled buffers fit any relay packet up to MAX_PACKETSIZE
+static const int POOLED_PACKET_SIZE = BrainCloudRelayComms::MAX_PACKETSIZE + RELAY_HEADER_LENGTH;
+static const int MAX_POOLED_PACKETS = 256;
+
+// batched messages are framed by this, then each by its 2 byte length
+static const uint8 BATCH_MAGIC[] = { 0xBC, 0xBA, 0x7C, 0x4D };
+static const int BATCH_MAGIC_LENGTH = 4;
+static const int BATCH_LENGTH_PREFIX = 2;
+
+// clock offsets are taken from the fastest of the last few pings
+static const int MAX_CLOCK_SAMPLES = 8;
+
+// received data waiting on the callbacks, past this it is queued in arrays of its own
+static const int RECEIVE_RING_SIZE = 256 * 1024;
+
+static uint64 readUInt64BE(const uint8 *in_data)
+{
+	uint64 value = 0;
+	for (int i = 0; i < 8; ++i)
+		value = (value << 8) | in_data[i];
+	return value;
+}
+
+// true if a comes after b, allowing for the 12 bit packet ids wrapping
+static bool isPacketIdNewer(int a, int b)
+{
+	int diff = (a - b) & BrainCloudRelayComms::MAX_PACKET_ID;
+	return diff != 0 && diff <= BrainCloudRelayComms::MAX_PACKET_ID / 2;
+}
+
 BrainCloudRelayComms::BrainCloudRelayComms(BrainCloudClient *client)
 	: m_client(client)
 	, m_appCallback(nullptr)
@@ -66,6 +112,26 @@ BrainCloudRelayComms::BrainCloudRelayComms(BrainCloudClient *client)
 	, m_registeredRelayCallback(nullptr)
 	, m_registeredRelayBluePrintCallback(nullptr)
 	, m_connectedSocket(nullptr)
+	, m_udpSocket(nullptr)
+	, m_lastRecvTime(0.0)
+	, m_connectRequestTime(0.0)
+	, m_lastConnectRequestTime(0.0)
+	, m_smoothedRtt(0.0)
+	, m_rttVariance(0.0)
+	, m_hasRttSample(false)
+	, m_lastRttMs(0.0)
+	, m_isPingPending(false)
+	, m_statsWindowStart(0.0)
+	, m_windowPingsSent(0)
+	, m_windowPingsLost(0)
+	, m_windowPacketsExpected(0)
+	, m_windowPacketsMissing(0)
+	, m_windowBytesSent(0)
+	, m_windowBytesReceived(0)
+	, m_windowPacketsSent(0)
+	, m_windowPacketsReceived(0)
+	, m_sendAllocationCount(0)
+	, m_sendAllocatedBytes(0)
 	, m_bIsConnected(false)
 	, m_pingInterval(1.0f)
 	, m_timeSinceLastPingRequest(0.0f)
@@ -74,8 +140,14 @@ BrainCloudRelayComms::BrainCloudRelayComms(BrainCloudClient *client)
 	, m_ping(999)
 	, m_netId(-1)
 	, m_lwsContext(nullptr)
+	, m_receiveRingHead(0)
+	, m_receiveRingTail(0)
+	, m_receiveRingWrapped(false)
+	, m_receiveRingLap(0)
+	, m_maxBatchSize(0)
 {
 	m_relayResponse.Empty();
+	m_packetPool.Reserve(MAX_POOLED_PACKETS);
 }
 
 BrainCloudRelayComms::~BrainCloudRelayComms()
@@ -113,7 +185,7 @@ void BrainCloudRelayComms::disconnect()
 		// lock 
 		{
     		FScopeLock Lock(&m_relayMutex);
-			m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, "DisableRS Called"), TArray<uint8>()));
+			m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, "DisableRS Called"), TArray<uint8>()));
 		}
 	}
 }
@@ -151,16 +223,36 @@ void BrainCloudRelayComms::deregisterDataCallback()
 
 void BrainCloudRelayComms::RunCallbacks()
 {
-	// lock 
+	// when threaded the network thread services the socket
+	if (!m_isThreaded)
+		ServiceSockets();
+
+	updateUDPConnection();
+
+	// take the responses out under the lock, the callbacks run without it.
+	// The ring is left alone up to its head until they are done.
+	int32 receivedUpTo = 0;
+	int32 receivedLap = 0;
 	{
     	FScopeLock Lock(&m_relayMutex);
-		RelayMessage toProcess;
-		for (int i = 0; i < m_relayResponse.Num(); ++i)
-		{
-			toProcess = m_relayResponse[i];
-			processRegisteredListeners(toProcess.Service, toProcess.Operation, toProcess.JsonMessage, toProcess.Data);
-		}
-		m_relayResponse.Empty();
+		Swap(m_relayResponse, m_processingResponse);
+		receivedUpTo = m_receiveRingHead;
+		receivedLap = m_receiveRingLap;
+	}
+
+	for (int i = 0; i < m_processingResponse.Num(); ++i)
+	{
+		const RelayMessage &message = m_processingResponse[i];
+		if (message.RingOffset != INDEX_NONE)
+			notifyDataCallbacks(m_receiveRing.GetData() + message.RingOffset, message.RingSize);
+		else
+			processRegisteredListeners(message.Service, message.Operation, message.JsonMessage, message.Data.GetData(), message.Data.Num());
+	}
+	m_processingResponse.Reset();
+
+	{
+		FScopeLock Lock(&m_relayMutex);
+		releaseReceived(receivedUpTo, receivedLap);
 	}
 
 	// run ping 
@@ -176,23 +268,32 @@ void BrainCloudRelayComms::RunCallbacks()
             m_timeSinceLastPingRequest = 0;
             sendPing();
         }
+
+        FScopeLock Lock(&m_relayMutex);
+        updateStats(nowMS);
     }
 
+	// whatever was batched this tick
+	flushSendBatches();
+}
+
+void BrainCloudRelayComms::ServiceSockets()
+{
 #if PLATFORM_UWP
 #if ENGINE_MINOR_VERSION <24
 #if PLATFORM_HTML5
 #endif
 #endif
 #else
+	FScopeLock Lock(&m_relayMutex);
+	if (m_lwsContext != nullptr)
 	{
-    	FScopeLock Lock(&m_relayMutex);
-		if (m_lwsContext != nullptr)
-		{
-			lws_callback_on_writable_all_protocol(m_lwsContext, &protocolsRS[0]);
-			lws_service(m_lwsContext, 0);
-		}
+		lws_callback_on_writable_all_protocol(m_lwsContext, &protocolsRS[0]);
+		lws_service(m_lwsContext, 0);
 	}
 #endif
+
+	serviceUDP();
 }
 
 #if PLATFORM_UWP
@@ -261,10 +362,484 @@ void BrainCloudRelayComms::connectWebSocket(FString in_host, int in_port, bool i
 	setupWebSocket(url);
 }
 
+void BrainCloudRelayComms::connectUDP(const FString &in_host, int in_port)
+{
+	ISocketSubsystem *socketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	FAddressInfoResult addressInfo = socketSubsystem->GetAddressInfo(*in_host, nullptr, EAddressInfoFlags::Default, NAME_None, ESocketType::SOCKTYPE_Datagram);
+	if (addressInfo.ReturnCode != SE_NO_ERROR || addressInfo.Results.Num() == 0)
+	{
+		queueDisconnect(FString::Printf(TEXT("Relay: Could not resolve %s"), *in_host));
+		return;
+	}
+
+	FScopeLock Lock(&m_relayMutex);
+	m_udpServerAddr = addressInfo.Results[0].Address;
+	m_udpServerAddr->SetPort(in_port);
+
+	m_udpSocket = socketSubsystem->CreateSocket(NAME_DGram, TEXT("brainCloud relay"), m_udpServerAddr->GetProtocolType());
+	if (m_udpSocket == nullptr)
+	{
+		m_udpServerAddr.Reset();
+		queueDisconnect(TEXT("Relay: Could not create udp socket"));
+		return;
+	}
+
+	int32 actualSize = 0;
+	m_udpSocket->SetNonBlocking(true);
+	m_udpSocket->SetReceiveBufferSize(64 * 1024, actualSize);
+	m_udpRecvBuffer.SetNumUninitialized(64 * 1024);
+	m_lastRecvTime = FPlatformTime::Seconds();
+
+	if (m_client->isLoggingEnabled())
+		UE_LOG(LogBrainCloudComms, Log, TEXT("Relay udp socket open to %s"), *m_udpServerAddr->ToString(true));
+
+	// nothing to wait for, the connect request goes out right away
+	m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "connect", "", TArray<uint8>()));
+}
+
+void BrainCloudRelayComms::serviceUDP()
+{
+	FScopeLock Lock(&m_relayMutex);
+	if (m_udpSocket == nullptr)
+		return;
+
+	TSharedRef<FInternetAddr> fromAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+	uint32 pendingSize = 0;
+	while (m_udpSocket->HasPendingData(pendingSize))
+	{
+		int32 bytesRead = 0;
+		if (!m_udpSocket->RecvFrom(m_udpRecvBuffer.GetData(), m_udpRecvBuffer.Num(), bytesRead, *fromAddr))
+			break;
+
+		// stray datagrams from anywhere but the relay server are dropped
+		if (bytesRead <= SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY || !fromAddr->CompareEndpoints(*m_udpServerAddr))
+			continue;
+
+		m_lastRecvTime = FPlatformTime::Seconds();
+		m_windowBytesReceived += bytesRead;
+		++m_windowPacketsReceived;
+		onRecv(m_udpRecvBuffer.GetData() + SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY, bytesRead - SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY);
+	}
+}
+
+void BrainCloudRelayComms::updateUDPConnection()
+{
+	FScopeLock Lock(&m_relayMutex);
+	if (m_udpSocket == nullptr)
+		return;
+
+	double now = FPlatformTime::Seconds();
+	if (!m_bIsConnected)
+	{
+		if (m_connectRequestTime <= 0.0)
+			return;
+
+		if (now - m_connectRequestTime > UDP_CONNECT_TIMEOUT)
+		{
+			m_connectRequestTime = 0.0;
+			queueDisconnect(TEXT("Relay: Could not connect at this time"));
+		}
+		else if (now - m_lastConnectRequestTime >= UDP_CONNECT_RESEND_INTERVAL)
+		{
+			m_lastConnectRequestTime = now;
+			send(buildConnectionRequest(), CL2RS_CONNECT);
+		}
+	}
+	else if (now - m_lastRecvTime > UDP_RECEIVE_TIMEOUT)
+	{
+		// pings are answered, so silence means the server is gone
+		m_lastRecvTime = now;
+		queueDisconnect(TEXT("Relay: Connection timed out"));
+	}
+	else
+	{
+		resendReliables(now);
+	}
+}
+
+void BrainCloudRelayComms::setChannelLimits(int in_channel, int in_sendWindow, int in_receiveBuffer)
+{
+	if (in_channel < 0 || in_channel >= MAX_CHANNELS)
+		return;
+
+	// no more than half the packet id space can be told apart
+	FScopeLock Lock(&m_relayMutex);
+	m_channelLimits[in_channel].SendWindow = FMath::Clamp(in_sendWindow, 1, MAX_PACKET_ID / 2);
+	m_channelLimits[in_channel].ReceiveBuffer = FMath::Clamp(in_receiveBuffer, 0, MAX_PACKET_ID / 2);
+}
+
+void BrainCloudRelayComms::sendReliable(uint64 in_ackId, int in_channel, TArray<uint8> &in_datagram)
+{
+	FScopeLock Lock(&m_relayMutex);
+
+	ReliablePacket packet;
+	packet.AckId = in_ackId;
+	packet.Datagram = MoveTemp(in_datagram);
+
+	TArray<ReliablePacket> &unacked = m_unacked[in_channel];
+	TArray<ReliablePacket> &backlog = m_backlog[in_channel];
+	if (unacked.Num() < m_channelLimits[in_channel].SendWindow)
+	{
+		packet.FirstSendTime = FPlatformTime::Seconds();
+		packet.LastSendTime = packet.FirstSendTime;
+		sendBytes(packet.Datagram.GetData(), packet.Datagram.Num());
+		SIZE_T sizeBefore = unacked.GetAllocatedSize();
+		unacked.Add(MoveTemp(packet));
+		recordSendGrowth(sizeBefore, unacked.GetAllocatedSize());
+	}
+	else if (backlog.Num() < m_channelLimits[in_channel].SendWindow)
+	{
+		SIZE_T sizeBefore = backlog.GetAllocatedSize();
+		backlog.Add(MoveTemp(packet));
+		recordSendGrowth(sizeBefore, backlog.GetAllocatedSize());
+	}
+	else
+	{
+		// the server has stopped acking, the timeout will disconnect
+		UE_LOG(LogBrainCloudComms, Warning, TEXT("Relay: Reliable send window of channel %d is full, packet dropped"), in_channel);
+		releasePacket(packet.Datagram);
+	}
+}
+
+void BrainCloudRelayComms::onAck(uint64 in_ackId)
+{
+	FScopeLock Lock(&m_relayMutex);
+
+	int channel = (int)((in_ackId >> 60) & 0x3);
+	TArray<ReliablePacket> &unacked = m_unacked[channel];
+	int32 index = unacked.IndexOfByPredicate([in_ackId](const ReliablePacket &packet) { return packet.AckId == in_ackId; });
+	if (index == INDEX_NONE)
+		return;
+
+	// only packets sent once say how long the round trip took
+	double now = FPlatformTime::Seconds();
+	if (unacked[index].Resends == 0)
+	{
+		double sample = now - unacked[index].LastSendTime;
+		if (m_smoothedRtt <= 0.0)
+		{
+			m_smoothedRtt = sample;
+			m_rttVariance = sample / 2.0;
+		}
+		else
+		{
+			m_rttVariance = 0.75 * m_rttVariance + 0.25 * FMath::Abs(m_smoothedRtt - sample);
+			m_smoothedRtt = 0.875 * m_smoothedRtt + 0.125 * sample;
+		}
+	}
+	releasePacket(unacked[index].Datagram);
+	unacked.RemoveAt(index, 1, false);
+
+	// the window has room again
+	TArray<ReliablePacket> &backlog = m_backlog[channel];
+	while (backlog.Num() > 0 && unacked.Num() < m_channelLimits[channel].SendWindow)
+	{
+		ReliablePacket &packet = backlog[0];
+		packet.FirstSendTime = now;
+		packet.LastSendTime = now;
+		sendBytes(packet.Datagram.GetData(), packet.Datagram.Num());
+		SIZE_T sizeBefore = unacked.GetAllocatedSize();
+		unacked.Add(MoveTemp(packet));
+		recordSendGrowth(sizeBefore, unacked.GetAllocatedSize());
+		backlog.RemoveAt(0, 1, false);
+	}
+}
+
+double BrainCloudRelayComms::getRetransmitTimeout() const
+{
+	if (m_smoothedRtt <= 0.0)
+		return INITIAL_RETRANSMIT_TIMEOUT;
+	return FMath::Clamp(m_smoothedRtt + 4.0 * m_rttVariance, MIN_RETRANSMIT_TIMEOUT, MAX_RETRANSMIT_TIMEOUT);
+}
+
+void BrainCloudRelayComms::resendReliables(double in_now)
+{
+	double timeout = getRetransmitTimeout();
+	for (int channel = 0; channel < MAX_CHANNELS; ++channel)
+	{
+		for (ReliablePacket &packet : m_unacked[channel])
+		{
+			if (in_now - packet.FirstSendTime > RELIABLE_TIMEOUT)
+			{
+				queueDisconnect(TEXT("Relay: Reliable packet was never acknowledged"));
+				return;
+			}
+
+			double packetTimeout = FMath::Min(timeout * (double)(1 << FMath::Min(packet.Resends, 5)), MAX_RETRANSMIT_TIMEOUT);
+			if (in_now - packet.LastSendTime >= packetTimeout)
+			{
+				packet.LastSendTime = in_now;
+				++packet.Resends;
+				sendBytes(packet.Datagram.GetData(), packet.Datagram.Num());
+			}
+		}
+	}
+}
+
+void BrainCloudRelayComms::receiveRelay(const uint8 *in_data, int32 in_size)
+{
+	const uint8 *header = in_data + 1;
+	const uint8 *payload = header + 8;
+	int32 payloadSize = in_size - 9;
+
+	uint64 ackId = readUInt64BE(header);
+	uint16 rh = (uint16)(ackId >> 48);
+	bool reliable = (rh & RELIABLE_BIT) != 0;
+	bool ordered = (rh & ORDERED_BIT) != 0;
+	int channel = (rh >> 12) & 0x3;
+	int packetId = rh & MAX_PACKET_ID;
+
+	FScopeLock Lock(&m_relayMutex);
+	ReceiveStream &stream = m_receiveStreams.FindOrAdd(ackId & 0xF000FFFFFFFFFFFF);
+
+	// ids skipped over count as lost, even if a resend fills them in later
+	if (!stream.HasHighestPacketId)
+	{
+		stream.HighestPacketId = packetId;
+		stream.HasHighestPacketId = true;
+		++m_windowPacketsExpected;
+	}
+	else if (isPacketIdNewer(packetId, stream.HighestPacketId))
+	{
+		int gap = (packetId - stream.HighestPacketId) & MAX_PACKET_ID;
+		m_windowPacketsExpected += gap;
+		m_windowPacketsMissing += gap - 1;
+		stream.HighestPacketId = packetId;
+	}
+
+	if (!ordered)
+	{
+		if (reliable)
+		{
+			// acked every time, the earlier ack may have been lost
+			sendAck(header);
+			if (stream.RecentIds.Contains(packetId))
+				return;
+			stream.RecentIds.Add(packetId);
+			if (stream.RecentIds.Num() > MAX_PACKET_ID / 2)
+				stream.RecentIds.RemoveAt(0);
+		}
+		unpackRelay(payload, payloadSize);
+		return;
+	}
+
+	// the stream starts at whatever comes first, not at 0, the sender may have
+	// been sending since before we joined or reconnected
+	if (!stream.HasLastPacketId)
+	{
+		stream.LastPacketId = (packetId - 1) & MAX_PACKET_ID;
+		stream.HasLastPacketId = true;
+	}
+
+	int expectedId = (stream.LastPacketId + 1) & MAX_PACKET_ID;
+	if (packetId == expectedId)
+	{
+		if (reliable)
+			sendAck(header);
+		unpackRelay(payload, payloadSize);
+		stream.LastPacketId = packetId;
+
+		// then whatever was waiting on it
+		int32 next;
+		while ((next = stream.Buffered.IndexOfByPredicate([&stream](const ReceivedPacket &packet) { return packet.PacketId == ((stream.LastPacketId + 1) & MAX_PACKET_ID); })) != INDEX_NONE)
+		{
+			unpackRelay(stream.Buffered[next].Data.GetData(), stream.Buffered[next].Data.Num());
+			stream.LastPacketId = stream.Buffered[next].PacketId;
+			stream.Buffered.RemoveAtSwap(next);
+		}
+		return;
+	}
+
+	if (!isPacketIdNewer(packetId, stream.LastPacketId))
+	{
+		// delivered already
+		if (reliable)
+			sendAck(header);
+		return;
+	}
+
+	// unreliable ordered packets skip what went missing
+	if (!reliable)
+	{
+		unpackRelay(payload, payloadSize);
+		stream.LastPacketId = packetId;
+		return;
+	}
+
+	if (!stream.Buffered.ContainsByPredicate([packetId](const ReceivedPacket &packet) { return packet.PacketId == packetId; }))
+	{
+		// left unacked when there is no room, the server sends it again
+		if (stream.Buffered.Num() >= m_channelLimits[channel].ReceiveBuffer)
+			return;
+
+		ReceivedPacket &buffered = stream.Buffered.AddDefaulted_GetRef();
+		buffered.PacketId = packetId;
+		buffered.Data.Append(payload, payloadSize);
+	}
+	sendAck(header);
+}
+
+void BrainCloudRelayComms::deliverRelay(const uint8 *in_data, int32 in_size)
+{
+	if (in_size <= 0)
+		return;
+
+	FScopeLock Lock(&m_relayMutex);
+	if (m_receiveRing.Num() == 0)
+		m_receiveRing.SetNumUninitialized(RECEIVE_RING_SIZE);
+
+	// free space is [head, tail) once wrapped, otherwise [head, end) then [0, tail)
+	int32 offset = INDEX_NONE;
+	if (m_receiveRingWrapped)
+	{
+		if (m_receiveRingTail - m_receiveRingHead >= in_size)
+			offset = m_receiveRingHead;
+	}
+	else if (m_receiveRing.Num() - m_receiveRingHead >= in_size)
+	{
+		offset = m_receiveRingHead;
+	}
+	else if (m_receiveRingTail >= in_size)
+	{
+		offset = 0;
+		m_receiveRingWrapped = true;
+		++m_receiveRingLap;
+	}
+
+	// the callbacks have fallen behind, this one gets an array of its own
+	if (offset == INDEX_NONE)
+	{
+		m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "onrecv", "", TArray<uint8>(in_data, in_size)));
+		return;
+	}
+
+	FMemory::Memcpy(m_receiveRing.GetData() + offset, in_data, in_size);
+	m_receiveRingHead = offset + in_size;
+
+	RelayMessage &message = m_relayResponse.AddDefaulted_GetRef();
+	message.RingOffset = offset;
+	message.RingSize = in_size;
+}
+
+void BrainCloudRelayComms::releaseReceived(int32 in_upTo, int32 in_lap)
+{
+	// everything before the head as it was, on whichever lap that was
+	m_receiveRingTail = in_upTo;
+	m_receiveRingWrapped = in_lap != m_receiveRingLap;
+	if (!m_receiveRingWrapped && m_receiveRingTail == m_receiveRingHead)
+	{
+		m_receiveRingHead = 0;
+		m_receiveRingTail = 0;
+	}
+}
+
+bool BrainCloudRelayComms::isSocketOpen()
+{
+	return m_connectedSocket != nullptr || m_udpSocket != nullptr;
+}
+
+void BrainCloudRelayComms::sendBytes(const uint8 *in_data, int32 in_size)
+{
+	FScopeLock Lock(&m_relayMutex);
+	if (m_udpSocket != nullptr)
+	{
+		int32 bytesSent = 0;
+		m_udpSocket->SendTo(in_data, in_size, bytesSent, *m_udpServerAddr);
+	}
+	else if (m_connectedSocket != nullptr)
+	{
+		m_connectedSocket->SendData(in_data, in_size);
+	}
+	else
+	{
+		return;
+	}
+
+	m_windowBytesSent += in_size;
+	++m_windowPacketsSent;
+}
+
+TArray<uint8> BrainCloudRelayComms::acquirePacket(int32 in_size)
+{
+	TArray<uint8> packet;
+	if (m_packetPool.Num() > 0)
+		packet = m_packetPool.Pop(false);
+
+	// a new buffer, or a pooled one too small for this packet
+	if (packet.Max() < in_size)
+	{
+		int32 capacity = FMath::Max(in_size, POOLED_PACKET_SIZE);
+		packet.Reserve(capacity);
+		++m_sendAllocationCount;
+		m_sendAllocatedBytes += capacity;
+	}
+	packet.SetNumUninitialized(in_size, false);
+	return packet;
+}
+
+void BrainCloudRelayComms::releasePacket(TArray<uint8> &in_packet)
+{
+	if (m_packetPool.Num() >= MAX_POOLED_PACKETS)
+	{
+		in_packet.Empty();
+		return;
+	}
+
+	in_packet.Reset();
+	SIZE_T sizeBefore = m_packetPool.GetAllocatedSize();
+	m_packetPool.Add(MoveTemp(in_packet));
+	recordSendGrowth(sizeBefore, m_packetPool.GetAllocatedSize());
+}
+
+void BrainCloudRelayComms::recordSendGrowth(SIZE_T in_sizeBefore, SIZE_T in_sizeAfter)
+{
+	// a container on the send path outgrew its allocation and took a new one
+	if (in_sizeAfter <= in_sizeBefore)
+		return;
+	++m_sendAllocationCount;
+	m_sendAllocatedBytes += (int64)in_sizeAfter;
+}
+
+int64 BrainCloudRelayComms::getSendAllocationCount() const
+{
+	FScopeLock Lock(&m_relayMutex);
+	return m_sendAllocationCount;
+}
+
+int64 BrainCloudRelayComms::getSendAllocatedBytes() const
+{
+	FScopeLock Lock(&m_relayMutex);
+	return m_sendAllocatedBytes;
+}
+
+void BrainCloudRelayComms::sendAck(const uint8 *in_ackId)
+{
+	// the reliable header and player mask of the packet, as received
+	send(in_ackId, 8, CL2RS_ACK);
+}
+
+void BrainCloudRelayComms::sendRSMGAck(int in_rsmgPacketId)
+{
+	uint8 rsmgPacketId[2] = { (uint8)(in_rsmgPacketId >> 8), (uint8)in_rsmgPacketId };
+	send(rsmgPacketId, 2, CL2RS_RSMG_ACK);
+}
+
+void BrainCloudRelayComms::queueDisconnect(const FString &in_message)
+{
+	if (m_client->isLoggingEnabled())
+		UE_LOG(LogBrainCloudComms, Log, TEXT("%s"), *in_message);
+
+	FScopeLock Lock(&m_relayMutex);
+	m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, in_message), TArray<uint8>()));
+}
+
 void BrainCloudRelayComms::disconnectImpl()
 {
     m_bIsConnected = false;
 
+	// the network thread may be servicing the socket
+	FScopeLock Lock(&m_relayMutex);
+
 	// clear everything
 	if (m_connectedSocket != nullptr && m_commsPtr != nullptr)
 	{
@@ -273,14 +848,50 @@ void BrainCloudRelayComms::disconnectImpl()
 		m_connectedSocket->OnConnectError.RemoveDynamic(m_commsPtr, &UBCRelayCommsProxy::WebSocket_OnError);
 		m_connectedSocket->OnClosed.RemoveDynamic(m_commsPtr, &UBCRelayCommsProxy::WebSocket_OnClose);
 		m_connectedSocket->OnConnectComplete.RemoveDynamic(m_commsPtr, &UBCRelayCommsProxy::Websocket_OnOpen);
-		m_connectedSocket->OnReceiveData.RemoveDynamic(m_commsPtr, &UBCRelayCommsProxy::WebSocket_OnMessage);
+		m_connectedSocket->OnReceiveBytes.Remove(m_receiveBytesHandle);
 	}
 
-	// lock 
+	m_relayResponse.Empty();
+
+	if (m_udpSocket != nullptr)
 	{
-    	FScopeLock Lock(&m_relayMutex);
-		m_relayResponse.Empty();
+		m_udpSocket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(m_udpSocket);
+		m_udpSocket = nullptr;
+	}
+	m_udpServerAddr.Reset();
+	m_rsmgHistory.Empty();
+	m_connectRequestTime = 0.0;
+	for (int channel = 0; channel < MAX_CHANNELS; ++channel)
+	{
+		for (ReliablePacket &packet : m_unacked[channel])
+			releasePacket(packet.Datagram);
+		for (ReliablePacket &packet : m_backlog[channel])
+			releasePacket(packet.Datagram);
+		m_unacked[channel].Reset();
+		m_backlog[channel].Reset();
 	}
+	m_receiveStreams.Empty();
+	for (SendBatch &batch : m_sendBatches)
+		releasePacket(batch.Packet);
+	m_sendBatches.Reset();
+	m_smoothedRtt = 0.0;
+	m_rttVariance = 0.0;
+
+	m_stats = FBC_RelayStats();
+	m_hasRttSample = false;
+	m_lastRttMs = 0.0;
+	m_isPingPending = false;
+	m_statsWindowStart = 0.0;
+	m_windowPingsSent = 0;
+	m_windowPingsLost = 0;
+	m_windowPacketsExpected = 0;
+	m_windowPacketsMissing = 0;
+	m_windowBytesSent = 0;
+	m_windowBytesReceived = 0;
+	m_windowPacketsSent = 0;
+	m_windowPacketsReceived = 0;
+	m_clockSamples.Reset();
 
 	if (m_commsPtr)
 		m_commsPtr->ConditionalBeginDestroy();
@@ -319,36 +930,46 @@ void BrainCloudRelayComms::disconnectImpl()
 	m_ping = 999;
 }
 
-static uint16 toBigEndian(uint16 val)
+void BrainCloudRelayComms::send(const TArray<uint8> &in_data, const uint8 in_controlByte)
 {
-	if (!FGenericPlatformProperties::IsLittleEndian())
-		return val;
-
-	return (uint16)(((val >> 8) & 0x00FF) |
-		            ((val << 8) & 0xFF00));
+	send(in_data.GetData(), in_data.Num(), in_controlByte);
 }
 
-void BrainCloudRelayComms::send(const TArray<uint8> &in_data, const uint8 in_controlByte)
+void BrainCloudRelayComms::send(const uint8 *in_data, int32 in_size, const uint8 in_controlByte)
 {
-	if (m_connectedSocket == nullptr)
+	if (!isSocketOpen())
 	{
 		return;
 	}
 
-	// [dsl] So.. many.. array reallocations
-	TArray<uint8> header;
-	header.Add(in_controlByte);
-    TArray<uint8> toSendData = concatenateByteArrays(header, in_data);
-	toSendData = appendSizeBytes(toSendData);
-	m_connectedSocket->SendData(toSendData);
+	FScopeLock Lock(&m_relayMutex);
+
+	// length prefix and control byte, then the data
+	int32 totalSize = in_size + SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY + CONTROL_BYTE_HEADER_LENGTH;
+	TArray<uint8> toSendData = acquirePacket(totalSize);
+	uint8 *packet = toSendData.GetData();
+	packet[0] = (uint8)(totalSize >> 8);
+	packet[1] = (uint8)totalSize;
+	packet[2] = in_controlByte;
+	if (in_size > 0)
+		FMemory::Memcpy(packet + 3, in_data, in_size);
+
+	sendBytes(packet, totalSize);
+	releasePacket(toSendData);
 }
 
-// sends pure in_data
 void BrainCloudRelayComms::sendRelay(const TArray<uint8> &in_data, const uint64 in_playerMask, 
 								bool in_reliable /*= true*/, bool in_ordered/* = true*/, int in_channel/* = 0*/)
+{
+	sendRelay(in_data.GetData(), in_data.Num(), in_playerMask, in_reliable, in_ordered, in_channel);
+}
+
+// sends pure in_data
+void BrainCloudRelayComms::sendRelay(const uint8 *in_data, int32 in_size, const uint64 in_playerMask, 
+								bool in_reliable /*= true*/, bool in_ordered/* = true*/, int in_channel/* = 0*/)
 {
 	// early return
-	if (m_connectedSocket == nullptr)
+	if (!isSocketOpen())
 	{
 		return;
 	}
@@ -358,17 +979,8 @@ void BrainCloudRelayComms::sendRelay(const TArray<uint8> &in_data, const uint64
 		return;
 	}
 
-	// Allocate buffer
-	auto totalSize = in_data.Num() + 11;
-	TArray<uint8> toSendData;
-	toSendData.SetNum(totalSize);
-
-	// Size
-	uint16 len = toBigEndian((uint16)totalSize);
-	memcpy(toSendData.GetData(), &len, 2);
-
-	// NetId
-	toSendData[2] = (uint8)CL2RS_RELAY;
+	// the packet ids and the pooled buffers are shared with the network thread
+	FScopeLock Lock(&m_relayMutex);
 
 	// Reliable header
 	uint16 rh = 0;
@@ -387,47 +999,206 @@ void BrainCloudRelayComms::sendRelay(const TArray<uint8> &in_data, const uint64
 	// AckId without packet id
 	uint64 ackIdWithoutPacketId = (((uint64)rh << 48) & 0xFFFF000000000000) | playerMask;
 
-	// Packet Id
-	int packetId = 0;
-	if (m_sendPacketId.Contains(ackIdWithoutPacketId))
+	if (m_maxBatchSize > 0)
 	{
-		packetId = m_sendPacketId[ackIdWithoutPacketId];
+		if (queueBatched(ackIdWithoutPacketId, in_data, in_size))
+			return;
+
+		// too big to batch, what was batched for the same players goes first
+		int32 index = m_sendBatches.IndexOfByPredicate([ackIdWithoutPacketId](const SendBatch &batch) { return batch.AckIdWithoutPacketId == ackIdWithoutPacketId; });
+		if (index != INDEX_NONE)
+		{
+			sendBatch(m_sendBatches[index]);
+			m_sendBatches.RemoveAt(index, 1, false);
+		}
+
+		// a message which looks like a batch goes framed as a batch of one,
+		// or the receiver would split it
+		if (in_size >= BATCH_MAGIC_LENGTH && FMemory::Memcmp(in_data, BATCH_MAGIC, BATCH_MAGIC_LENGTH) == 0)
+		{
+			int32 totalSize = RELAY_HEADER_LENGTH + BATCH_MAGIC_LENGTH + BATCH_LENGTH_PREFIX + in_size;
+			if (in_size > 0xFFFF || totalSize > 0xFFFF)
+			{
+				UE_LOG(LogBrainCloudComms, Warning, TEXT("Relay: Message of %d bytes is too big to send framed, dropped"), in_size);
+				return;
+			}
+
+			TArray<uint8> framed = acquirePacket(totalSize);
+			uint8 *entry = framed.GetData() + RELAY_HEADER_LENGTH;
+			FMemory::Memcpy(entry, BATCH_MAGIC, BATCH_MAGIC_LENGTH);
+			entry[BATCH_MAGIC_LENGTH] = (uint8)(in_size >> 8);
+			entry[BATCH_MAGIC_LENGTH + 1] = (uint8)in_size;
+			FMemory::Memcpy(entry + BATCH_MAGIC_LENGTH + BATCH_LENGTH_PREFIX, in_data, in_size);
+			sendRelayPacket(framed, ackIdWithoutPacketId);
+			return;
+		}
 	}
-	else
+
+	// everything is written once, straight into a pooled buffer
+	TArray<uint8> toSendData = acquirePacket(in_size + RELAY_HEADER_LENGTH);
+	if (in_size > 0)
+		FMemory::Memcpy(toSendData.GetData() + RELAY_HEADER_LENGTH, in_data, in_size);
+	sendRelayPacket(toSendData, ackIdWithoutPacketId);
+}
+
+void BrainCloudRelayComms::sendRelayPacket(TArray<uint8> &in_packet, uint64 in_ackIdWithoutPacketId)
+{
+	uint8 *packet = in_packet.GetData();
+	int32 totalSize = in_packet.Num();
+
+	// Size
+	packet[0] = (uint8)(totalSize >> 8);
+	packet[1] = (uint8)totalSize;
+
+	// NetId
+	packet[2] = (uint8)CL2RS_RELAY;
+
+	// Packet Id, the first packet to a set of players and channel adds its counter
+	SIZE_T sizeBefore = m_sendPacketId.GetAllocatedSize();
+	int &nextPacketId = m_sendPacketId.FindOrAdd(in_ackIdWithoutPacketId);
+	recordSendGrowth(sizeBefore, m_sendPacketId.GetAllocatedSize());
+	int packetId = nextPacketId;
+	nextPacketId = (packetId + 1) & MAX_PACKET_ID;
+
+	// Add packet id to the header, then encode, reliable header then player mask
+	uint64 ackId = in_ackIdWithoutPacketId | ((uint64)packetId << 48);
+	for (int i = 0; i < 8; ++i)
+	{
+		packet[3 + i] = (uint8)(ackId >> (56 - 8 * i));
+	}
+
+	// SEND IT, over udp reliable packets are kept until the server acks them
+	bool reliable = ((ackId >> 48) & RELIABLE_BIT) != 0;
+	if (reliable && m_connectionType == BCRelayConnectionType::UDP)
 	{
-		m_sendPacketId.Add(ackIdWithoutPacketId, packetId);
+		sendReliable(ackId, (int)((ackId >> 60) & 0x3), in_packet);
+		return;
 	}
-	m_sendPacketId[ackIdWithoutPacketId] = (packetId + 1) & MAX_PACKET_ID;
+	sendBytes(packet, totalSize);
+	releasePacket(in_packet);
+}
 
-	// Add packet id to the header, then encode
-	rh |= packetId;
+void BrainCloudRelayComms::enableSendBatching(bool in_enabled, int in_maxBatchSize)
+{
+	FScopeLock Lock(&m_relayMutex);
+	if (!in_enabled)
+		flushSendBatches();
 
-	uint16 rhBE = toBigEndian((uint16)rh);
-	uint16 playerMask0BE = toBigEndian((uint16)((playerMask >> 32) & 0xFFFF));
-	uint16 playerMask1BE = toBigEndian((uint16)((playerMask >> 16) & 0xFFFF));
-	uint16 playerMask2BE = toBigEndian((uint16)((playerMask)       & 0xFFFF));
-	memcpy(toSendData.GetData() + 3, &rhBE, 2);
-	memcpy(toSendData.GetData() + 5, &playerMask0BE, 2);
-	memcpy(toSendData.GetData() + 7, &playerMask1BE, 2);
-	memcpy(toSendData.GetData() + 9, &playerMask2BE, 2);
+	// a batch, with its header, still fits a pooled buffer
+	m_maxBatchSize = in_enabled ? FMath::Clamp(in_maxBatchSize, BATCH_MAGIC_LENGTH + BATCH_LENGTH_PREFIX + 1, (int)MAX_PACKETSIZE) : 0;
+}
 
-	// Rest of data
-	memcpy(toSendData.GetData() + 11, in_data.GetData(), in_data.Num());
+void BrainCloudRelayComms::flushSendBatches()
+{
+	FScopeLock Lock(&m_relayMutex);
+	for (SendBatch &batch : m_sendBatches)
+	{
+		sendBatch(batch);
+	}
+	m_sendBatches.Reset();
+}
 
-	// SEND IT
-	m_connectedSocket->SendData(toSendData);
+bool BrainCloudRelayComms::queueBatched(uint64 in_ackIdWithoutPacketId, const uint8 *in_data, int32 in_size)
+{
+	int32 entrySize = BATCH_LENGTH_PREFIX + in_size;
+	int32 maxPacketSize = RELAY_HEADER_LENGTH + m_maxBatchSize;
+	if (in_size <= 0 || RELAY_HEADER_LENGTH + BATCH_MAGIC_LENGTH + entrySize > maxPacketSize)
+		return false;
+
+	SendBatch *batch = m_sendBatches.FindByPredicate([in_ackIdWithoutPacketId](const SendBatch &other) { return other.AckIdWithoutPacketId == in_ackIdWithoutPacketId; });
+	if (batch != nullptr && batch->Packet.Num() + entrySize > maxPacketSize)
+	{
+		// full, it goes now and a new one is started in its place
+		sendBatch(*batch);
+		batch->Count = 0;
+	}
+	else if (batch == nullptr)
+	{
+		SIZE_T sizeBefore = m_sendBatches.GetAllocatedSize();
+		batch = &m_sendBatches.AddDefaulted_GetRef();
+		recordSendGrowth(sizeBefore, m_sendBatches.GetAllocatedSize());
+		batch->AckIdWithoutPacketId = in_ackIdWithoutPacketId;
+	}
 
-	/*
-	if (in_target != CL2RS_PING && bMessageSent && m_client->isLoggingEnabled())
+	if (batch->Count == 0)
 	{
-		FString parsedMessage = BrainCloudRelay::BCBytesToString(toSendData.GetData(), toSendData.Num());
-		UE_LOG(LogBrainCloudComms, Log, TEXT("toSendData size %d, %d, cb %d, %d %d,%s, %d, %d, %d"), toSendData[0], 
-												toSendData[1], toSendData[2], 
-												toSendData.Num() > 3 ? toSendData[3] : 0, 
-												toSendData.Num() > 4 ? toSendData[4] : 0, *parsedMessage,
-												header.Num(), in_message.Num(), toSendData.Num() );
+		batch->Packet = acquirePacket(RELAY_HEADER_LENGTH + BATCH_MAGIC_LENGTH);
+		FMemory::Memcpy(batch->Packet.GetData() + RELAY_HEADER_LENGTH, BATCH_MAGIC, BATCH_MAGIC_LENGTH);
+	}
+
+	// within the pooled buffer's capacity, so no allocation
+	SIZE_T sizeBefore = batch->Packet.GetAllocatedSize();
+	int32 offset = batch->Packet.AddUninitialized(entrySize);
+	recordSendGrowth(sizeBefore, batch->Packet.GetAllocatedSize());
+	uint8 *entry = batch->Packet.GetData() + offset;
+	entry[0] = (uint8)(in_size >> 8);
+	entry[1] = (uint8)in_size;
+	FMemory::Memcpy(entry + BATCH_LENGTH_PREFIX, in_data, in_size);
+	++batch->Count;
+	return true;
+}
+
+void BrainCloudRelayComms::sendBatch(SendBatch &in_batch)
+{
+	if (in_batch.Count == 0)
+		return;
+
+	// a lone message goes as it is, without the batch framing, unless it
+	// would then be taken for a batch
+	int32 framingSize = BATCH_MAGIC_LENGTH + BATCH_LENGTH_PREFIX;
+	uint8 *payload = in_batch.Packet.GetData() + RELAY_HEADER_LENGTH;
+	int32 messageSize = in_batch.Packet.Num() - RELAY_HEADER_LENGTH - framingSize;
+	if (in_batch.Count == 1 && (messageSize < BATCH_MAGIC_LENGTH || FMemory::Memcmp(payload + framingSize, BATCH_MAGIC, BATCH_MAGIC_LENGTH) != 0))
+	{
+		FMemory::Memmove(payload, payload + framingSize, messageSize);
+		in_batch.Packet.SetNum(in_batch.Packet.Num() - framingSize, false);
+	}
+
+	in_batch.Count = 0;
+	sendRelayPacket(in_batch.Packet, in_batch.AckIdWithoutPacketId);
+}
+
+bool BrainCloudRelayComms::isBatchFramed(const uint8 *in_data, int32 in_size) const
+{
+	if (in_size <= BATCH_MAGIC_LENGTH || FMemory::Memcmp(in_data, BATCH_MAGIC, BATCH_MAGIC_LENGTH) != 0)
+		return false;
+
+	int32 offset = BATCH_MAGIC_LENGTH;
+	while (offset < in_size)
+	{
+		if (in_size - offset < BATCH_LENGTH_PREFIX)
+			return false;
+		int32 entrySize = ((int32)in_data[offset] << 8) | (int32)in_data[offset + 1];
+		offset += BATCH_LENGTH_PREFIX + entrySize;
+		if (entrySize == 0 || offset > in_size)
+			return false;
+	}
+	return true;
+}
+
+void BrainCloudRelayComms::unpackRelay(const uint8 *in_data, int32 in_size)
+{
+	// batches are only looked for once this client batches too, the whole lobby
+	// does so together. Anything not framed exactly as a batch is delivered as it is
+	bool isUnpacking = false;
+	{
+		FScopeLock Lock(&m_relayMutex);
+		isUnpacking = m_maxBatchSize > 0;
+	}
+
+	if (!isUnpacking || !isBatchFramed(in_data, in_size))
+	{
+		deliverRelay(in_data, in_size);
+		return;
+	}
+
+	int32 offset = BATCH_MAGIC_LENGTH;
+	while (offset < in_size)
+	{
+		int32 entrySize = ((int32)in_data[offset] << 8) | (int32)in_data[offset + 1];
+		deliverRelay(in_data + offset + BATCH_LENGTH_PREFIX, entrySize);
+		offset += BATCH_LENGTH_PREFIX + entrySize;
 	}
-	*/
 }
 
 void BrainCloudRelayComms::setPingInterval(float in_interval)
@@ -452,6 +1223,7 @@ const FString &BrainCloudRelayComms::getOwnerProfileId() const
 
 const FString &BrainCloudRelayComms::getProfileIdForNetId(int in_netId) const
 {
+	FScopeLock Lock(&m_relayMutex);
 	if (!m_netIdToProfileId.Contains(in_netId))
 	{
 		static FString empty;
@@ -462,6 +1234,7 @@ const FString &BrainCloudRelayComms::getProfileIdForNetId(int in_netId) const
 
 int BrainCloudRelayComms::getNetIdForProfileId(const FString &in_profileId) const
 {
+	FScopeLock Lock(&m_relayMutex);
 	if (!m_profileIdToNetId.Contains(in_profileId)) return INVALID_NET_ID;
 	return m_profileIdToNetId[in_profileId];
 }
@@ -515,43 +1288,13 @@ void BrainCloudRelayComms::startReceivingRSConnectionAsync()
 	break;
 	case BCRelayConnectionType::UDP:
 	{
-		//connectUDPAsync(host, port);
+		connectUDP(host, port);
 	}
 	break;
 	default: break;
 	}
 }
 
-TArray<uint8> BrainCloudRelayComms::concatenateByteArrays(TArray<uint8> in_bufferA, TArray<uint8> in_bufferB)
-{
-	TArray<uint8> toReturn;
-	for (int i = 0; i < in_bufferA.Num(); ++i)
-	{
-		toReturn.Add(in_bufferA[i]);
-	}
-
-	for (int i = 0; i < in_bufferB.Num(); ++i)
-	{
-		toReturn.Add(in_bufferB[i]);
-	}
-	return toReturn;
-}
-
-TArray<uint8> BrainCloudRelayComms::stripByteArray(TArray<uint8> in_data, int in_numFromLeft)
-{
-	// take off the 
-	TArray<uint8> data;
-	if (in_numFromLeft <= in_data.Num())
-	{
-		for (int i = in_numFromLeft; i < in_data.Num(); ++i)
-		{
-			data.Add(in_data[i]);
-		}
-	}
-
-	return data;
-}
-
 TArray<uint8> BrainCloudRelayComms::buildConnectionRequest()
 {
 	// create data
@@ -576,27 +1319,119 @@ TArray<uint8> BrainCloudRelayComms::buildConnectionRequest()
 
 void BrainCloudRelayComms::sendPing()
 {
-	m_sentPing = FPlatformTime::Seconds();
 	int32 longPing = ping();
 	int16 localPing = longPing >= 32767 ? 32767 : longPing;
 
+	{
+		// the last one was never answered
+		FScopeLock Lock(&m_relayMutex);
+		m_sentPing = FPlatformTime::Seconds();
+		if (m_isPingPending)
+			++m_windowPingsLost;
+		++m_windowPingsSent;
+		m_isPingPending = true;
+	}
+
 	// attach the local ping
-	TArray<uint8> dataArr = fromShortBE(localPing);
-	send(dataArr, CL2RS_PING);
+	uint8 dataArr[2] = { (uint8)(localPing >> 8), (uint8)localPing };
+	send(dataArr, 2, CL2RS_PING);
+}
+
+void BrainCloudRelayComms::onPong(const uint8 *in_data, int32 in_size)
+{
+	FScopeLock Lock(&m_relayMutex);
+	if (!m_isPingPending)
+		return;
+	m_isPingPending = false;
+
+	double rttMs = (FPlatformTime::Seconds() - m_sentPing) * 1000.0;
+	addRttSample(rttMs);
+
+	// a pong carrying the server's utc clock, in ms since 1970, gives the
+	// offset ntp style, assuming it was read half way through the round trip
+	if (in_size != 8)
+		return;
+
+	double serverMs = (double)readUInt64BE(in_data);
+	double localMs = (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds();
+	m_clockSamples.Add(TPair<double, double>(rttMs, serverMs - (localMs - rttMs / 2.0)));
+	if (m_clockSamples.Num() > MAX_CLOCK_SAMPLES)
+		m_clockSamples.RemoveAt(0, 1, false);
+
+	// the fastest round trip has the least room for asymmetry
+	const TPair<double, double> *best = &m_clockSamples[0];
+	for (const TPair<double, double> &sample : m_clockSamples)
+	{
+		if (sample.Key < best->Key)
+			best = &sample;
+	}
+	m_stats.ClockOffset = (float)best->Value;
+	m_stats.HasClockOffset = true;
+}
+
+void BrainCloudRelayComms::addRttSample(double in_rttMs)
+{
+	if (!m_hasRttSample)
+	{
+		m_hasRttSample = true;
+		m_stats.SmoothedRtt = (float)in_rttMs;
+		m_stats.RttVariance = (float)(in_rttMs / 2.0);
+		m_stats.Jitter = 0.0f;
+	}
+	else
+	{
+		// as rfc 6298 for the round trip and rfc 3550 for the jitter
+		m_stats.Jitter += (float)((FMath::Abs(in_rttMs - m_lastRttMs) - m_stats.Jitter) / 16.0);
+		m_stats.RttVariance = (float)(0.75 * m_stats.RttVariance + 0.25 * FMath::Abs(m_stats.SmoothedRtt - in_rttMs));
+		m_stats.SmoothedRtt = (float)(0.875 * m_stats.SmoothedRtt + 0.125 * in_rttMs);
+	}
+	m_lastRttMs = in_rttMs;
+}
+
+void BrainCloudRelayComms::updateStats(double in_now)
+{
+	if (m_statsWindowStart <= 0.0)
+	{
+		m_statsWindowStart = in_now;
+		return;
+	}
+
+	double elapsed = in_now - m_statsWindowStart;
+	if (elapsed < 1.0)
+		return;
+
+	m_stats.BytesSentPerSecond = (float)(m_windowBytesSent / elapsed);
+	m_stats.BytesReceivedPerSecond = (float)(m_windowBytesReceived / elapsed);
+	m_stats.PacketsSentPerSecond = (float)(m_windowPacketsSent / elapsed);
+	m_stats.PacketsReceivedPerSecond = (float)(m_windowPacketsReceived / elapsed);
+
+	// smoothed a little, a window holds only a ping or so
+	int32 expected = m_windowPingsSent + m_windowPacketsExpected;
+	if (expected > 0)
+	{
+		float windowLoss = (float)(m_windowPingsLost + m_windowPacketsMissing) / (float)expected;
+		m_stats.LossRate = 0.75f * m_stats.LossRate + 0.25f * FMath::Clamp(windowLoss, 0.0f, 1.0f);
+	}
+
+	m_statsWindowStart = in_now;
+	m_windowPingsSent = 0;
+	m_windowPingsLost = 0;
+	m_windowPacketsExpected = 0;
+	m_windowPacketsMissing = 0;
+	m_windowBytesSent = 0;
+	m_windowBytesReceived = 0;
+	m_windowPacketsSent = 0;
+	m_windowPacketsReceived = 0;
 }
 
-// [dsl] The function says "append", but it prepends...
-TArray<uint8> BrainCloudRelayComms::appendSizeBytes(TArray<uint8> in_message)
+FBC_RelayStats BrainCloudRelayComms::getStats() const
 {
-    // size of in_data is the incoming in_data, plus the two that we're adding
-	int sizeOfMessage = in_message.Num() + SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY;
-	TArray<uint8> lengthPrefix = fromShortBE((int16)sizeOfMessage);
-	TArray<uint8> toSend = concatenateByteArrays(lengthPrefix, in_message);
-	return toSend;
+	FScopeLock Lock(&m_relayMutex);
+	return m_stats;
 }
 
 // should be add registered listeners
-void BrainCloudRelayComms::processRegisteredListeners(const FString &in_service, const FString &in_operation, const FString &in_jsonMessage, const TArray<uint8> &in_data)
+void BrainCloudRelayComms::processRegisteredListeners(const FString &in_service, const FString &in_operation, const FString &in_jsonMessage, const uint8 *in_data, int32 in_size)
 {
 	// process connect callback to app
 	bool connected = isConnected();
@@ -638,26 +1473,34 @@ void BrainCloudRelayComms::processRegisteredListeners(const FString &in_service,
 
 	if (!connected && in_operation == TEXT("connect"))
 	{
+		m_connectRequestTime = FPlatformTime::Seconds();
+		m_lastConnectRequestTime = m_connectRequestTime;
 		send(buildConnectionRequest(), CL2RS_CONNECT);
 	}
 
-	if (in_data.Num() > 0)
+	if (in_size > 0)
 	{	
-		// does this go to one of our registered service listeners?
-		if (m_registeredRelayCallback != nullptr)
-		{
-			m_registeredRelayCallback->relayCallback(in_data);
-		}
-		
-		if (m_registeredRelayBluePrintCallback != nullptr && m_registeredRelayBluePrintCallback->IsValidLowLevel())
-		{
-			m_registeredRelayBluePrintCallback->relayCallback(in_data);
-		}
+		notifyDataCallbacks(in_data, in_size);
+	}
+}
+
+void BrainCloudRelayComms::notifyDataCallbacks(const uint8 *in_data, int32 in_size)
+{
+	// does this go to one of our registered service listeners?
+	if (m_registeredRelayCallback != nullptr)
+	{
+		m_registeredRelayCallback->relayCallback(in_data, in_size);
+	}
+	
+	if (m_registeredRelayBluePrintCallback != nullptr && m_registeredRelayBluePrintCallback->IsValidLowLevel())
+	{
+		m_registeredRelayBluePrintCallback->relayCallback(in_data, in_size);
 	}
 }
 
 void BrainCloudRelayComms::setupWebSocket(const FString &in_url)
 {
+	FScopeLock Lock(&m_relayMutex);
 #if PLATFORM_UWP
 #if ENGINE_MINOR_VERSION <24
 #if PLATFORM_HTML5
@@ -700,7 +1543,9 @@ void BrainCloudRelayComms::setupWebSocket(const FString &in_url)
 	m_connectedSocket->OnConnectError.AddDynamic(m_commsPtr, &UBCRelayCommsProxy::WebSocket_OnError);
 	m_connectedSocket->OnClosed.AddDynamic(m_commsPtr, &UBCRelayCommsProxy::WebSocket_OnClose);
 	m_connectedSocket->OnConnectComplete.AddDynamic(m_commsPtr, &UBCRelayCommsProxy::Websocket_OnOpen);
-	m_connectedSocket->OnReceiveData.AddDynamic(m_commsPtr, &UBCRelayCommsProxy::WebSocket_OnMessage);
+	// bytes are read straight from the socket's buffer, without a copy for the delegate
+	m_connectedSocket->OnReceiveBytes.Remove(m_receiveBytesHandle);
+	m_receiveBytesHandle = m_connectedSocket->OnReceiveBytes.AddRaw(this, &BrainCloudRelayComms::webSocket_OnReceiveBytes);
 
 #if PLATFORM_UWP
 #if ENGINE_MINOR_VERSION <24
@@ -716,39 +1561,6 @@ void BrainCloudRelayComms::setupWebSocket(const FString &in_url)
 	m_connectedSocket->Connect(in_url, headersMap);
 }
 
-// [dsl] This does not append anything. It builts an array of 3 bytes [controlByte, 0, 0]
-// None of this makes sense!
-TArray<uint8> BrainCloudRelayComms::appendHeaderData(uint8 in_controlByte)
-{
-	TArray<uint8> header;
-	header.Add(in_controlByte);
-	if (in_controlByte == CL2RS_RELAY)
-    {
-        uint8 data1 = 0;
-        uint8 data2 = 0;
-		/*
-        if (m_connectionType == RelayConnectionType.UDP)
-        {
-            constructReliableHeader(out data1, out data2, in_reliable, in_ordered, in_channel);
-        }
-		*/
-		header.Add(data1);
-		header.Add(data2);
-    }
-
-	return header;
-}
-
-TArray<uint8> BrainCloudRelayComms::fromShortBE(int16 number)
-{
-	// attach the local ping
-	TArray<uint8> dataArr;
-	dataArr.Add(number >> 8);
-	dataArr.Add(number >> 0);
-
-	return dataArr;
-}
-
 void BrainCloudRelayComms::webSocket_OnClose()
 {
 	if (m_client->isLoggingEnabled())
@@ -757,7 +1569,7 @@ void BrainCloudRelayComms::webSocket_OnClose()
 	// lock 
 	{
     	FScopeLock Lock(&m_relayMutex);
-    	m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR,"Could not connect at this time"), TArray<uint8>()));
+    	m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR,"Could not connect at this time"), TArray<uint8>()));
    	}
 }
 
@@ -769,15 +1581,26 @@ void BrainCloudRelayComms::websocket_OnOpen()
 	// lock 
 	{
     	FScopeLock Lock(&m_relayMutex);
-		m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "connect", "", TArray<uint8>()));
+		m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "connect", "", TArray<uint8>()));
 	}
 }
 
 void BrainCloudRelayComms::webSocket_OnMessage(TArray<uint8> in_data)
+{
+	webSocket_OnReceiveBytes(in_data.GetData(), in_data.Num());
+}
+
+void BrainCloudRelayComms::webSocket_OnReceiveBytes(const uint8 *in_data, int32 in_size)
 {
 	// take off the length prefix
-	TArray<uint8> data = stripByteArray(in_data, SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY);
-	onRecv(data);
+	if (in_size < SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY)
+		return;
+	{
+		FScopeLock Lock(&m_relayMutex);
+		m_windowBytesReceived += in_size;
+		++m_windowPacketsReceived;
+	}
+	onRecv(in_data + SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY, in_size - SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY);
 }
 
 void BrainCloudRelayComms::webSocket_OnError(const FString &in_message)
@@ -787,17 +1610,17 @@ void BrainCloudRelayComms::webSocket_OnError(const FString &in_message)
 	// lock 
 	{
     	FScopeLock Lock(&m_relayMutex);
-		m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, in_message), TArray<uint8>()));
+		m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "disconnect", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, in_message), TArray<uint8>()));
 	}	
 }
 
-void BrainCloudRelayComms::onRecv(TArray<uint8> in_data)
+void BrainCloudRelayComms::onRecv(const uint8 *in_data, int32 in_size)
 {
-	// the length prefix should be removed already [dsl] TODO, keep it all here. Too many array manipulation
-	if (in_data.Num() < 1)
+	// the length prefix should be removed already
+	if (in_size < 1)
 	{
     	FScopeLock Lock(&m_relayMutex);
-    	m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, "Relay: Packet should be at least 3 bytes"), TArray<uint8>()));
+    	m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, "Relay: Packet should be at least 3 bytes"), TArray<uint8>()));
 		return;
 	}
 
@@ -805,11 +1628,12 @@ void BrainCloudRelayComms::onRecv(TArray<uint8> in_data)
 	if (controlByte == RS2CL_DISCONNECT)
 	{
     	FScopeLock Lock(&m_relayMutex);
-    	m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, "Relay: Disconnected by server"), TArray<uint8>()));
+    	m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "error", UBrainCloudWrapper::buildErrorJson(403, ReasonCodes::RS_CLIENT_ERROR, "Relay: Disconnected by server"), TArray<uint8>()));
 	}
 	else if (controlByte == RS2CL_PONG)
 	{
 		m_ping = (FPlatformTime::Seconds() - m_sentPing) * 1000;
+		onPong(in_data + 1, in_size - 1);
 		if (m_client->isLoggingEnabled())
 			UE_LOG(LogBrainCloudComms, Log, TEXT("Relay OnRecv Ping: %d"), ping());
 	}
@@ -819,17 +1643,48 @@ void BrainCloudRelayComms::onRecv(TArray<uint8> in_data)
 
 		if (controlByte == RS2CL_RSMG) headerLength += 2;
 		else if (controlByte == RS2CL_RELAY) headerLength += 8;
+
+		if (m_connectionType == BCRelayConnectionType::UDP)
+		{
+			if (controlByte == RS2CL_RSMG && in_size >= 3)
+			{
+				// acked every time, the earlier ack may have been lost
+				int rsmgPacketId = ((int)in_data[1] << 8) | (int)in_data[2];
+				sendRSMGAck(rsmgPacketId);
+
+				FScopeLock Lock(&m_relayMutex);
+				if (m_rsmgHistory.Contains(rsmgPacketId))
+					return;
+				m_rsmgHistory.Add(rsmgPacketId);
+				if (m_rsmgHistory.Num() > MAX_RSMG_HISTORY)
+					m_rsmgHistory.RemoveAt(0);
+			}
+			else if (controlByte == RS2CL_RELAY && in_size >= 9)
+			{
+				receiveRelay(in_data, in_size);
+				return;
+			}
+			else if (controlByte == RS2CL_ACK && in_size >= 9)
+			{
+				onAck(readUInt64BE(in_data + 1));
+				return;
+			}
+		}
 			
-		TArray<uint8> data = stripByteArray(in_data, headerLength);
+		// the rest is read in place
+		if (in_size < headerLength)
+			return;
+		const uint8 *data = in_data + headerLength;
+		int32 dataSize = in_size - headerLength;
 
 		//if (m_client->isLoggingEnabled())
-		//	UE_LOG(LogBrainCloudComms, Log, TEXT("Relay OnRecv: %s"), *BrainCloudRelay::BCBytesToString(data.GetData(), data.Num()));
+		//	UE_LOG(LogBrainCloudComms, Log, TEXT("Relay OnRecv: %s"), *BrainCloudRelay::BCBytesToString(data, dataSize));
 
 		// if netId is not setup yet
 		// [dsl] TODO don't do this here... queue a "rsmg" event instead and deal with it in the update loop
 		if (controlByte == RS2CL_RSMG)
 		{
-			FString parsedMessage = BrainCloudRelay::BCBytesToString(data.GetData(), data.Num());
+			FString parsedMessage = BrainCloudRelay::BCBytesToString(data, dataSize);
 			
 			TSharedRef<TJsonReader<TCHAR>> reader = TJsonReaderFactory<TCHAR>::Create(parsedMessage);
 			TSharedPtr<FJsonObject> jsonPacket = MakeShareable(new FJsonObject());
@@ -839,8 +1694,11 @@ void BrainCloudRelayComms::onRecv(TArray<uint8> in_data)
 			{
 				int netId = (int)jsonPacket->GetNumberField("netId");
 				FString profileId = jsonPacket->GetStringField("profileId");
-				if (!m_netIdToProfileId.Contains(netId)) m_netIdToProfileId.Add(netId, profileId);
-				if (!m_profileIdToNetId.Contains(profileId)) m_profileIdToNetId.Add(profileId, netId);
+				{
+					FScopeLock Lock(&m_relayMutex);
+					if (!m_netIdToProfileId.Contains(netId)) m_netIdToProfileId.Add(netId, profileId);
+					if (!m_profileIdToNetId.Contains(profileId)) m_profileIdToNetId.Add(profileId, netId);
+				}
 				if (m_client->getProfileId() == profileId)
 				{
 					m_netId = (short)netId;
@@ -849,16 +1707,15 @@ void BrainCloudRelayComms::onRecv(TArray<uint8> in_data)
 					// lock 
 					{
 						FScopeLock Lock(&m_relayMutex);
-						m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "connect", parsedMessage, data));
+						m_relayResponse.Add(RelayMessage(FString(ServiceName::Relay.getValue()).ToLower(), "connect", parsedMessage, TArray<uint8>(data, dataSize)));
 					}
 				}
 			}
 		}
-		// lock 
-		{
-			FScopeLock Lock(&m_relayMutex);
-			// finally pass this onwards, no parsed data
-			m_relayResponse.Add(RelayMessage(ServiceName::Relay.getValue().ToLower(), "onrecv", "", data));
-		}
+		// finally pass this onwards, no parsed data
+		if (controlByte == RS2CL_RELAY)
+			unpackRelay(data, dataSize);
+		else
+			deliverRelay(data, dataSize);
 	}
 }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "IServerCallback.h"
+#include "BCRelayStats.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 #define MAX_PAYLOAD 1024
@@ -33,6 +34,8 @@ class UWebSocketBase;
 class UBCRelayCommsProxy;
 class UBCBlueprintRelayCallProxyBase;
 class UBCRelayProxy;
+class FSocket;
+class FInternetAddr;
 struct RelayMessage;
 
 class BrainCloudRelayComms
@@ -62,6 +65,9 @@ public:
 
 	static const uint64 TO_ALL_PLAYERS = 0x000000FFFFFFFFFF;
 
+	static const int MAX_RSMG_HISTORY = 50;
+	static const int MAX_CHANNELS = 4;
+
 	BrainCloudRelayComms(BrainCloudClient *client);
 	~BrainCloudRelayComms();
 
@@ -80,9 +86,26 @@ public:
 	void deregisterDataCallback();
 
 	void sendRelay(const TArray<uint8> &in_data, const uint64 in_playerMask, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
+	void sendRelay(const uint8 *in_data, int32 in_size, const uint64 in_playerMask, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
 	void setPingInterval(float in_interval);
+	void setChannelLimits(int in_channel, int in_sendWindow, int in_receiveBuffer);
+
+	// small messages to the same players and channel are packed together until flushed,
+	// and received batches are unpacked. See BrainCloudRelay::enableSendBatching for the default size
+	void enableSendBatching(bool in_enabled, int in_maxBatchSize);
+	void flushSendBatches();
+
+	// allocations made sending, the packet buffers and the growth of the containers they go
+	// through. Both are pooled or kept, so this stops growing once warmed up. UDP only, the
+	// websocket's send queue (UWebSocketBase::SendData) grows outside of these counts
+	int64 getSendAllocationCount() const;
+	int64 getSendAllocatedBytes() const;
+
+	FBC_RelayStats getStats() const;
 
 	void RunCallbacks();
+	void ServiceSockets();
+	void SetThreaded(bool in_isThreaded) { m_isThreaded = in_isThreaded; }
 
 // expose web socket functions
 #if PLATFORM_UWP
@@ -97,24 +120,58 @@ public:
 	void webSocket_OnClose();
 	void websocket_OnOpen();
 	void webSocket_OnMessage(TArray<uint8> in_data);
+	void webSocket_OnReceiveBytes(const uint8 *in_data, int32 in_size);
 	void webSocket_OnError(const FString &in_error);
 
 private:
+	// messages waiting to go out together, in a pooled packet with room left for the header
+	struct SendBatch
+	{
+		uint64 AckIdWithoutPacketId = 0;
+		TArray<uint8> Packet;
+		int32 Count = 0;
+	};
+
 	void send(const TArray<uint8> &in_data, const uint8 in_controlByte);
+	void send(const uint8 *in_data, int32 in_size, const uint8 in_controlByte);
 	void connectHelper(BCRelayConnectionType in_connectionType, const FString &in_connectOptionsJson);
 	void startReceivingRSConnectionAsync();
-	TArray<uint8> concatenateByteArrays(TArray<uint8> in_bufferA, TArray<uint8> in_bufferB);
-	TArray<uint8> stripByteArray(TArray<uint8> in_data, int in_numFromLeft);
-	TArray<uint8> appendSizeBytes(TArray<uint8> in_message);
 	TArray<uint8> buildConnectionRequest();
-	void processRegisteredListeners(const FString &in_service, const FString &in_operation, const FString &in_jsonMessage, const TArray<uint8> &in_data);
+	void processRegisteredListeners(const FString &in_service, const FString &in_operation, const FString &in_jsonMessage, const uint8 *in_data, int32 in_size);
+	void notifyDataCallbacks(const uint8 *in_data, int32 in_size);
 	void connectWebSocket(FString in_host, int in_port, bool in_sslEnabled);
+	void connectUDP(const FString &in_host, int in_port);
+	void serviceUDP();
+	void updateUDPConnection();
+	void sendBytes(const uint8 *in_data, int32 in_size);
+	TArray<uint8> acquirePacket(int32 in_size);
+	void releasePacket(TArray<uint8> &in_packet);
+	void recordSendGrowth(SIZE_T in_sizeBefore, SIZE_T in_sizeAfter);
+	void sendRelayPacket(TArray<uint8> &in_packet, uint64 in_ackIdWithoutPacketId);
+	bool queueBatched(uint64 in_ackIdWithoutPacketId, const uint8 *in_data, int32 in_size);
+	void sendBatch(SendBatch &in_batch);
+	bool isBatchFramed(const uint8 *in_data, int32 in_size) const;
+	void unpackRelay(const uint8 *in_data, int32 in_size);
+	bool isSocketOpen();
+	void sendAck(const uint8 *in_ackId);
+	void sendRSMGAck(int in_rsmgPacketId);
+	void queueDisconnect(const FString &in_message);
+
+	// reliability over udp
+	void sendReliable(uint64 in_ackId, int in_channel, TArray<uint8> &in_datagram);
+	void onAck(uint64 in_ackId);
+	void resendReliables(double in_now);
+	double getRetransmitTimeout() const;
+	void receiveRelay(const uint8 *in_data, int32 in_size);
+	void deliverRelay(const uint8 *in_data, int32 in_size);
+	void releaseReceived(int32 in_upTo, int32 in_lap);
 	void disconnectImpl();
-	void onRecv(TArray<uint8> data);
+	void onRecv(const uint8 *in_data, int32 in_size);
 	void setupWebSocket(const FString &in_url);
 	void sendPing();
-	TArray<uint8> appendHeaderData(uint8 in_controlByte);
-	TArray<uint8> fromShortBE(int16 number);
+	void onPong(const uint8 *in_data, int32 in_size);
+	void addRttSample(double in_rttMs);
+	void updateStats(double in_now);
 
 	BrainCloudClient *m_client;
 	IServerCallback *m_appCallback;
@@ -126,6 +183,89 @@ private:
 	UBCBlueprintRelayCallProxyBase *m_registeredRelayBluePrintCallback;
 
 	UWebSocketBase *m_connectedSocket;
+	FDelegateHandle m_receiveBytesHandle;
+
+	// udp transport, serviced along with the websocket
+	FSocket *m_udpSocket;
+	TSharedPtr<FInternetAddr> m_udpServerAddr;
+	TArray<uint8> m_udpRecvBuffer;
+	double m_lastRecvTime;
+	// connect requests are resent until the server answers
+	double m_connectRequestTime;
+	double m_lastConnectRequestTime;
+	// rsmg packet ids already handled, the server resends them until acked
+	TArray<int> m_rsmgHistory;
+
+	struct ChannelLimits
+	{
+		// reliable packets in flight before the next ones have to wait
+		int32 SendWindow = 64;
+		// out of order packets held per sender before they are left unacked
+		int32 ReceiveBuffer = 64;
+	};
+
+	struct ReliablePacket
+	{
+		uint64 AckId = 0;
+		TArray<uint8> Datagram;
+		double FirstSendTime = 0.0;
+		double LastSendTime = 0.0;
+		int32 Resends = 0;
+	};
+
+	struct ReceivedPacket
+	{
+		int32 PacketId = 0;
+		TArray<uint8> Data;
+	};
+
+	// one per sender, channel and delivery mode
+	struct ReceiveStream
+	{
+		// last ordered packet delivered, a sender's ids carry on from before we joined
+		int32 LastPacketId = MAX_PACKET_ID;
+		bool HasLastPacketId = false;
+		// ordered packets waiting on an earlier one
+		TArray<ReceivedPacket> Buffered;
+		// unordered reliable packets already delivered
+		TArray<int32> RecentIds;
+		// newest packet id seen, for counting the ones that went missing
+		int32 HighestPacketId = MAX_PACKET_ID;
+		bool HasHighestPacketId = false;
+	};
+
+	// all guarded by m_relayMutex, only used over udp
+	ChannelLimits m_channelLimits[MAX_CHANNELS];
+	TArray<ReliablePacket> m_unacked[MAX_CHANNELS];
+	// sent once the window has room, in order
+	TArray<ReliablePacket> m_backlog[MAX_CHANNELS];
+	TMap<uint64, ReceiveStream> m_receiveStreams;
+	// round trip of reliable packets, from their acks
+	double m_smoothedRtt;
+	double m_rttVariance;
+
+	// connection quality, all guarded by m_relayMutex. Counts are kept over
+	// a window of about a second, the rest is smoothed from sample to sample.
+	FBC_RelayStats m_stats;
+	bool m_hasRttSample;
+	double m_lastRttMs;
+	bool m_isPingPending;
+	double m_statsWindowStart;
+	int32 m_windowPingsSent;
+	int32 m_windowPingsLost;
+	int32 m_windowPacketsExpected;
+	int32 m_windowPacketsMissing;
+	int64 m_windowBytesSent;
+	int64 m_windowBytesReceived;
+	int32 m_windowPacketsSent;
+	int32 m_windowPacketsReceived;
+	// recent round trips with the clock offset measured on each, in milliseconds
+	TArray<TPair<double, double>> m_clockSamples;
+
+	// packet buffers reused from send to send, guarded by m_relayMutex
+	TArray<TArray<uint8>> m_packetPool;
+	int64 m_sendAllocationCount;
+	int64 m_sendAllocatedBytes;
 
 	bool m_bIsConnected;
 	float m_pingInterval;
@@ -141,7 +281,27 @@ private:
 
 	struct lws_context *m_lwsContext;
 	TArray<RelayMessage> m_relayResponse;
-	FCriticalSection m_relayMutex;
+	// the responses being handed to the callbacks, swapped with m_relayResponse
+	TArray<RelayMessage> m_processingResponse;
+
+	// received data is copied once, into this ring, and read by the data
+	// callbacks where it sits. [tail, head) is in use, wrapped round the
+	// end when m_receiveRingWrapped. Allocated once, never moved.
+	TArray<uint8> m_receiveRing;
+	int32 m_receiveRingHead;
+	int32 m_receiveRingTail;
+	bool m_receiveRingWrapped;
+	// counts the wraps, so a release knows which side of the wrap it is on
+	int32 m_receiveRingLap;
+
+	// guarded by m_relayMutex, sent at the end of RunCallbacks
+	TArray<SendBatch> m_sendBatches;
+	// payload bytes a batch may fill, 0 when batching is off. Received packets are
+	// only unpacked while it is on, guarded by m_relayMutex
+	int32 m_maxBatchSize;
+	// guards the socket, the queued responses and the net id maps
+	mutable FCriticalSection m_relayMutex;
+	bool m_isThreaded = false;
 	
 	const int SIZE_OF_LENGTH_PREFIX_BYTE_ARRAY = 2;
     const int CONTROL_BYTE_HEADER_LENGTH = 1;
@@ -165,4 +325,7 @@ struct RelayMessage
 	FString Operation;
 	FString JsonMessage;
 	TArray<uint8> Data;
+	// received relay data in the receive ring, in place of Data
+	int32 RingOffset = INDEX_NONE;
+	int32 RingSize = 0;
 };
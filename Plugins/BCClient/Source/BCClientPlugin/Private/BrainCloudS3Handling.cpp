@@ -15,9 +15,9 @@ void BrainCloudS3Handling::getUpdatedFiles(const FString &category, const FStrin
 
 	if (OperationParam::isOptionalParamValid(category))
 	{
-		message->SetStringField(OperationParam::S3HandlingServiceCategory.getValue(), category);
+		message->SetStringField(OperationParam::S3HandlingServiceCategory.getKey(), category);
 	}
-	message->SetObjectField(OperationParam::PlayerStateServiceReadEntitySubtype.getValue(), JsonUtil::jsonStringToValue(fileDetails));
+	message->SetObjectField(OperationParam::PlayerStateServiceReadEntitySubtype.getKey(), JsonUtil::jsonStringToValue(fileDetails));
 
 	ServerCall *sc = new ServerCall(ServiceName::S3Handling, ServiceOperation::GetUpdatedFiles, message, callback);
 	_client->sendRequest(sc);
@@ -29,7 +29,7 @@ void BrainCloudS3Handling::getFileList(const FString &category, IServerCallback
 
 	if (OperationParam::isOptionalParamValid(category))
 	{
-		message->SetStringField(OperationParam::S3HandlingServiceCategory.getValue(), category);
+		message->SetStringField(OperationParam::S3HandlingServiceCategory.getKey(), category);
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::S3Handling, ServiceOperation::GetFileList, message, callback);
@@ -39,7 +39,7 @@ void BrainCloudS3Handling::getFileList(const FString &category, IServerCallback
 void BrainCloudS3Handling::getCDNUrl(const FString &fileId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::S3HandlingServiceFileId.getValue(), fileId);
+	message->SetStringField(OperationParam::S3HandlingServiceFileId.getKey(), fileId);
 
 	ServerCall *sc = new ServerCall(ServiceName::S3Handling, ServiceOperation::GetCdnUrl, message, callback);
 	_client->sendRequest(sc);
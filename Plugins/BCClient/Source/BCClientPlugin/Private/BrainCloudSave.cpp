@@ -7,4 +7,7 @@ UBrainCloudSave::UBrainCloudSave()
 {
     SaveSlotName = TEXT("BrainCloudSave");
     UserIndex = 0;
+    SessionExpirySeconds = 0;
+    MaxBundleMsgs = 0;
+    MaxKillCount = 0;
 }
\ No newline at end of file
@@ -29,5 +29,20 @@ class BCCLIENTPLUGIN_API UBrainCloudSave : public USaveGame
     UPROPERTY(VisibleAnywhere, Category = Basic)
     uint32 UserIndex;
 
+    UPROPERTY(VisibleAnywhere, Category = Session)
+    FString SessionId;
+
+    UPROPERTY(VisibleAnywhere, Category = Session)
+    FDateTime SessionExpiresAt;
+
+    UPROPERTY(VisibleAnywhere, Category = Session)
+    int32 SessionExpirySeconds;
+
+    UPROPERTY(VisibleAnywhere, Category = Session)
+    int32 MaxBundleMsgs;
+
+    UPROPERTY(VisibleAnywhere, Category = Session)
+    int32 MaxKillCount;
+
     UBrainCloudSave();
 };
\ No newline at end of file
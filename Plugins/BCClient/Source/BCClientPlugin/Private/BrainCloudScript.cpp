@@ -12,10 +12,10 @@ BrainCloudScript::BrainCloudScript(BrainCloudClient *client) : _client(client){}
 void BrainCloudScript::runScript(const FString &scriptName, const FString &jsonScriptData, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getValue(), scriptName);
+    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getKey(), scriptName);
     if (OperationParam::isOptionalParamValid(jsonScriptData))
     {
-        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getValue(), JsonUtil::jsonStringToValue(jsonScriptData));
+        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getKey(), JsonUtil::jsonStringToValue(jsonScriptData));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::Run, message, callback);
@@ -25,12 +25,12 @@ void BrainCloudScript::runScript(const FString &scriptName, const FString &jsonS
 void BrainCloudScript::scheduleRunScriptMillisUTC(const FString &scriptName, const FString &jsonScriptData, int64 startDateInUTC, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getValue(), scriptName);
+    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getKey(), scriptName);
     if (OperationParam::isOptionalParamValid(jsonScriptData))
     {
-        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getValue(), JsonUtil::jsonStringToValue(jsonScriptData));
+        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getKey(), JsonUtil::jsonStringToValue(jsonScriptData));
     }
-    message->SetNumberField(OperationParam::ScriptServiceStartDateUTC.getValue(), startDateInUTC);
+    message->SetNumberField(OperationParam::ScriptServiceStartDateUTC.getKey(), startDateInUTC);
 
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::ScheduleCloudScript, message, callback);
     _client->sendRequest(sc);
@@ -39,12 +39,12 @@ void BrainCloudScript::scheduleRunScriptMillisUTC(const FString &scriptName, con
 void BrainCloudScript::scheduleRunScriptMinutes(const FString &scriptName, const FString &jsonScriptData, int32 minutesFromNow, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getValue(), scriptName);
+    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getKey(), scriptName);
     if (OperationParam::isOptionalParamValid(jsonScriptData))
     {
-        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getValue(), JsonUtil::jsonStringToValue(jsonScriptData));
+        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getKey(), JsonUtil::jsonStringToValue(jsonScriptData));
     }
-    message->SetNumberField(OperationParam::ScriptServiceStartMinutesFromNow.getValue(), minutesFromNow);
+    message->SetNumberField(OperationParam::ScriptServiceStartMinutesFromNow.getKey(), minutesFromNow);
 
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::ScheduleCloudScript, message, callback);
     _client->sendRequest(sc);
@@ -54,13 +54,13 @@ void BrainCloudScript::runParentScript(const FString &scriptName, const FString
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
 
-    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getValue(), scriptName);
+    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getKey(), scriptName);
     if (OperationParam::isOptionalParamValid(jsonScriptData))
     {
-        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getValue(), JsonUtil::jsonStringToValue(jsonScriptData));
+        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getKey(), JsonUtil::jsonStringToValue(jsonScriptData));
     }
 
-    message->SetStringField(OperationParam::ScriptServiceParentLevelName.getValue(), parentLevel);
+    message->SetStringField(OperationParam::ScriptServiceParentLevelName.getKey(), parentLevel);
 
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::RunParentScript, message, callback);
     _client->sendRequest(sc);
@@ -69,7 +69,7 @@ void BrainCloudScript::runParentScript(const FString &scriptName, const FString
 void BrainCloudScript::cancelScheduledScript(const FString &jobId, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ScriptServiceJobId.getValue(), jobId);
+    message->SetStringField(OperationParam::ScriptServiceJobId.getKey(), jobId);
 
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::CancelScheduledScript, message, callback);
     _client->sendRequest(sc);
@@ -78,11 +78,11 @@ void BrainCloudScript::cancelScheduledScript(const FString &jobId, IServerCallba
 void BrainCloudScript::runPeerScript(const FString &scriptName, const FString &jsonScriptData, const FString &peer, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getValue(), scriptName);
-    message->SetStringField(OperationParam::Peer.getValue(), peer);
+    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getKey(), scriptName);
+    message->SetStringField(OperationParam::Peer.getKey(), peer);
     if (OperationParam::isOptionalParamValid(jsonScriptData))
     {
-        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getValue(), JsonUtil::jsonStringToValue(jsonScriptData));
+        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getKey(), JsonUtil::jsonStringToValue(jsonScriptData));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::RunPeerScript, message, callback);
@@ -92,11 +92,11 @@ void BrainCloudScript::runPeerScript(const FString &scriptName, const FString &j
 void BrainCloudScript::runPeerScriptAsync(const FString &scriptName, const FString &jsonScriptData, const FString &peer, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getValue(), scriptName);
-    message->SetStringField(OperationParam::Peer.getValue(), peer);
+    message->SetStringField(OperationParam::ScriptServiceRunScriptName.getKey(), scriptName);
+    message->SetStringField(OperationParam::Peer.getKey(), peer);
     if (OperationParam::isOptionalParamValid(jsonScriptData))
     {
-        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getValue(), JsonUtil::jsonStringToValue(jsonScriptData));
+        message->SetObjectField(OperationParam::ScriptServiceRunScriptData.getKey(), JsonUtil::jsonStringToValue(jsonScriptData));
     }
 
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::RunPeerScriptAsync, message, callback);
@@ -113,7 +113,7 @@ void BrainCloudScript::getRunningOrQueuedCloudScripts(IServerCallback *callback)
 void BrainCloudScript::getScheduledCloudScripts(const struct FDateTime startDateInUTC, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetNumberField(OperationParam::ScriptServiceStartDateUTC.getValue(), startDateInUTC.ToUnixTimestamp() * 1000);
+    message->SetNumberField(OperationParam::ScriptServiceStartDateUTC.getKey(), startDateInUTC.ToUnixTimestamp() * 1000);
     ServerCall *sc = new ServerCall(ServiceName::Script, ServiceOperation::GetScheduledCloudSripts, message, callback);
     _client->sendRequest(sc);
 }
@@ -12,8 +12,8 @@ BrainCloudTournament::BrainCloudTournament(BrainCloudClient *client) : _client(c
 void BrainCloudTournament::claimTournamentReward(const FString &leaderboardId, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::VersionId.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::VersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::ClaimTournamentReward, message, callback);
 	_client->sendRequest(sc);
@@ -22,8 +22,8 @@ void BrainCloudTournament::claimTournamentReward(const FString &leaderboardId, i
 void BrainCloudTournament::getTournamentStatus(const FString &leaderboardId, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::VersionId.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::VersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::GetTournamentStatus, message, callback);
 	_client->sendRequest(sc);
@@ -32,7 +32,7 @@ void BrainCloudTournament::getTournamentStatus(const FString &leaderboardId, int
 void BrainCloudTournament::getDivisionInfo(const FString &divSetId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::DivSetId.getValue(), divSetId);
+	message->SetStringField(OperationParam::DivSetId.getKey(), divSetId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::GetDivisionInfo, message, callback);
 	_client->sendRequest(sc);
@@ -49,9 +49,9 @@ void BrainCloudTournament::getMyDivisions(IServerCallback *callback)
 void BrainCloudTournament::joinTournament(const FString &leaderboardId, const FString &tournamentCode, int32 initialScore, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetStringField(OperationParam::TournamentCode.getValue(), tournamentCode);
-	message->SetNumberField(OperationParam::InitialScore.getValue(), initialScore);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetStringField(OperationParam::TournamentCode.getKey(), tournamentCode);
+	message->SetNumberField(OperationParam::InitialScore.getKey(), initialScore);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::JoinTournament, message, callback);
 	_client->sendRequest(sc);
@@ -60,9 +60,9 @@ void BrainCloudTournament::joinTournament(const FString &leaderboardId, const FS
 void BrainCloudTournament::joinDivision(const FString &divSetId, const FString &tournamentCode, int32 initialScore, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::DivSetId.getValue(), divSetId);
-	message->SetStringField(OperationParam::TournamentCode.getValue(), tournamentCode);
-	message->SetNumberField(OperationParam::InitialScore.getValue(), initialScore);
+	message->SetStringField(OperationParam::DivSetId.getKey(), divSetId);
+	message->SetStringField(OperationParam::TournamentCode.getKey(), tournamentCode);
+	message->SetNumberField(OperationParam::InitialScore.getKey(), initialScore);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::JoinDivision, message, callback);
 	_client->sendRequest(sc);
@@ -71,7 +71,7 @@ void BrainCloudTournament::joinDivision(const FString &divSetId, const FString &
 void BrainCloudTournament::leaveTournament(const FString &leaderboardId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::LeaveTournament, message, callback);
 	_client->sendRequest(sc);
@@ -80,13 +80,13 @@ void BrainCloudTournament::leaveTournament(const FString &leaderboardId, IServer
 void BrainCloudTournament::postTournamentScore(const FString &leaderboardId, int32 score, const FString &jsonData, const FDateTime roundStartedTime, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::Score.getValue(), score);
-	message->SetNumberField(OperationParam::RoundStartedEpoch.getValue(), roundStartedTime.ToUnixTimestamp() * 1000);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::Score.getKey(), score);
+	message->SetNumberField(OperationParam::RoundStartedEpoch.getKey(), roundStartedTime.ToUnixTimestamp() * 1000);
 
 	if (OperationParam::isOptionalParamValid(jsonData))
 	{
-		message->SetObjectField(OperationParam::Data.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::Data.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::PostTournamentScore, message, callback);
@@ -96,17 +96,17 @@ void BrainCloudTournament::postTournamentScore(const FString &leaderboardId, int
 void BrainCloudTournament::postTournamentScoreWithResults(const FString &leaderboardId, int32 score, const FString &jsonData, const FDateTime roundStartedTime, ESortOrder sort, int32 beforeCount, int32 afterCount, float initialScore, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::Score.getValue(), score);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::Score.getKey(), score);
 	if (OperationParam::isOptionalParamValid(jsonData))
 	{
-		message->SetObjectField(OperationParam::Data.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::Data.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	}
-	message->SetNumberField(OperationParam::RoundStartedEpoch.getValue(), roundStartedTime.ToUnixTimestamp() * 1000);
-	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getValue(), tournamentSortOrderToString(sort));
-	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getValue(), beforeCount);
-	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getValue(), afterCount);
-	message->SetNumberField(OperationParam::InitialScore.getValue(), initialScore);
+	message->SetNumberField(OperationParam::RoundStartedEpoch.getKey(), roundStartedTime.ToUnixTimestamp() * 1000);
+	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getKey(), tournamentSortOrderToString(sort));
+	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getKey(), beforeCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getKey(), afterCount);
+	message->SetNumberField(OperationParam::InitialScore.getKey(), initialScore);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::PostTournamentScoreWithResults, message, callback);
 	_client->sendRequest(sc);
@@ -115,7 +115,7 @@ void BrainCloudTournament::postTournamentScoreWithResults(const FString &leaderb
 void BrainCloudTournament::leaveDivisionInstance(const FString &leaderboardId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::LeaveDivisionInstance, message, callback);
 	_client->sendRequest(sc);
@@ -124,13 +124,13 @@ void BrainCloudTournament::leaveDivisionInstance(const FString &leaderboardId, I
 void BrainCloudTournament::postTournamentScoreUTC(const FString &leaderboardId, int32 score, const FString &jsonData, int64 roundStartTimeUTC, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::Score.getValue(), score);
-	message->SetNumberField(OperationParam::RoundStartedEpoch.getValue(), roundStartTimeUTC);//.ToUnixTimestamp() * 1000);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::Score.getKey(), score);
+	message->SetNumberField(OperationParam::RoundStartedEpoch.getKey(), roundStartTimeUTC);//.ToUnixTimestamp() * 1000);
 
 	if (OperationParam::isOptionalParamValid(jsonData))
 	{
-		message->SetObjectField(OperationParam::Data.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::Data.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	}
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::PostTournamentScore, message, callback);
@@ -140,17 +140,17 @@ void BrainCloudTournament::postTournamentScoreUTC(const FString &leaderboardId,
 void BrainCloudTournament::postTournamentScoreWithResultsUTC(const FString &leaderboardId, int32 score, const FString &jsonData, int64 roundStartTimeUTC, ESortOrder sort, int32 beforeCount, int32 afterCount, float initialScore, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::Score.getValue(), score);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::Score.getKey(), score);
 	if (OperationParam::isOptionalParamValid(jsonData))
 	{
-		message->SetObjectField(OperationParam::Data.getValue(), JsonUtil::jsonStringToValue(jsonData));
+		message->SetObjectField(OperationParam::Data.getKey(), JsonUtil::jsonStringToValue(jsonData));
 	}
-	message->SetNumberField(OperationParam::RoundStartedEpoch.getValue(), roundStartTimeUTC);//.ToUnixTimestamp() * 1000);
-	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getValue(), tournamentSortOrderToString(sort));
-	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getValue(), beforeCount);
-	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getValue(), afterCount);
-	message->SetNumberField(OperationParam::InitialScore.getValue(), initialScore);
+	message->SetNumberField(OperationParam::RoundStartedEpoch.getKey(), roundStartTimeUTC);//.ToUnixTimestamp() * 1000);
+	message->SetStringField(OperationParam::LeaderboardServiceSortOrder.getKey(), tournamentSortOrderToString(sort));
+	message->SetNumberField(OperationParam::LeaderboardServiceBeforeCount.getKey(), beforeCount);
+	message->SetNumberField(OperationParam::LeaderboardServiceAfterCount.getKey(), afterCount);
+	message->SetNumberField(OperationParam::InitialScore.getKey(), initialScore);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::PostTournamentScoreWithResults, message, callback);
 	_client->sendRequest(sc);
@@ -159,7 +159,7 @@ void BrainCloudTournament::postTournamentScoreWithResultsUTC(const FString &lead
 void BrainCloudTournament::viewCurrentReward(const FString &leaderboardId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::ViewCurrentReward, message, callback);
 	_client->sendRequest(sc);
@@ -168,8 +168,8 @@ void BrainCloudTournament::viewCurrentReward(const FString &leaderboardId, IServ
 void BrainCloudTournament::viewReward(const FString &leaderboardId, int32 versionId, IServerCallback *callback)
 {
 	TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-	message->SetStringField(OperationParam::LeaderboardId.getValue(), leaderboardId);
-	message->SetNumberField(OperationParam::VersionId.getValue(), versionId);
+	message->SetStringField(OperationParam::LeaderboardId.getKey(), leaderboardId);
+	message->SetNumberField(OperationParam::VersionId.getKey(), versionId);
 
 	ServerCall *sc = new ServerCall(ServiceName::Tournament, ServiceOperation::ViewReward, message, callback);
 	_client->sendRequest(sc);
@@ -12,9 +12,9 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
     void BrainCloudUserItems::awardUserItem(const FString &defId, int quantity, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsDefId.getValue(), defId);
-        message->SetNumberField(OperationParam::UserItemsQuantity.getValue(), quantity);
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetStringField(OperationParam::UserItemsDefId.getKey(), defId);
+        message->SetNumberField(OperationParam::UserItemsQuantity.getKey(), quantity);
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::AwardUserItem, message, callback);
         _client->sendRequest(sc);
@@ -23,9 +23,9 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::dropUserItem(const FString &itemId, int quantity, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetNumberField(OperationParam::UserItemsQuantity.getValue(), quantity);
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetNumberField(OperationParam::UserItemsQuantity.getKey(), quantity);
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::DropUserItem, message, callback);
         _client->sendRequest(sc);
@@ -34,8 +34,8 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::getUserItemsPage(const FString &context, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetObjectField(OperationParam::UserItemsContext.getValue(), JsonUtil::jsonStringToValue(context));
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetObjectField(OperationParam::UserItemsContext.getKey(), JsonUtil::jsonStringToValue(context));
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::GetUserItemsPage, message, callback);
         _client->sendRequest(sc);
@@ -44,9 +44,9 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::getUserItemsPageOffset(const FString &context, int pageOffest, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsContext.getValue(), context);
-        message->SetNumberField(OperationParam::UserItemsPageOffset.getValue(), pageOffest);
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetStringField(OperationParam::UserItemsContext.getKey(), context);
+        message->SetNumberField(OperationParam::UserItemsPageOffset.getKey(), pageOffest);
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::GetUserItemsPageOffset, message, callback);
         _client->sendRequest(sc);
@@ -55,8 +55,8 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::getUserItem(const FString &itemId, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::GetUserItem, message, callback);
         _client->sendRequest(sc);
@@ -65,10 +65,10 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::giveUserItemTo(const FString &profileId, const FString &itemId, int version, int quantity, bool immediate, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsProfileId.getValue(), profileId);
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetNumberField(OperationParam::UserItemsVersion.getValue(), version);
-        message->SetBoolField(OperationParam::UserItemsImmediate.getValue(), immediate);
+        message->SetStringField(OperationParam::UserItemsProfileId.getKey(), profileId);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetNumberField(OperationParam::UserItemsVersion.getKey(), version);
+        message->SetBoolField(OperationParam::UserItemsImmediate.getKey(), immediate);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::GiveUserItemTo, message, callback);
         _client->sendRequest(sc);
@@ -77,10 +77,10 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::purchaseUserItem(const FString &defId, int quantity, const FString &shopId, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsDefId.getValue(), defId);
-        message->SetNumberField(OperationParam::UserItemsQuantity.getValue(), quantity);
-        message->SetStringField(OperationParam::UserItemsShopId.getValue(), shopId);
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetStringField(OperationParam::UserItemsDefId.getKey(), defId);
+        message->SetNumberField(OperationParam::UserItemsQuantity.getKey(), quantity);
+        message->SetStringField(OperationParam::UserItemsShopId.getKey(), shopId);
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::PurchaseUserItem, message, callback);
         _client->sendRequest(sc);
@@ -89,8 +89,8 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::receiveUserItemFrom(const FString &profileId, const FString &itemId, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsProfileId.getValue(), profileId);
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
+        message->SetStringField(OperationParam::UserItemsProfileId.getKey(), profileId);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::ReceiveUserItemFrom, message, callback);
         _client->sendRequest(sc);
@@ -99,11 +99,11 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::sellUserItem(const FString &itemId, int version, int quantity, const FString &shopId, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetNumberField(OperationParam::UserItemsVersion.getValue(), version);
-        message->SetNumberField(OperationParam::UserItemsQuantity.getValue(), quantity);
-        message->SetStringField(OperationParam::UserItemsShopId.getValue(), shopId);
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetNumberField(OperationParam::UserItemsVersion.getKey(), version);
+        message->SetNumberField(OperationParam::UserItemsQuantity.getKey(), quantity);
+        message->SetStringField(OperationParam::UserItemsShopId.getKey(), shopId);
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::SellUserItem, message, callback);
         _client->sendRequest(sc);
@@ -112,9 +112,9 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::updateUserItemData(const FString &itemId, int version, const FString &newItemData, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetNumberField(OperationParam::UserItemsVersion.getValue(), version);
-        message->SetObjectField(OperationParam::UserItemsNewItemData.getValue(), JsonUtil::jsonStringToValue(newItemData));
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetNumberField(OperationParam::UserItemsVersion.getKey(), version);
+        message->SetObjectField(OperationParam::UserItemsNewItemData.getKey(), JsonUtil::jsonStringToValue(newItemData));
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::UpdateUserItemData, message, callback);
         _client->sendRequest(sc);
@@ -123,10 +123,10 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::useUserItem(const FString &itemId, int version, const FString &newItemData, bool includeDef, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetNumberField(OperationParam::UserItemsVersion.getValue(), version);
-        message->SetObjectField(OperationParam::UserItemsNewItemData.getValue(), JsonUtil::jsonStringToValue(newItemData));
-        message->SetBoolField(OperationParam::UserItemsIncludeDef.getValue(), includeDef);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetNumberField(OperationParam::UserItemsVersion.getKey(), version);
+        message->SetObjectField(OperationParam::UserItemsNewItemData.getKey(), JsonUtil::jsonStringToValue(newItemData));
+        message->SetBoolField(OperationParam::UserItemsIncludeDef.getKey(), includeDef);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::UseUserItem, message, callback);
         _client->sendRequest(sc);
@@ -135,8 +135,8 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::publishUserItemToBlockchain(const FString &itemId, int version, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetNumberField(OperationParam::UserItemsVersion.getValue(), version);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetNumberField(OperationParam::UserItemsVersion.getKey(), version);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::PublishUserItemToBlackchain, message, callback);
         _client->sendRequest(sc);
@@ -153,8 +153,8 @@ BrainCloudUserItems::BrainCloudUserItems(BrainCloudClient *client) : _client(cli
 	void BrainCloudUserItems::removeUserItemFromBlockchain(const FString &itemId, int version, IServerCallback *callback)
     {
         TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-        message->SetStringField(OperationParam::UserItemsItemId.getValue(), itemId);
-        message->SetNumberField(OperationParam::UserItemsVersion.getValue(), version);
+        message->SetStringField(OperationParam::UserItemsItemId.getKey(), itemId);
+        message->SetNumberField(OperationParam::UserItemsVersion.getKey(), version);
 
         ServerCall *sc = new ServerCall(ServiceName::UserItems, ServiceOperation::RemoveUserItemFromBlockchain, message, callback);
         _client->sendRequest(sc);
@@ -14,7 +14,7 @@ void BrainCloudVirtualCurrency::getCurrency(const FString &in_vcId, IServerCallb
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
     if (OperationParam::isOptionalParamValid(in_vcId))
     {
-        message->SetStringField(OperationParam::VirtualCurrencyVcId.getValue(), in_vcId);
+        message->SetStringField(OperationParam::VirtualCurrencyVcId.getKey(), in_vcId);
     }
 
     ServerCall *sc = new ServerCall(ServiceName::VirtualCurrency, ServiceOperation::GetPlayerCurrency, message, callback);
@@ -26,9 +26,9 @@ void BrainCloudVirtualCurrency::getParentCurrency(const FString &in_vcId, const
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
     if (OperationParam::isOptionalParamValid(in_vcId))
     {
-        message->SetStringField(OperationParam::VirtualCurrencyVcId.getValue(), in_vcId);
+        message->SetStringField(OperationParam::VirtualCurrencyVcId.getKey(), in_vcId);
     }
-    message->SetStringField(OperationParam::VirtualCurrencyLevelName.getValue(), in_levelName);
+    message->SetStringField(OperationParam::VirtualCurrencyLevelName.getKey(), in_levelName);
 
     ServerCall *sc = new ServerCall(ServiceName::VirtualCurrency, ServiceOperation::GetParentCurrency, message, callback);
     _client->sendRequest(sc);
@@ -39,9 +39,9 @@ void BrainCloudVirtualCurrency::getPeerCurrency(const FString &in_vcId, const FS
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
     if (OperationParam::isOptionalParamValid(in_vcId))
     {
-        message->SetStringField(OperationParam::VirtualCurrencyVcId.getValue(), in_vcId);
+        message->SetStringField(OperationParam::VirtualCurrencyVcId.getKey(), in_vcId);
     }
-    message->SetStringField(OperationParam::VirtualCurrencyPeerCode.getValue(), in_peerCode);
+    message->SetStringField(OperationParam::VirtualCurrencyPeerCode.getKey(), in_peerCode);
 
     ServerCall *sc = new ServerCall(ServiceName::VirtualCurrency, ServiceOperation::GetPeerCurrency, message, callback);
     _client->sendRequest(sc);
@@ -50,8 +50,8 @@ void BrainCloudVirtualCurrency::getPeerCurrency(const FString &in_vcId, const FS
 void BrainCloudVirtualCurrency::awardCurrency(const FString &currencyType, int32 amount, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::VirtualCurrencyVcId.getValue(), currencyType);
-    message->SetNumberField(OperationParam::VirtualCurrencyAmount.getValue(), amount);
+    message->SetStringField(OperationParam::VirtualCurrencyVcId.getKey(), currencyType);
+    message->SetNumberField(OperationParam::VirtualCurrencyAmount.getKey(), amount);
 
     ServerCall *sc = new ServerCall(ServiceName::VirtualCurrency, ServiceOperation::AwardVirtualCurrency, message, callback);
     _client->sendRequest(sc);
@@ -60,8 +60,8 @@ void BrainCloudVirtualCurrency::awardCurrency(const FString &currencyType, int32
 void BrainCloudVirtualCurrency::consumeCurrency(const FString &currencyType, int32 amount, IServerCallback *callback)
 {
     TSharedRef<FJsonObject> message = MakeShareable(new FJsonObject());
-    message->SetStringField(OperationParam::VirtualCurrencyVcId.getValue(), currencyType);
-    message->SetNumberField(OperationParam::VirtualCurrencyAmount.getValue(), amount);
+    message->SetStringField(OperationParam::VirtualCurrencyVcId.getKey(), currencyType);
+    message->SetNumberField(OperationParam::VirtualCurrencyAmount.getKey(), amount);
 
     ServerCall *sc = new ServerCall(ServiceName::VirtualCurrency, ServiceOperation::ConsumeVirtualCurrency, message, callback);
     _client->sendRequest(sc);
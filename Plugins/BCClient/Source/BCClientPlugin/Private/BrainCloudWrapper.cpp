@@ -113,6 +113,9 @@ void UBrainCloudWrapper::reauthenticate()
 // authenticate the player with an anonymous id
 void UBrainCloudWrapper::authenticateAnonymous(IServerCallback *callback)
 {
+    if (resumeSession(callback))
+        return;
+
     _authenticateCallback = callback;
     initializeIdentity(true);
     _client->getAuthenticationService()->authenticateAnonymous(true, this);
@@ -324,6 +327,7 @@ void UBrainCloudWrapper::reconnect(IServerCallback *callback)
 void UBrainCloudWrapper::runCallbacks()
 {
     _client->runCallbacks();
+    updateStoredSession();
 }
 
 void UBrainCloudWrapper::setAlwaysAllowProfileSwitch(bool alwaysAllow)
@@ -336,6 +340,65 @@ bool UBrainCloudWrapper::getAlwaysAllowProfileSwitch()
     return _alwaysAllowProfileSwitch;
 }
 
+bool UBrainCloudWrapper::resumeSession(IServerCallback *callback)
+{
+    // only an anonymous session can be authenticated again without asking the user
+    if (!_sessionResumeEnabled || _storedSessionId.IsEmpty() || getStoredProfileId().IsEmpty() ||
+        _authenticationType != OperationParam::AuthenticateServiceAuthenticateAuthAnonymous.getValue())
+    {
+        return false;
+    }
+
+    // leave some margin so the session doesn't expire on its way to the server
+    if (_storedSessionExpiresAt - FDateTime::UtcNow() < FTimespan::FromSeconds(60))
+        return false;
+
+    initializeIdentity(true);
+
+    // a rejected session comes back to the wrapper, the callback has already been answered
+    _authenticateCallback = nullptr;
+
+    TSharedRef<FJsonObject> data = MakeShareable(new FJsonObject());
+    data->SetStringField(TEXT("profileId"), getStoredProfileId());
+    data->SetStringField(TEXT("sessionId"), _storedSessionId);
+    data->SetNumberField(TEXT("playerSessionExpiry"), _storedSessionExpirySeconds);
+    data->SetBoolField(TEXT("isResumedSession"), true);
+
+    TSharedRef<FJsonObject> response = MakeShareable(new FJsonObject());
+    response->SetNumberField(TEXT("status"), 200);
+    response->SetObjectField(TEXT("data"), data);
+
+    // the callback hears back on the next runCallbacks, as it would from the server
+    _client->getBrainCloudComms()->ResumeSession(_storedSessionId, _storedSessionExpirySeconds, _storedMaxBundleMsgs, _storedMaxKillCount, this,
+                                                 callback, GetJsonString(response));
+    return true;
+}
+
+void UBrainCloudWrapper::updateStoredSession()
+{
+    if (!_sessionResumeEnabled || _storedSessionId.IsEmpty())
+        return;
+
+    // a logout or full reset clears the profile id, the session is gone with it
+    if (getStoredProfileId().IsEmpty())
+    {
+        _storedSessionId = TEXT("");
+        _storedSessionExpiresAt = FDateTime();
+        saveData();
+        return;
+    }
+
+    FDateTime expiresAt = _client->getBrainCloudComms()->GetSessionExpiresAt(_storedSessionId);
+    if (expiresAt <= _storedSessionExpiresAt)
+        return;
+
+    _storedSessionExpiresAt = expiresAt;
+
+    // the saved expiry only ever lags behind, a minute of it is not worth a write per response
+    if (_storedSessionExpiresAt - _savedSessionExpiresAt >= FTimespan::FromSeconds(60))
+        saveData();
+}
+
 void UBrainCloudWrapper::serverCallback(ServiceName serviceName, ServiceOperation serviceOperation, FString const &jsonData)
 {
     if (serviceName == ServiceName::AuthenticateV2 && serviceOperation == ServiceOperation::Authenticate)
@@ -355,6 +418,17 @@ void UBrainCloudWrapper::serverCallback(ServiceName serviceName, ServiceOperatio
         {
             setStoredProfileId(profileId);
         }
+
+        if (_sessionResumeEnabled)
+        {
+            BrainCloudComms *comms = _client->getBrainCloudComms();
+            _storedSessionId = comms->GetSessionId();
+            _storedSessionExpirySeconds = comms->GetSessionExpirySeconds();
+            _storedSessionExpiresAt = FDateTime::UtcNow() + FTimespan::FromSeconds(_storedSessionExpirySeconds);
+            _storedMaxBundleMsgs = comms->GetMaxBundleMessages();
+            _storedMaxKillCount = comms->GetKillSwitchThreshold();
+            saveData();
+        }
     }
 
     if (_authenticateCallback != nullptr)
@@ -406,6 +480,12 @@ void UBrainCloudWrapper::loadData()
     _client->getAuthenticationService()->setProfileId(LoadGameInstance->ProfileId);
     _client->getAuthenticationService()->setAnonymousId(LoadGameInstance->AnonymousId);
     _authenticationType = LoadGameInstance->AuthenticationType;
+    _storedSessionId = LoadGameInstance->SessionId;
+    _storedSessionExpiresAt = LoadGameInstance->SessionExpiresAt;
+    _savedSessionExpiresAt = _storedSessionExpiresAt;
+    _storedSessionExpirySeconds = LoadGameInstance->SessionExpirySeconds;
+    _storedMaxBundleMsgs = LoadGameInstance->MaxBundleMsgs;
+    _storedMaxKillCount = LoadGameInstance->MaxKillCount;
 }
 
 void UBrainCloudWrapper::saveData()
@@ -414,6 +494,12 @@ void UBrainCloudWrapper::saveData()
     SaveGameInstance->ProfileId = _client->getAuthenticationService()->getProfileId();
     SaveGameInstance->AnonymousId = _client->getAuthenticationService()->getAnonymousId();
     SaveGameInstance->AuthenticationType = _authenticationType;
+    SaveGameInstance->SessionId = _storedSessionId;
+    SaveGameInstance->SessionExpiresAt = _storedSessionExpiresAt;
+    _savedSessionExpiresAt = _storedSessionExpiresAt;
+    SaveGameInstance->SessionExpirySeconds = _storedSessionExpirySeconds;
+    SaveGameInstance->MaxBundleMsgs = _storedMaxBundleMsgs;
+    SaveGameInstance->MaxKillCount = _storedMaxKillCount;
 
     FString slotPrefix = _wrapperName;
 
@@ -82,3 +82,174 @@ TArray<TSharedPtr<FJsonValue>> JsonUtil::arrayToJsonArray(const TArray<int32> &a
     }
     return jsonArray;
 }
+
+int32 JsonUtil::skipJsonWhitespace(const TCHAR *json, int32 len, int32 pos)
+{
+    while (pos < len && (json[pos] == ' ' || json[pos] == '\t' || json[pos] == '\n' || json[pos] == '\r'))
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+int32 JsonUtil::skipJsonValue(const TCHAR *json, int32 len, int32 pos)
+{
+    pos = skipJsonWhitespace(json, len, pos);
+    if (pos >= len)
+        return INDEX_NONE;
+
+    if (json[pos] == '"')
+    {
+        for (++pos; pos < len; ++pos)
+        {
+            if (json[pos] == '\\')
+                ++pos;
+            else if (json[pos] == '"')
+                return pos + 1;
+        }
+        return INDEX_NONE;
+    }
+
+    if (json[pos] == '{' || json[pos] == '[')
+    {
+        int32 depth = 0;
+        for (; pos < len; ++pos)
+        {
+            TCHAR c = json[pos];
+            if (c == '"')
+            {
+                pos = skipJsonValue(json, len, pos);
+                if (pos == INDEX_NONE)
+                    return INDEX_NONE;
+                --pos;
+            }
+            else if (c == '{' || c == '[')
+            {
+                ++depth;
+            }
+            else if (c == '}' || c == ']')
+            {
+                if (--depth == 0)
+                    return pos + 1;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    // number, true, false or null
+    int32 start = pos;
+    while (pos < len && json[pos] != ',' && json[pos] != '}' && json[pos] != ']' &&
+           json[pos] != ' ' && json[pos] != '\t' && json[pos] != '\n' && json[pos] != '\r')
+    {
+        ++pos;
+    }
+    return pos > start ? pos : INDEX_NONE;
+}
+
+bool JsonUtil::findJsonField(const TCHAR *json, int32 len, int32 objectStart, const TCHAR *fieldName, int32 &outValueStart, int32 &outValueEnd)
+{
+    int32 pos = skipJsonWhitespace(json, len, objectStart);
+    if (pos >= len || json[pos] != '{')
+        return false;
+
+    int32 fieldNameLen = FCString::Strlen(fieldName);
+    pos = skipJsonWhitespace(json, len, pos + 1);
+    while (pos < len && json[pos] == '"')
+    {
+        int32 keyEnd = skipJsonValue(json, len, pos);
+        if (keyEnd == INDEX_NONE)
+            return false;
+
+        // keys are compared raw, none of the fields we look up need unescaping
+        bool isMatch = (keyEnd - pos - 2) == fieldNameLen && FCString::Strncmp(json + pos + 1, fieldName, fieldNameLen) == 0;
+
+        pos = skipJsonWhitespace(json, len, keyEnd);
+        if (pos >= len || json[pos] != ':')
+            return false;
+
+        int32 valueStart = skipJsonWhitespace(json, len, pos + 1);
+        int32 valueEnd = skipJsonValue(json, len, valueStart);
+        if (valueEnd == INDEX_NONE)
+            return false;
+
+        if (isMatch)
+        {
+            outValueStart = valueStart;
+            outValueEnd = valueEnd;
+            return true;
+        }
+
+        pos = skipJsonWhitespace(json, len, valueEnd);
+        if (pos >= len || json[pos] != ',')
+            return false;
+        pos = skipJsonWhitespace(json, len, pos + 1);
+    }
+    return false;
+}
+
+bool JsonUtil::splitJsonArray(const TCHAR *json, int32 len, int32 arrayStart, TArray<TPair<int32, int32>> &outElements)
+{
+    int32 pos = skipJsonWhitespace(json, len, arrayStart);
+    if (pos >= len || json[pos] != '[')
+        return false;
+
+    pos = skipJsonWhitespace(json, len, pos + 1);
+    if (pos < len && json[pos] == ']')
+        return true;
+
+    while (pos < len)
+    {
+        int32 valueEnd = skipJsonValue(json, len, pos);
+        if (valueEnd == INDEX_NONE)
+            return false;
+        outElements.Add(TPair<int32, int32>(pos, valueEnd));
+
+        pos = skipJsonWhitespace(json, len, valueEnd);
+        if (pos < len && json[pos] == ']')
+            return true;
+        if (pos >= len || json[pos] != ',')
+            return false;
+        pos = skipJsonWhitespace(json, len, pos + 1);
+    }
+    return false;
+}
+
+FString JsonUtil::unescapeJsonString(const TCHAR *json, int32 start, int32 end)
+{
+    // strip the quotes if given the whole value
+    if (end - start >= 2 && json[start] == '"' && json[end - 1] == '"')
+    {
+        ++start;
+        --end;
+    }
+
+    FString result;
+    result.Reserve(end - start);
+    for (int32 i = start; i < end; ++i)
+    {
+        if (json[i] != '\\' || i + 1 >= end)
+        {
+            result.AppendChar(json[i]);
+            continue;
+        }
+
+        TCHAR c = json[++i];
+        switch (c)
+        {
+        case 'b': result.AppendChar('\b'); break;
+        case 'f': result.AppendChar('\f'); break;
+        case 'n': result.AppendChar('\n'); break;
+        case 'r': result.AppendChar('\r'); break;
+        case 't': result.AppendChar('\t'); break;
+        case 'u':
+            if (i + 4 < end)
+            {
+                result.AppendChar((TCHAR)FParse::HexNumber(*FString(4, json + i + 1)));
+                i += 4;
+            }
+            break;
+        default: result.AppendChar(c); break;
+        }
+    }
+    return result;
+}
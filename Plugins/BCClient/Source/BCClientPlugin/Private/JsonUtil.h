@@ -14,4 +14,15 @@ class BCCLIENTPLUGIN_API JsonUtil
     static FString jsonArrayToString(const TArray<TSharedPtr<FJsonValue>> &jsonArray);
     static TArray<TSharedPtr<FJsonValue>> arrayToJsonArray(const TArray<FString> &array);
     static TArray<TSharedPtr<FJsonValue>> arrayToJsonArray(const TArray<int32> &array);
+
+    /**
+     * Minimal scanner for locating values in a json document without building
+     * a tree. Positions are offsets into json, ranges are [start, end).
+     * Functions return INDEX_NONE / false on malformed input.
+     */
+    static int32 skipJsonWhitespace(const TCHAR *json, int32 len, int32 pos);
+    static int32 skipJsonValue(const TCHAR *json, int32 len, int32 pos);
+    static bool findJsonField(const TCHAR *json, int32 len, int32 objectStart, const TCHAR *fieldName, int32 &outValueStart, int32 &outValueEnd);
+    static bool splitJsonArray(const TCHAR *json, int32 len, int32 arrayStart, TArray<TPair<int32, int32>> &outElements);
+    static FString unescapeJsonString(const TCHAR *json, int32 start, int32 end);
 };
@@ -4,6 +4,7 @@
 #include "BCClientPluginPrivatePCH.h"
 
 #include <Json.h>
+#include "BCJsonWriter.h"
 
 //////////////////////////////////////////////////////
 // (De)Constructors
@@ -21,6 +22,18 @@ ServerCall::ServerCall(ServiceName serviceName, ServiceOperation serviceOperatio
     _data = data;
 }
 
+/**
+ * Constructor for a call which is already serialized
+ */
+ServerCall::ServerCall(ServiceName serviceName, ServiceOperation serviceOperation,
+                       const TArray<uint8> &payload, IServerCallback *callback /* = nullptr*/)
+    : _callback(callback),
+      _payload(payload),
+      _operation(serviceOperation),
+      _service(serviceName)
+{
+}
+
 /**
  * Destructor
  */
@@ -29,15 +42,35 @@ ServerCall::~ServerCall()
 }
 
 /**
- * Spit out a JSON object tree based on the contents of this ServerCall.
- *
- * @return Json::Value
+ * Write the message as utf8 json, ready to be spliced into a bundle.
+ * The data object is released once written, so this should be called
+ * before the call is handed over to the comms. A call without data is
+ * written with an empty data object.
  */
-TSharedRef<FJsonObject> ServerCall::getPayload()
+void ServerCall::serialize()
 {
-    TSharedRef<FJsonObject> payload = MakeShareable(new FJsonObject());
-    payload->SetStringField(TEXT("service"), _service.getValue());
-    payload->SetStringField(TEXT("operation"), _operation.getValue());
-    payload->SetObjectField(TEXT("data"), _data);
-    return payload;
+    // already written, by an earlier call or by the payload constructor
+    if (!_data.IsValid() && _payload.Num() > 0)
+        return;
+
+    _payload.Reset();
+    BCJsonWriter writer(_payload);
+    writer.BeginObject();
+    writer.WriteKey(TEXT("service"));
+    writer.WriteString(_service.getValue(), _service.getLength());
+    writer.WriteKey(TEXT("operation"));
+    writer.WriteString(_operation.getValue(), _operation.getLength());
+    writer.WriteKey(TEXT("data"));
+    if (_data.IsValid())
+    {
+        writer.WriteObject(_data);
+    }
+    else
+    {
+        writer.BeginObject();
+        writer.EndObject();
+    }
+    writer.EndObject();
+
+    _data.Reset();
 }
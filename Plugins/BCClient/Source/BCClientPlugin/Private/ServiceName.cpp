@@ -3,81 +3,61 @@
 #include "ServiceName.h"
 #include "BCClientPluginPrivatePCH.h"
 
-ServiceName::ServiceName(const FString &name)
-{
-    _value = name;
-}
-
-const ServiceName ServiceName::None = ServiceName("None");
-
-const ServiceName ServiceName::AuthenticateV2 = ServiceName("authenticationV2");
-const ServiceName ServiceName::Identity = ServiceName("identity");
-const ServiceName ServiceName::ItemCatalog = ServiceName("itemCatalog");
-const ServiceName ServiceName::UserItems = ServiceName("userItems");
-const ServiceName ServiceName::Currency = ServiceName("currency");
-const ServiceName ServiceName::FriendData = ServiceName("friendData");
-const ServiceName ServiceName::HeartBeat = ServiceName("heartbeat");
-
-const ServiceName ServiceName::PushNotification = ServiceName("pushNotification");
-const ServiceName ServiceName::GlobalGameStatistics = ServiceName("globalGameStatistics");
-const ServiceName ServiceName::PlayerStatisticsEvent = ServiceName("playerStatisticsEvent");
-const ServiceName ServiceName::Twitter = ServiceName("twitter");
-const ServiceName ServiceName::Steam = ServiceName("steam");
-
-const ServiceName ServiceName::Presence = ServiceName("presence");
-const ServiceName ServiceName::PlayerState = ServiceName("playerState");
-const ServiceName ServiceName::Entity = ServiceName("entity");
-const ServiceName ServiceName::GlobalEntity = ServiceName("globalEntity");
-const ServiceName ServiceName::Friend = ServiceName("friend");
-const ServiceName ServiceName::Time = ServiceName("time");
-const ServiceName ServiceName::Tournament = ServiceName("tournament");
-const ServiceName ServiceName::GlobalFile = ServiceName("globalFileV3");
-const ServiceName ServiceName::CustomEntity = ServiceName("customEntity");
-const ServiceName ServiceName::VirtualCurrency = ServiceName("virtualCurrency");
-const ServiceName ServiceName::AppStore = ServiceName("appStore");
-
-const ServiceName ServiceName::Leaderboard = ServiceName("leaderboard");
-const ServiceName ServiceName::Event = ServiceName("event");
-const ServiceName ServiceName::PlayerStatistics = ServiceName("playerStatistics");
-const ServiceName ServiceName::GlobalStatistics = ServiceName("globalGameStatistics");
-const ServiceName ServiceName::AsyncMatch = ServiceName("asyncMatch");
-
-const ServiceName ServiceName::Script = ServiceName("script");
-const ServiceName ServiceName::MatchMaking = ServiceName("matchMaking");
-const ServiceName ServiceName::OneWayMatch = ServiceName("onewayMatch");
-const ServiceName ServiceName::PlaybackStream = ServiceName("playbackStream");
-const ServiceName ServiceName::Gamification = ServiceName("gamification");
-
-const ServiceName ServiceName::GlobalApp = ServiceName("globalApp");
-const ServiceName ServiceName::S3Handling = ServiceName("s3Handling");
-const ServiceName ServiceName::RedemptionCode = ServiceName("redemptionCode");
-const ServiceName ServiceName::DataStream = ServiceName("dataStream");
-const ServiceName ServiceName::Profanity = ServiceName("profanity");
-const ServiceName ServiceName::File = ServiceName("file");
-const ServiceName ServiceName::Group = ServiceName("group");
-const ServiceName ServiceName::Mail = ServiceName("mail");
+const ServiceName ServiceName::None = ServiceName(TEXT("None"));
+
+const ServiceName ServiceName::AuthenticateV2 = ServiceName(TEXT("authenticationV2"));
+const ServiceName ServiceName::Identity = ServiceName(TEXT("identity"));
+const ServiceName ServiceName::ItemCatalog = ServiceName(TEXT("itemCatalog"));
+const ServiceName ServiceName::UserItems = ServiceName(TEXT("userItems"));
+const ServiceName ServiceName::Currency = ServiceName(TEXT("currency"));
+const ServiceName ServiceName::FriendData = ServiceName(TEXT("friendData"));
+const ServiceName ServiceName::HeartBeat = ServiceName(TEXT("heartbeat"));
+
+const ServiceName ServiceName::PushNotification = ServiceName(TEXT("pushNotification"));
+const ServiceName ServiceName::GlobalGameStatistics = ServiceName(TEXT("globalGameStatistics"));
+const ServiceName ServiceName::PlayerStatisticsEvent = ServiceName(TEXT("playerStatisticsEvent"));
+const ServiceName ServiceName::Twitter = ServiceName(TEXT("twitter"));
+const ServiceName ServiceName::Steam = ServiceName(TEXT("steam"));
+
+const ServiceName ServiceName::Presence = ServiceName(TEXT("presence"));
+const ServiceName ServiceName::PlayerState = ServiceName(TEXT("playerState"));
+const ServiceName ServiceName::Entity = ServiceName(TEXT("entity"));
+const ServiceName ServiceName::GlobalEntity = ServiceName(TEXT("globalEntity"));
+const ServiceName ServiceName::Friend = ServiceName(TEXT("friend"));
+const ServiceName ServiceName::Time = ServiceName(TEXT("time"));
+const ServiceName ServiceName::Tournament = ServiceName(TEXT("tournament"));
+const ServiceName ServiceName::GlobalFile = ServiceName(TEXT("globalFileV3"));
+const ServiceName ServiceName::CustomEntity = ServiceName(TEXT("customEntity"));
+const ServiceName ServiceName::VirtualCurrency = ServiceName(TEXT("virtualCurrency"));
+const ServiceName ServiceName::AppStore = ServiceName(TEXT("appStore"));
+
+const ServiceName ServiceName::Leaderboard = ServiceName(TEXT("leaderboard"));
+const ServiceName ServiceName::Event = ServiceName(TEXT("event"));
+const ServiceName ServiceName::PlayerStatistics = ServiceName(TEXT("playerStatistics"));
+const ServiceName ServiceName::GlobalStatistics = ServiceName(TEXT("globalGameStatistics"));
+const ServiceName ServiceName::AsyncMatch = ServiceName(TEXT("asyncMatch"));
+
+const ServiceName ServiceName::Script = ServiceName(TEXT("script"));
+const ServiceName ServiceName::MatchMaking = ServiceName(TEXT("matchMaking"));
+const ServiceName ServiceName::OneWayMatch = ServiceName(TEXT("onewayMatch"));
+const ServiceName ServiceName::PlaybackStream = ServiceName(TEXT("playbackStream"));
+const ServiceName ServiceName::Gamification = ServiceName(TEXT("gamification"));
+
+const ServiceName ServiceName::GlobalApp = ServiceName(TEXT("globalApp"));
+const ServiceName ServiceName::S3Handling = ServiceName(TEXT("s3Handling"));
+const ServiceName ServiceName::RedemptionCode = ServiceName(TEXT("redemptionCode"));
+const ServiceName ServiceName::DataStream = ServiceName(TEXT("dataStream"));
+const ServiceName ServiceName::Profanity = ServiceName(TEXT("profanity"));
+const ServiceName ServiceName::File = ServiceName(TEXT("file"));
+const ServiceName ServiceName::Group = ServiceName(TEXT("group"));
+const ServiceName ServiceName::Mail = ServiceName(TEXT("mail"));
 
 // RTT
-const ServiceName ServiceName::RTTRegistration = ServiceName("rttRegistration");
-const ServiceName ServiceName::RTT = ServiceName("rtt");
-const ServiceName ServiceName::Chat = ServiceName("chat");
-const ServiceName ServiceName::Messaging = ServiceName("messaging");
-const ServiceName ServiceName::Lobby = ServiceName("lobby");
+const ServiceName ServiceName::RTTRegistration = ServiceName(TEXT("rttRegistration"));
+const ServiceName ServiceName::RTT = ServiceName(TEXT("rtt"));
+const ServiceName ServiceName::Chat = ServiceName(TEXT("chat"));
+const ServiceName ServiceName::Messaging = ServiceName(TEXT("messaging"));
+const ServiceName ServiceName::Lobby = ServiceName(TEXT("lobby"));
 
 // Relay
-const ServiceName ServiceName::Relay = ServiceName("relay");
-
-bool ServiceName::operator==(const ServiceName &s) const
-{
-    return _value == s.getValue();
-}
-
-bool ServiceName::operator!=(const ServiceName &s) const
-{
-    return _value != s.getValue();
-}
-
-void ServiceName::operator=(const ServiceName &s)
-{
-    _value = s.getValue();
-}
\ No newline at end of file
+const ServiceName ServiceName::Relay = ServiceName(TEXT("relay"));
@@ -3,11 +3,6 @@
 #include "ServiceOperation.h"
 #include "BCClientPluginPrivatePCH.h"
 
-ServiceOperation::ServiceOperation(const FString &operation)
-{
-	_value = operation;
-}
-
 const ServiceOperation ServiceOperation::None = ServiceOperation(TEXT("NONE"));
 
 const ServiceOperation ServiceOperation::Authenticate = ServiceOperation(TEXT("AUTHENTICATE"));
@@ -400,90 +395,80 @@ const ServiceOperation ServiceOperation::RequestClientConnection = ServiceOperat
 const ServiceOperation ServiceOperation::Connect = ServiceOperation(TEXT("CONNECT"));
 
 // chat
-const ServiceOperation ServiceOperation::ChannelConnect = ServiceOperation("CHANNEL_CONNECT");
-const ServiceOperation ServiceOperation::ChannelDisconnect = ServiceOperation("CHANNEL_DISCONNECT");
-const ServiceOperation ServiceOperation::DeleteChatMessage = ServiceOperation("DELETE_CHAT_MESSAGE");
-const ServiceOperation ServiceOperation::GetChannelId = ServiceOperation("GET_CHANNEL_ID");
-const ServiceOperation ServiceOperation::GetChannelInfo = ServiceOperation("GET_CHANNEL_INFO");
-const ServiceOperation ServiceOperation::GetChatMessage = ServiceOperation("GET_CHAT_MESSAGE");
-const ServiceOperation ServiceOperation::GetRecentChatMessages = ServiceOperation("GET_RECENT_CHAT_MESSAGES");
-const ServiceOperation ServiceOperation::GetSubscribedChannels = ServiceOperation("GET_SUBSCRIBED_CHANNELS");
-const ServiceOperation ServiceOperation::PostChatMessage = ServiceOperation("POST_CHAT_MESSAGE");
-const ServiceOperation ServiceOperation::PostChatMessageSimple = ServiceOperation("POST_CHAT_MESSAGE_SIMPLE");
-const ServiceOperation ServiceOperation::UpdateChatMessage = ServiceOperation("UPDATE_CHAT_MESSAGE");
+const ServiceOperation ServiceOperation::ChannelConnect = ServiceOperation(TEXT("CHANNEL_CONNECT"));
+const ServiceOperation ServiceOperation::ChannelDisconnect = ServiceOperation(TEXT("CHANNEL_DISCONNECT"));
+const ServiceOperation ServiceOperation::DeleteChatMessage = ServiceOperation(TEXT("DELETE_CHAT_MESSAGE"));
+const ServiceOperation ServiceOperation::GetChannelId = ServiceOperation(TEXT("GET_CHANNEL_ID"));
+const ServiceOperation ServiceOperation::GetChannelInfo = ServiceOperation(TEXT("GET_CHANNEL_INFO"));
+const ServiceOperation ServiceOperation::GetChatMessage = ServiceOperation(TEXT("GET_CHAT_MESSAGE"));
+const ServiceOperation ServiceOperation::GetRecentChatMessages = ServiceOperation(TEXT("GET_RECENT_CHAT_MESSAGES"));
+const ServiceOperation ServiceOperation::GetSubscribedChannels = ServiceOperation(TEXT("GET_SUBSCRIBED_CHANNELS"));
+const ServiceOperation ServiceOperation::PostChatMessage = ServiceOperation(TEXT("POST_CHAT_MESSAGE"));
+const ServiceOperation ServiceOperation::PostChatMessageSimple = ServiceOperation(TEXT("POST_CHAT_MESSAGE_SIMPLE"));
+const ServiceOperation ServiceOperation::UpdateChatMessage = ServiceOperation(TEXT("UPDATE_CHAT_MESSAGE"));
 
 // messaging
-const ServiceOperation ServiceOperation::DeleteMessages = ServiceOperation("DELETE_MESSAGES");
-const ServiceOperation ServiceOperation::GetMessageBoxes = ServiceOperation("GET_MESSAGE_BOXES");
-const ServiceOperation ServiceOperation::GetMessageCounts = ServiceOperation("GET_MESSAGE_COUNTS");
-const ServiceOperation ServiceOperation::GetMessages = ServiceOperation("GET_MESSAGES");
-const ServiceOperation ServiceOperation::GetMessagesPage = ServiceOperation("GET_MESSAGES_PAGE");
-const ServiceOperation ServiceOperation::GetMessagesPageOffset = ServiceOperation("GET_MESSAGES_PAGE_OFFSET");
-const ServiceOperation ServiceOperation::MarkMessagesRead = ServiceOperation("MARK_MESSAGES_READ");
-const ServiceOperation ServiceOperation::SEND_MESSAGE = ServiceOperation("SEND_MESSAGE");
-const ServiceOperation ServiceOperation::SendMessageSimple = ServiceOperation("SEND_MESSAGE_SIMPLE");
+const ServiceOperation ServiceOperation::DeleteMessages = ServiceOperation(TEXT("DELETE_MESSAGES"));
+const ServiceOperation ServiceOperation::GetMessageBoxes = ServiceOperation(TEXT("GET_MESSAGE_BOXES"));
+const ServiceOperation ServiceOperation::GetMessageCounts = ServiceOperation(TEXT("GET_MESSAGE_COUNTS"));
+const ServiceOperation ServiceOperation::GetMessages = ServiceOperation(TEXT("GET_MESSAGES"));
+const ServiceOperation ServiceOperation::GetMessagesPage = ServiceOperation(TEXT("GET_MESSAGES_PAGE"));
+const ServiceOperation ServiceOperation::GetMessagesPageOffset = ServiceOperation(TEXT("GET_MESSAGES_PAGE_OFFSET"));
+const ServiceOperation ServiceOperation::MarkMessagesRead = ServiceOperation(TEXT("MARK_MESSAGES_READ"));
+const ServiceOperation ServiceOperation::SEND_MESSAGE = ServiceOperation(TEXT("SEND_MESSAGE"));
+const ServiceOperation ServiceOperation::SendMessageSimple = ServiceOperation(TEXT("SEND_MESSAGE_SIMPLE"));
 
 // lobby
-const ServiceOperation ServiceOperation::FindLobby = ServiceOperation("FIND_LOBBY");
-const ServiceOperation ServiceOperation::FindLobbyWithPingData = ServiceOperation("FIND_LOBBY_WITH_PING_DATA");
-const ServiceOperation ServiceOperation::CreateLobby = ServiceOperation("CREATE_LOBBY");
-const ServiceOperation ServiceOperation::CreateLobbyWithPingData = ServiceOperation("CREATE_LOBBY_WITH_PING_DATA");
-const ServiceOperation ServiceOperation::FindOrCreateLobby = ServiceOperation("FIND_OR_CREATE_LOBBY");
-const ServiceOperation ServiceOperation::FindOrCreateLobbyWithPingData = ServiceOperation("FIND_OR_CREATE_LOBBY_WITH_PING_DATA");
-const ServiceOperation ServiceOperation::GetLobbyData = ServiceOperation("GET_LOBBY_DATA");
-const ServiceOperation ServiceOperation::UpdateReady = ServiceOperation("UPDATE_READY");
-const ServiceOperation ServiceOperation::UpdateSettings = ServiceOperation("UPDATE_SETTINGS");
-const ServiceOperation ServiceOperation::SwitchTeam = ServiceOperation("SWITCH_TEAM");
-const ServiceOperation ServiceOperation::SendSignal = ServiceOperation("SEND_SIGNAL");
-const ServiceOperation ServiceOperation::JoinLobby = ServiceOperation("JOIN_LOBBY");
-const ServiceOperation ServiceOperation::JoinLobbyWithPingData = ServiceOperation("JOIN_LOBBY_WITH_PING_DATA");
-const ServiceOperation ServiceOperation::LeaveLobby = ServiceOperation("LEAVE_LOBBY");
-const ServiceOperation ServiceOperation::RemoveMember = ServiceOperation("REMOVE_MEMBER");
-const ServiceOperation ServiceOperation::CancelFindRequest = ServiceOperation("CANCEL_FIND_REQUEST");
-const ServiceOperation ServiceOperation::GetRegionsForLobbies = ServiceOperation("GET_REGIONS_FOR_LOBBIES");
-const ServiceOperation ServiceOperation::PingData = ServiceOperation("PING_DATA");	// not an official API, but need it for proper calback
+const ServiceOperation ServiceOperation::FindLobby = ServiceOperation(TEXT("FIND_LOBBY"));
+const ServiceOperation ServiceOperation::FindLobbyWithPingData = ServiceOperation(TEXT("FIND_LOBBY_WITH_PING_DATA"));
+const ServiceOperation ServiceOperation::CreateLobby = ServiceOperation(TEXT("CREATE_LOBBY"));
+const ServiceOperation ServiceOperation::CreateLobbyWithPingData = ServiceOperation(TEXT("CREATE_LOBBY_WITH_PING_DATA"));
+const ServiceOperation ServiceOperation::FindOrCreateLobby = ServiceOperation(TEXT("FIND_OR_CREATE_LOBBY"));
+const ServiceOperation ServiceOperation::FindOrCreateLobbyWithPingData = ServiceOperation(TEXT("FIND_OR_CREATE_LOBBY_WITH_PING_DATA"));
+const ServiceOperation ServiceOperation::GetLobbyData = ServiceOperation(TEXT("GET_LOBBY_DATA"));
+const ServiceOperation ServiceOperation::UpdateReady = ServiceOperation(TEXT("UPDATE_READY"));
+const ServiceOperation ServiceOperation::UpdateSettings = ServiceOperation(TEXT("UPDATE_SETTINGS"));
+const ServiceOperation ServiceOperation::SwitchTeam = ServiceOperation(TEXT("SWITCH_TEAM"));
+const ServiceOperation ServiceOperation::SendSignal = ServiceOperation(TEXT("SEND_SIGNAL"));
+const ServiceOperation ServiceOperation::JoinLobby = ServiceOperation(TEXT("JOIN_LOBBY"));
+const ServiceOperation ServiceOperation::JoinLobbyWithPingData = ServiceOperation(TEXT("JOIN_LOBBY_WITH_PING_DATA"));
+const ServiceOperation ServiceOperation::LeaveLobby = ServiceOperation(TEXT("LEAVE_LOBBY"));
+const ServiceOperation ServiceOperation::RemoveMember = ServiceOperation(TEXT("REMOVE_MEMBER"));
+const ServiceOperation ServiceOperation::CancelFindRequest = ServiceOperation(TEXT("CANCEL_FIND_REQUEST"));
+const ServiceOperation ServiceOperation::GetRegionsForLobbies = ServiceOperation(TEXT("GET_REGIONS_FOR_LOBBIES"));
+const ServiceOperation ServiceOperation::PingData = ServiceOperation(TEXT("PING_DATA"));	// not an official API, but need it for proper calback
 
 // user inventory management
-const ServiceOperation ServiceOperation::AwardUserItem = ServiceOperation("AWARD_USER_ITEM");
-const ServiceOperation ServiceOperation::DropUserItem = ServiceOperation("DROP_USER_ITEM");
-const ServiceOperation ServiceOperation::GetUserItemsPage = ServiceOperation("GET_USER_ITEMS_PAGE");
-const ServiceOperation ServiceOperation::GetUserItemsPageOffset = ServiceOperation("GET_USER_ITEMS_PAGE_OFFSET");
-const ServiceOperation ServiceOperation::GetUserItem = ServiceOperation("GET_USER_ITEM");
-const ServiceOperation ServiceOperation::GiveUserItemTo = ServiceOperation("GIVE_USER_ITEM_TO");
-const ServiceOperation ServiceOperation::PurchaseUserItem = ServiceOperation("PURCHASE_USER_ITEM");
-const ServiceOperation ServiceOperation::ReceiveUserItemFrom = ServiceOperation("RECEIVE_USER_ITEM_FROM");
-const ServiceOperation ServiceOperation::SellUserItem = ServiceOperation("SELL_USER_ITEM");
-const ServiceOperation ServiceOperation::UpdateUserItemData = ServiceOperation("UPDATE_USER_ITEM_DATA");
-const ServiceOperation ServiceOperation::UseUserItem = ServiceOperation("USE_USER_ITEM");
-const ServiceOperation ServiceOperation::PublishUserItemToBlackchain = ServiceOperation("PUBLISH_USER_ITEM_TO_BLOCKCHAIN");
-const ServiceOperation ServiceOperation::RefreshBlockchainUserItems = ServiceOperation("REFRESH_BLOCKCHAIN_USER_ITEMS");
+const ServiceOperation ServiceOperation::AwardUserItem = ServiceOperation(TEXT("AWARD_USER_ITEM"));
+const ServiceOperation ServiceOperation::DropUserItem = ServiceOperation(TEXT("DROP_USER_ITEM"));
+const ServiceOperation ServiceOperation::GetUserItemsPage = ServiceOperation(TEXT("GET_USER_ITEMS_PAGE"));
+const ServiceOperation ServiceOperation::GetUserItemsPageOffset = ServiceOperation(TEXT("GET_USER_ITEMS_PAGE_OFFSET"));
+const ServiceOperation ServiceOperation::GetUserItem = ServiceOperation(TEXT("GET_USER_ITEM"));
+const ServiceOperation ServiceOperation::GiveUserItemTo = ServiceOperation(TEXT("GIVE_USER_ITEM_TO"));
+const ServiceOperation ServiceOperation::PurchaseUserItem = ServiceOperation(TEXT("PURCHASE_USER_ITEM"));
+const ServiceOperation ServiceOperation::ReceiveUserItemFrom = ServiceOperation(TEXT("RECEIVE_USER_ITEM_FROM"));
+const ServiceOperation ServiceOperation::SellUserItem = ServiceOperation(TEXT("SELL_USER_ITEM"));
+const ServiceOperation ServiceOperation::UpdateUserItemData = ServiceOperation(TEXT("UPDATE_USER_ITEM_DATA"));
+const ServiceOperation ServiceOperation::UseUserItem = ServiceOperation(TEXT("USE_USER_ITEM"));
+const ServiceOperation ServiceOperation::PublishUserItemToBlackchain = ServiceOperation(TEXT("PUBLISH_USER_ITEM_TO_BLOCKCHAIN"));
+const ServiceOperation ServiceOperation::RefreshBlockchainUserItems = ServiceOperation(TEXT("REFRESH_BLOCKCHAIN_USER_ITEMS"));
 
 //item catalog
-const ServiceOperation ServiceOperation::GetCatalogItemDefinition = ServiceOperation("GET_CATALOG_ITEM_DEFINITION");
-const ServiceOperation ServiceOperation::GetCatalogItemsPage = ServiceOperation("GET_CATALOG_ITEMS_PAGE");
-const ServiceOperation ServiceOperation::GetCatalogItemsPageOffset = ServiceOperation("GET_CATALOG_ITEMS_PAGE_OFFSET");
+const ServiceOperation ServiceOperation::GetCatalogItemDefinition = ServiceOperation(TEXT("GET_CATALOG_ITEM_DEFINITION"));
+const ServiceOperation ServiceOperation::GetCatalogItemsPage = ServiceOperation(TEXT("GET_CATALOG_ITEMS_PAGE"));
+const ServiceOperation ServiceOperation::GetCatalogItemsPageOffset = ServiceOperation(TEXT("GET_CATALOG_ITEMS_PAGE_OFFSET"));
 
 //custom entities
-const ServiceOperation ServiceOperation::CreateEntity = ServiceOperation("CREATE_ENTITY");
-const ServiceOperation ServiceOperation::DeleteEntity = ServiceOperation("DELETE_ENTITY");
-const ServiceOperation ServiceOperation::GetCount = ServiceOperation("GET_COUNT");
-const ServiceOperation ServiceOperation::CustomEntityGetPage = ServiceOperation("GET_PAGE");
-const ServiceOperation ServiceOperation::CustomEntityGetPageOffset = ServiceOperation("GET_PAGE_BY_OFFSET");
-const ServiceOperation ServiceOperation::CustomEntityGetEntityPage = ServiceOperation("GET_ENTITY_PAGE");
-const ServiceOperation ServiceOperation::CustomEntityGetEntityPageOffset = ServiceOperation("GET_ENTITY_PAGE_OFFSET");
-const ServiceOperation ServiceOperation::ReadEntity = ServiceOperation("READ_ENTITY");
-const ServiceOperation ServiceOperation::IncrementData = ServiceOperation("INCREMENT_DATA");
-const ServiceOperation ServiceOperation::UpdateEntity = ServiceOperation("UPDATE_ENTITY");
-const ServiceOperation ServiceOperation::UpdateEntityFields = ServiceOperation("UPDATE_ENTITY_FIELDS");
-const ServiceOperation ServiceOperation::DeleteEntities = ServiceOperation("DELETE_ENTITIES");
-const ServiceOperation ServiceOperation::UpdateSingletonFields = ServiceOperation("UPDATE_SINGLETON_FIELDS");
-
-bool ServiceOperation::operator==(const ServiceOperation &s) const
-{
-	return _value == s.getValue();
-}
-
-void ServiceOperation::operator=(const ServiceOperation &s)
-{
-	_value = s.getValue();
-}
+const ServiceOperation ServiceOperation::CreateEntity = ServiceOperation(TEXT("CREATE_ENTITY"));
+const ServiceOperation ServiceOperation::DeleteEntity = ServiceOperation(TEXT("DELETE_ENTITY"));
+const ServiceOperation ServiceOperation::GetCount = ServiceOperation(TEXT("GET_COUNT"));
+const ServiceOperation ServiceOperation::CustomEntityGetPage = ServiceOperation(TEXT("GET_PAGE"));
+const ServiceOperation ServiceOperation::CustomEntityGetPageOffset = ServiceOperation(TEXT("GET_PAGE_BY_OFFSET"));
+const ServiceOperation ServiceOperation::CustomEntityGetEntityPage = ServiceOperation(TEXT("GET_ENTITY_PAGE"));
+const ServiceOperation ServiceOperation::CustomEntityGetEntityPageOffset = ServiceOperation(TEXT("GET_ENTITY_PAGE_OFFSET"));
+const ServiceOperation ServiceOperation::ReadEntity = ServiceOperation(TEXT("READ_ENTITY"));
+const ServiceOperation ServiceOperation::IncrementData = ServiceOperation(TEXT("INCREMENT_DATA"));
+const ServiceOperation ServiceOperation::UpdateEntity = ServiceOperation(TEXT("UPDATE_ENTITY"));
+const ServiceOperation ServiceOperation::UpdateEntityFields = ServiceOperation(TEXT("UPDATE_ENTITY_FIELDS"));
+const ServiceOperation ServiceOperation::DeleteEntities = ServiceOperation(TEXT("DELETE_ENTITIES"));
+const ServiceOperation ServiceOperation::UpdateSingletonFields = ServiceOperation(TEXT("UPDATE_SINGLETON_FIELDS"));
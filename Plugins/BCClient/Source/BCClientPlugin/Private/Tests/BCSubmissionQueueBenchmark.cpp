@@ -0,0 +1,108 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "BCSubmissionQueue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	typedef TSharedRef<ServerCall, ESPMode::ThreadSafe> ServerCallRef;
+
+	const int32 BenchmarkCalls = 200000;
+	const int32 BenchmarkProducers = 4;
+
+	/**
+	 * What AddToQueue did before the submission queue, a list node and a
+	 * shared ref control block per call, added under the queue mutex.
+	 */
+	struct LockedQueue
+	{
+		void Push(ServerCall *serverCall)
+		{
+			FScopeLock Lock(&Mutex);
+			Calls.AddHead(MakeShareable(serverCall));
+		}
+
+		int32 Drain()
+		{
+			FScopeLock Lock(&Mutex);
+			int32 count = Calls.Num();
+			Calls.Empty();
+			return count;
+		}
+
+		FCriticalSection Mutex;
+		TDoubleLinkedList<ServerCallRef> Calls;
+	};
+
+	TArray<ServerCall *> MakeCalls(int32 count)
+	{
+		TArray<ServerCall *> calls;
+		calls.Reserve(count);
+		for (int32 i = 0; i < count; ++i)
+			calls.Add(new ServerCall(ServiceName::HeartBeat, ServiceOperation::Read, TArray<uint8>()));
+		return calls;
+	}
+
+	// pushes every call from the given number of threads, the calling thread drains as they come in
+	template <typename QueueType, typename DrainFunction>
+	double TimeEnqueue(QueueType &queue, const TArray<ServerCall *> &calls, int32 producers, DrainFunction drain)
+	{
+		int32 perProducer = calls.Num() / producers;
+		double start = FPlatformTime::Seconds();
+
+		TArray<TFuture<void>> tasks;
+		for (int32 p = 1; p < producers; ++p)
+		{
+			tasks.Add(Async(EAsyncExecution::Thread, [&queue, &calls, p, perProducer]() {
+				for (int32 i = p * perProducer; i < (p + 1) * perProducer; ++i)
+					queue.Push(calls[i]);
+			}));
+		}
+
+		int32 drained = 0;
+		for (int32 i = 0; i < perProducer; ++i)
+			queue.Push(calls[i]);
+		while (drained < perProducer * producers)
+			drained += drain();
+
+		for (TFuture<void> &task : tasks)
+			task.Wait();
+
+		return FPlatformTime::Seconds() - start;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBCSubmissionQueueBenchmark, "BrainCloud.Benchmark.SubmissionQueue", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FBCSubmissionQueueBenchmark::RunTest(const FString &Parameters)
+{
+	for (int32 producers : {1, BenchmarkProducers})
+	{
+		TArray<ServerCall *> lockFreeCalls = MakeCalls(BenchmarkCalls);
+		BCSubmissionQueue submissions;
+		double lockFreeSeconds = TimeEnqueue(submissions, lockFreeCalls, producers, [&submissions]() {
+			int32 count = 0;
+			while (ServerCall *serverCall = submissions.Pop())
+			{
+				delete serverCall;
+				++count;
+			}
+			return count;
+		});
+		TestEqual(TEXT("submission queue is empty"), submissions.Num(), 0);
+
+		TArray<ServerCall *> lockedCalls = MakeCalls(BenchmarkCalls);
+		LockedQueue locked;
+		double lockedSeconds = TimeEnqueue(locked, lockedCalls, producers, [&locked]() { return locked.Drain(); });
+
+		AddInfo(FString::Printf(TEXT("%d producer(s), %d calls: submission queue %.1f ns/call, locked list %.1f ns/call"),
+			producers, BenchmarkCalls, lockFreeSeconds * 1e9 / BenchmarkCalls, lockedSeconds * 1e9 / BenchmarkCalls));
+	}
+	return true;
+}
+
+#endif
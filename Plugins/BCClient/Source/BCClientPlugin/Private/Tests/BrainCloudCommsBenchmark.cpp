@@ -0,0 +1,51 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "BrainCloudComms.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBrainCloudCommsSignatureBenchmark, "BrainCloud.Benchmark.Signature", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FBrainCloudCommsSignatureBenchmark::RunTest(const FString &Parameters)
+{
+	const FString secretKey = TEXT("8f6e0e4a-5d3c-4b1f-9a7e-2c1d0b9a8f7e");
+	FTCHARToUTF8 secretUtf8(*secretKey);
+	TArray<uint8> secret(reinterpret_cast<const uint8 *>(secretUtf8.Get()), secretUtf8.Length());
+
+	for (int32 bodyBytes : {1024, 64 * 1024, 512 * 1024})
+	{
+		// a bundle body as SendPacket has it, already utf8
+		FString bodyString = TEXT("{\"messages\":[");
+		while (bodyString.Len() < bodyBytes)
+			bodyString += TEXT("{\"service\":\"entity\",\"operation\":\"UPDATE\",\"data\":{\"entityId\":\"0123456789\",\"version\":-1}},");
+		bodyString += TEXT("{}],\"sessionId\":\"abc\",\"gameId\":\"10000\",\"packetId\":1}");
+
+		FTCHARToUTF8 bodyUtf8(*bodyString);
+		TArray<uint8> body(reinterpret_cast<const uint8 *>(bodyUtf8.Get()), bodyUtf8.Length());
+
+		// the signature used to be taken over a concatenated copy, narrowed again inside the hash
+		FString previous = FMD5::HashAnsiString(*(bodyString + secretKey));
+		FString current = BrainCloudComms::GetSignature(body, secret);
+		TestEqual(FString::Printf(TEXT("%d byte body signature"), body.Num()), current, previous);
+
+		const int32 iterations = FMath::Max(10, (4 * 1024 * 1024) / body.Num());
+
+		double start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < iterations; ++i)
+			previous = FMD5::HashAnsiString(*(bodyString + secretKey));
+		double concatenatedSeconds = FPlatformTime::Seconds() - start;
+
+		start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < iterations; ++i)
+			current = BrainCloudComms::GetSignature(body, secret);
+		double incrementalSeconds = FPlatformTime::Seconds() - start;
+
+		AddInfo(FString::Printf(TEXT("%d byte body: incremental %.2f us, concatenated string %.2f us"),
+			body.Num(), incrementalSeconds * 1e6 / iterations, concatenatedSeconds * 1e6 / iterations));
+	}
+	return true;
+}
+
+#endif
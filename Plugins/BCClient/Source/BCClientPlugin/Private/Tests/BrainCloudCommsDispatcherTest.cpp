@@ -0,0 +1,140 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/Ticker.h"
+#include "BrainCloudClient.h"
+#include "BCLocalDispatcher.h"
+#include "IServerCallback.h"
+#include "HttpCodes.h"
+#include "ReasonCodes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_BC_LOCAL_DISPATCHER
+
+namespace
+{
+	const uint32 TestPort = 9197;
+
+	class RecordingCallback : public IServerCallback
+	{
+	  public:
+		virtual void serverCallback(ServiceName serviceName, ServiceOperation serviceOperation, const FString &jsonData) override { Successes++; }
+		virtual void serverError(ServiceName serviceName, ServiceOperation serviceOperation, int32 statusCode, int32 reasonCode, const FString &jsonError) override
+		{
+			Errors++;
+			StatusCode = statusCode;
+			Error = jsonError;
+		}
+
+		bool IsAnswered() const { return Successes + Errors > 0; }
+		void Reset()
+		{
+			Successes = 0;
+			Errors = 0;
+			StatusCode = 0;
+			Error.Empty();
+		}
+
+		int32 Successes = 0;
+		int32 Errors = 0;
+		int32 StatusCode = 0;
+		FString Error;
+	};
+
+	// the dispatcher and the http requests are ticked by the core ticker, responses are handed out by the client's callbacks
+	bool PumpUntilAnswered(BrainCloudClient &client, const RecordingCallback &callback, float seconds)
+	{
+		double deadline = FPlatformTime::Seconds() + seconds;
+		while (!callback.IsAnswered())
+		{
+			if (FPlatformTime::Seconds() >= deadline)
+				return false;
+			FTicker::GetCoreTicker().Tick(0.001f);
+			client.runCallbacks();
+			FPlatformProcess::Sleep(0.001f);
+		}
+		return true;
+	}
+
+	bool Authenticate(BrainCloudClient &client, RecordingCallback &callback)
+	{
+		callback.Reset();
+		client.getAuthenticationService()->initialize(TEXT(""), client.getAuthenticationService()->generateAnonymousId());
+		client.getAuthenticationService()->authenticateAnonymous(true, &callback);
+		return PumpUntilAnswered(client, callback, 5.0f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBrainCloudCommsLocalDispatcherTest, "BrainCloud.Comms.LocalDispatcher", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBrainCloudCommsLocalDispatcherTest::RunTest(const FString &Parameters)
+{
+	BCLocalDispatcher dispatcher(TestPort, TEXT("secret"));
+	if (!TestTrue(TEXT("dispatcher started"), dispatcher.Start()))
+		return false;
+
+	// each read is answered by the handler once, however many times its bundle is sent
+	int32 handledReads = 0;
+	dispatcher.SetHandler(ServiceName::PlayerState, ServiceOperation::Read,
+		[&handledReads](const FString &service, const FString &operation, const TSharedPtr<FJsonObject> &data) {
+			handledReads++;
+			return BCLocalResponse::Success(TEXT("{}"));
+		});
+
+	BrainCloudClient client;
+	client.initialize(dispatcher.GetServerUrl(), TEXT("secret"), TEXT("10000"), TEXT("1.0.0"));
+
+	// authentication hands out a session, a call without it would be answered NO_SESSION
+	RecordingCallback callback;
+	if (!TestTrue(TEXT("authentication answered"), Authenticate(client, callback)) || !TestEqual(TEXT("authenticated"), callback.Successes, 1))
+	{
+		dispatcher.Stop();
+		return false;
+	}
+
+	callback.Reset();
+	client.getPlayerStateService()->readUserState(&callback);
+	TestTrue(TEXT("call answered"), PumpUntilAnswered(client, callback, 5.0f));
+	TestEqual(TEXT("call carried the session"), callback.Successes, 1);
+	TestEqual(TEXT("call handled"), handledReads, 1);
+
+	// a client signing with another secret is turned away before any message is read
+	{
+		BrainCloudClient badClient;
+		badClient.initialize(dispatcher.GetServerUrl(), TEXT("not the secret"), TEXT("10000"), TEXT("1.0.0"));
+		RecordingCallback badCallback;
+		TestTrue(TEXT("bad signature answered"), Authenticate(badClient, badCallback));
+		TestEqual(TEXT("bad signature status"), badCallback.StatusCode, (int32)HttpCode::FORBIDDEN);
+		TestTrue(TEXT("bad signature reason"), badCallback.Error.Contains(FString::FromInt(ReasonCodes::BAD_SIGNATURE)));
+	}
+
+	// lost responses time out and the client sends the same packetId again, the
+	// dispatcher answers it from its cache rather than running the call twice
+	client.setPacketTimeouts({1, 1, 1, 1, 1});
+	dispatcher.SetSeed(13);
+	dispatcher.SetLossRate(0.3f);
+	dispatcher.ClearReceived();
+	handledReads = 0;
+
+	const int32 reads = 8;
+	int32 succeeded = 0;
+	for (int32 i = 0; i < reads; ++i)
+	{
+		callback.Reset();
+		client.getPlayerStateService()->readUserState(&callback);
+		PumpUntilAnswered(client, callback, 10.0f);
+		succeeded += callback.Successes;
+	}
+
+	TestTrue(TEXT("responses were lost"), dispatcher.GetDroppedCount() > 0);
+	TestTrue(TEXT("lost bundles were retried"), dispatcher.GetBundleCount() > reads);
+	TestEqual(TEXT("every call got through"), succeeded, reads);
+	TestEqual(TEXT("retries answered from the cache"), handledReads, reads);
+	TestEqual(TEXT("retries not received as new calls"), dispatcher.GetReceivedCalls().Num(), reads);
+
+	dispatcher.SetLossRate(0.0f);
+	dispatcher.Stop();
+	return true;
+}
+
+#endif
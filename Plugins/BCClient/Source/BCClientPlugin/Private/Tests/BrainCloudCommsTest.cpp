@@ -0,0 +1,156 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "BrainCloudComms.h"
+#include "IServerCallback.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	class NullServerCallback : public IServerCallback
+	{
+	  public:
+		virtual void serverCallback(ServiceName serviceName, ServiceOperation serviceOperation, const FString &jsonData) override {}
+		virtual void serverError(ServiceName serviceName, ServiceOperation serviceOperation, int32 statusCode, int32 reasonCode, const FString &jsonError) override {}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBrainCloudCommsBundleMarkerTest, "BrainCloud.Comms.BundleMarker", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBrainCloudCommsBundleMarkerTest::RunTest(const FString &Parameters)
+{
+	BrainCloudComms comms(nullptr);
+	comms.Initialize(TEXT("http://localhost/dispatcherv2"), TEXT("secret"), TEXT("10000"));
+
+	auto queue = [&comms](eBCCallPriority priority)
+	{
+		ServerCall *servercall = new ServerCall(ServiceName::PlayerState, ServiceOperation::Read, MakeShareable(new FJsonObject()));
+		servercall->setPriority(priority);
+		comms.AddToQueue(servercall);
+		return servercall;
+	};
+
+	auto testPacket = [this](const TCHAR *what, BrainCloudComms::PacketRef packet, const TArray<ServerCall *> &expected)
+	{
+		if (!TestEqual(FString::Printf(TEXT("%s call count"), what), packet->Num(), expected.Num()))
+			return;
+
+		for (int32 i = 0; i < expected.Num(); ++i)
+			TestTrue(FString::Printf(TEXT("%s call %d"), what, i), &(*packet)[i].Get() == expected[i]);
+	};
+
+	// calls queued after the marker stay out of the bundle, even from a higher lane
+	ServerCall *interactive = queue(eBCCallPriority::INTERACTIVE);
+	ServerCall *background = queue(eBCCallPriority::BACKGROUND);
+	comms.InsertEndOfMessageBundleMarker();
+	ServerCall *critical = queue(eBCCallPriority::CRITICAL);
+	ServerCall *lateInteractive = queue(eBCCallPriority::INTERACTIVE);
+
+	testPacket(TEXT("first bundle"), comms.BuildPacket(), {interactive, background});
+	testPacket(TEXT("second bundle"), comms.BuildPacket(), {critical, lateInteractive});
+
+	// a bundle cut short by the message limit carries on up to the same marker
+	comms._maxBundleMessages = 2;
+	ServerCall *first = queue(eBCCallPriority::BACKGROUND);
+	ServerCall *second = queue(eBCCallPriority::INTERACTIVE);
+	ServerCall *third = queue(eBCCallPriority::CRITICAL);
+	comms.InsertEndOfMessageBundleMarker();
+	ServerCall *after = queue(eBCCallPriority::CRITICAL);
+
+	testPacket(TEXT("full bundle"), comms.BuildPacket(), {third, second});
+	testPacket(TEXT("rest of the marked bundle"), comms.BuildPacket(), {first});
+	testPacket(TEXT("bundle after the marker"), comms.BuildPacket(), {after});
+	TestEqual(TEXT("markers left"), comms._bundleMarkers.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBrainCloudCommsRejectedSessionTest, "BrainCloud.Comms.RejectedSession", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBrainCloudCommsRejectedSessionTest::RunTest(const FString &Parameters)
+{
+	BrainCloudComms comms(nullptr);
+	comms.Initialize(TEXT("http://localhost/dispatcherv2"), TEXT("secret"), TEXT("10000"));
+
+	auto queue = [&comms](ServiceName service, ServiceOperation operation, eBCCallPriority priority)
+	{
+		ServerCall *servercall = new ServerCall(service, operation, MakeShareable(new FJsonObject()));
+		servercall->setPriority(priority);
+		comms.AddToQueue(servercall);
+		return servercall;
+	};
+
+	// a resumed session's first bundle, rejected by the server
+	ServerCall *critical = queue(ServiceName::PlayerState, ServiceOperation::Read, eBCCallPriority::CRITICAL);
+	ServerCall *interactive = queue(ServiceName::PlayerState, ServiceOperation::Read, eBCCallPriority::INTERACTIVE);
+	comms.InsertEndOfMessageBundleMarker();
+	comms.RejectResumedSession(comms.BuildPacket());
+	TestEqual(TEXT("rejected calls are held back"), comms.GetQueuedCount(), 0);
+
+	// a call made while the rejection was on its way to the game thread, then the new authentication
+	ServerCall *later = queue(ServiceName::PlayerState, ServiceOperation::Read, eBCCallPriority::CRITICAL);
+	ServerCall *authentication = queue(ServiceName::AuthenticateV2, ServiceOperation::Authenticate, eBCCallPriority::CRITICAL);
+	comms.RequeueRejectedCalls();
+
+	BrainCloudComms::PacketRef first = comms.BuildPacket();
+	if (TestEqual(TEXT("authentication bundle"), first->Num(), 1))
+		TestTrue(TEXT("authentication goes first"), &(*first)[0].Get() == authentication);
+
+	// the rejected bundle goes out again as it was, its marker still holds
+	BrainCloudComms::PacketRef second = comms.BuildPacket();
+	if (TestEqual(TEXT("rejected bundle"), second->Num(), 2))
+	{
+		TestTrue(TEXT("rejected critical call"), &(*second)[0].Get() == critical);
+		TestTrue(TEXT("rejected interactive call"), &(*second)[1].Get() == interactive);
+	}
+
+	BrainCloudComms::PacketRef third = comms.BuildPacket();
+	if (TestEqual(TEXT("bundle after the rejected one"), third->Num(), 1))
+		TestTrue(TEXT("call made since"), &(*third)[0].Get() == later);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBrainCloudCommsWarmUpTest, "BrainCloud.Comms.WarmUp", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBrainCloudCommsWarmUpTest::RunTest(const FString &Parameters)
+{
+	BrainCloudComms comms(nullptr);
+	comms.Initialize(TEXT("http://localhost/dispatcherv2"), TEXT("secret"), TEXT("10000"));
+
+	// recorded calls keep nothing of the callback they were made with
+	NullServerCallback callback;
+	comms.BeginWarmUpCalls(false);
+	comms.AddToQueue(new ServerCall(ServiceName::PlayerState, ServiceOperation::Read, MakeShareable(new FJsonObject()), &callback));
+	comms.AddToQueue(new ServerCall(ServiceName::PlayerStatistics, ServiceOperation::Read, MakeShareable(new FJsonObject()), &callback));
+	comms.AddToQueue(new ServerCall(ServiceName::HeartBeat, ServiceOperation::Read, MakeShareable(new FJsonObject())));
+	comms.EndWarmUpCalls();
+
+	// the heartbeat is the comms' own, it goes out as usual
+	BrainCloudComms::PacketRef heartbeat = comms.BuildPacket();
+	if (TestEqual(TEXT("only the heartbeat is queued"), heartbeat->Num(), 1))
+		TestTrue(TEXT("heartbeat not recorded"), (*heartbeat)[0]->getService() == ServiceName::HeartBeat);
+
+	ServerCall *authentication = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::Authenticate, MakeShareable(new FJsonObject()), &callback);
+	comms.AddToQueue(authentication);
+	BrainCloudComms::PacketRef packet = comms.BuildPacket();
+	if (TestEqual(TEXT("authentication and warm up calls"), packet->Num(), 3))
+	{
+		TestTrue(TEXT("authentication first"), &(*packet)[0].Get() == authentication);
+		for (int32 i = 1; i < packet->Num(); ++i)
+		{
+			TestTrue(FString::Printf(TEXT("warm up call %d"), i), (*packet)[i]->getIsWarmUp());
+			TestTrue(FString::Printf(TEXT("warm up call %d has no callback"), i), (*packet)[i]->getCallback() == nullptr);
+		}
+	}
+
+	// the byte limit leaves out the calls which don't fit
+	comms.SetMaxBundleBytes(authentication->getPayload().Num() + (*packet)[1]->getPayload().Num());
+	authentication = new ServerCall(ServiceName::AuthenticateV2, ServiceOperation::Authenticate, MakeShareable(new FJsonObject()));
+	comms.AddToQueue(authentication);
+	packet = comms.BuildPacket();
+	TestEqual(TEXT("warm up calls within the byte limit"), packet->Num(), 2);
+	return true;
+}
+
+#endif
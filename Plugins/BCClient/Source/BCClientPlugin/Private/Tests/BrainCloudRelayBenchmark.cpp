@@ -0,0 +1,113 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/Ticker.h"
+#include "BrainCloudClient.h"
+#include "BrainCloudRelay.h"
+#include "BCLocalRelayServer.h"
+#include "IServerCallback.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_BC_LOCAL_DISPATCHER
+
+namespace
+{
+	const uint32 BenchmarkPort = 9199;
+	const int32 BenchmarkMessages = 20000;
+	const int32 MessagesPerTick = 50;
+	const int32 MessageSize = 64;
+
+	class ConnectCallback : public IServerCallback
+	{
+	  public:
+		virtual void serverCallback(ServiceName serviceName, ServiceOperation serviceOperation, const FString &jsonData) override { IsConnected = true; }
+		virtual void serverError(ServiceName serviceName, ServiceOperation serviceOperation, int32 statusCode, int32 reasonCode, const FString &jsonError) override { IsFailed = true; }
+
+		bool IsConnected = false;
+		bool IsFailed = false;
+	};
+
+	// the relay server runs on the core ticker, the client's socket is serviced by its callbacks
+	void Pump(BrainCloudClient &client)
+	{
+		FTicker::GetCoreTicker().Tick(0.001f);
+		client.runCallbacks();
+		FPlatformProcess::Sleep(0.001f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBrainCloudRelaySendBenchmark, "BrainCloud.Benchmark.RelaySend", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FBrainCloudRelaySendBenchmark::RunTest(const FString &Parameters)
+{
+	BCLocalRelayServer server(BenchmarkPort);
+	if (!TestTrue(TEXT("relay server started"), server.Start()))
+		return false;
+
+	BrainCloudClient client;
+	client.initialize(TEXT("http://localhost/dispatcherv2"), TEXT("secret"), TEXT("10000"), TEXT("1.0.0"));
+	BrainCloudRelay *relay = client.getRelayService();
+
+	ConnectCallback callback;
+	relay->connect(BCRelayConnectionType::UDP, server.GetConnectOptionsJson(), &callback);
+	double deadline = FPlatformTime::Seconds() + 5.0;
+	while (!callback.IsConnected && !callback.IsFailed && FPlatformTime::Seconds() < deadline)
+		Pump(client);
+
+	if (!TestTrue(TEXT("relay connected"), callback.IsConnected))
+	{
+		server.Stop();
+		return false;
+	}
+
+	struct SendMode
+	{
+		const TCHAR *Name;
+		bool IsReliable;
+		bool IsBatched;
+	};
+
+	TArray<uint8> message;
+	message.SetNumZeroed(MessageSize);
+	for (const SendMode &mode : {SendMode{TEXT("unreliable"), false, false}, SendMode{TEXT("reliable"), true, false}, SendMode{TEXT("batched"), false, true}})
+	{
+		relay->enableSendBatching(mode.IsBatched);
+
+		// the first round warms the pool and containers up, the second is the one reported
+		double sendSeconds = 0.0;
+		int64 allocations = 0;
+		int64 allocatedBytes = 0;
+		for (int32 round = 0; round < 2; ++round)
+		{
+			int64 allocationsBefore = relay->getSendAllocationCount();
+			int64 bytesBefore = relay->getSendAllocatedBytes();
+
+			sendSeconds = 0.0;
+			for (int32 sent = 0; sent < BenchmarkMessages; sent += MessagesPerTick)
+			{
+				double start = FPlatformTime::Seconds();
+				for (int32 i = 0; i < MessagesPerTick; ++i)
+					relay->send(message, 0, mode.IsReliable, false, 0);
+				relay->flush();
+				sendSeconds += FPlatformTime::Seconds() - start;
+
+				// acks come back, and what was sent to ourselves is received
+				Pump(client);
+			}
+
+			allocations = relay->getSendAllocationCount() - allocationsBefore;
+			allocatedBytes = relay->getSendAllocatedBytes() - bytesBefore;
+		}
+
+		AddInfo(FString::Printf(TEXT("%s, %d byte messages: %.1f ns/message, %lld allocations (%lld bytes) for %d messages once warmed up"),
+			mode.Name, MessageSize, sendSeconds * 1e9 / BenchmarkMessages, allocations, allocatedBytes, BenchmarkMessages));
+		TestEqual(FString::Printf(TEXT("%s, steady state allocations"), mode.Name), allocations, (int64)0);
+	}
+
+	relay->disconnect();
+	Pump(client);
+	server.Stop();
+	return true;
+}
+
+#endif
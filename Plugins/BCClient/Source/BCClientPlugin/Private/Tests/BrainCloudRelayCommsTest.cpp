@@ -0,0 +1,173 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/Ticker.h"
+#include "BrainCloudClient.h"
+#include "BrainCloudRelay.h"
+#include "BCLocalRelayServer.h"
+#include "IServerCallback.h"
+#include "IRelayCallback.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_BC_LOCAL_DISPATCHER
+
+namespace
+{
+	const uint32 TestPort = 9198;
+
+	class ConnectCallback : public IServerCallback
+	{
+	  public:
+		virtual void serverCallback(ServiceName serviceName, ServiceOperation serviceOperation, const FString &jsonData) override { IsConnected = true; }
+		virtual void serverError(ServiceName serviceName, ServiceOperation serviceOperation, int32 statusCode, int32 reasonCode, const FString &jsonError) override { IsFailed = true; }
+
+		bool IsConnected = false;
+		bool IsFailed = false;
+	};
+
+	// every message carries its index, the order they arrive in is kept
+	class ReceivedMessages : public IRelayCallback
+	{
+	  public:
+		using IRelayCallback::relayCallback;
+
+		virtual void relayCallback(const TArray<uint8> &data) override
+		{
+			if (data.Num() == 4)
+				Indices.Add(((int32)data[0] << 24) | ((int32)data[1] << 16) | ((int32)data[2] << 8) | (int32)data[3]);
+		}
+
+		TArray<int32> Indices;
+	};
+
+	struct RelayPeer
+	{
+		RelayPeer(const FString &profileId)
+		{
+			Client.initialize(TEXT("http://localhost/dispatcherv2"), TEXT("secret"), TEXT("10000"), TEXT("1.0.0"));
+			Client.getAuthenticationService()->setProfileId(profileId);
+			Client.getRelayService()->registerDataCallback(&Received);
+		}
+
+		~RelayPeer()
+		{
+			Client.getRelayService()->deregisterDataCallback();
+		}
+
+		BrainCloudClient Client;
+		ConnectCallback Connection;
+		ReceivedMessages Received;
+	};
+
+	// the relay server runs on the core ticker, each client's socket is serviced by its callbacks
+	void Pump(const TArray<RelayPeer *> &peers)
+	{
+		FTicker::GetCoreTicker().Tick(0.001f);
+		for (RelayPeer *peer : peers)
+			peer->Client.runCallbacks();
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	template <typename ConditionType>
+	bool PumpUntil(const TArray<RelayPeer *> &peers, float seconds, ConditionType condition)
+	{
+		double deadline = FPlatformTime::Seconds() + seconds;
+		while (!condition())
+		{
+			if (FPlatformTime::Seconds() >= deadline)
+				return false;
+			Pump(peers);
+		}
+		return true;
+	}
+
+	bool Connect(RelayPeer &peer, const BCLocalRelayServer &server, const TArray<RelayPeer *> &peers)
+	{
+		peer.Client.getRelayService()->connect(BCRelayConnectionType::UDP, server.GetConnectOptionsJson(), &peer.Connection);
+		return PumpUntil(peers, 5.0f, [&peer]() { return peer.Connection.IsConnected || peer.Connection.IsFailed; }) && peer.Connection.IsConnected;
+	}
+
+	void SendIndices(RelayPeer &peer, int32 first, int32 count)
+	{
+		for (int32 i = first; i < first + count; ++i)
+		{
+			uint8 data[4] = {(uint8)(i >> 24), (uint8)(i >> 16), (uint8)(i >> 8), (uint8)i};
+			peer.Client.getRelayService()->sendToAll(data, 4, true, true, 0);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBrainCloudRelayOrderedTest, "BrainCloud.Relay.OrderedReliable", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBrainCloudRelayOrderedTest::RunTest(const FString &Parameters)
+{
+	BCLocalRelayServer server(TestPort);
+	if (!TestTrue(TEXT("relay server started"), server.Start()))
+		return false;
+
+	RelayPeer sender(TEXT("relay-test-sender"));
+	RelayPeer receiver(TEXT("relay-test-receiver"));
+	TArray<RelayPeer *> peers = {&sender, &receiver};
+
+	auto expectInOrder = [this, &receiver](const TCHAR *what, int32 first, int32 count)
+	{
+		TArray<int32> expected;
+		for (int32 i = first; i < first + count; ++i)
+			expected.Add(i);
+		TestTrue(FString::Printf(TEXT("%s, delivered once each and in order"), what), receiver.Received.Indices == expected);
+		receiver.Received.Indices.Reset();
+	};
+
+	if (!TestTrue(TEXT("sender connected"), Connect(sender, server, peers)))
+	{
+		server.Stop();
+		return false;
+	}
+
+	// the sender's packet ids have moved on before the receiver joins
+	const int32 sentBeforeJoin = 20;
+	SendIndices(sender, 0, sentBeforeJoin);
+	PumpUntil(peers, 1.0f, [&server]() { return server.GetReceivedRelays().Num() >= sentBeforeJoin; });
+
+	if (!TestTrue(TEXT("receiver connected"), Connect(receiver, server, peers)))
+	{
+		server.Stop();
+		return false;
+	}
+
+	// joining mid stream, the first packet seen starts the stream
+	int32 next = sentBeforeJoin;
+	SendIndices(sender, next, 10);
+	PumpUntil(peers, 2.0f, [&receiver]() { return receiver.Received.Indices.Num() >= 10; });
+	expectInOrder(TEXT("joined mid stream"), next, 10);
+	next += 10;
+
+	// lost datagrams leave gaps which resends fill, lost acks bring duplicates
+	server.SetSeed(21);
+	server.SetLossRate(0.2f);
+	int32 droppedBefore = server.GetDroppedCount();
+	SendIndices(sender, next, 40);
+	PumpUntil(peers, 8.0f, [&receiver]() { return receiver.Received.Indices.Num() >= 40; });
+	TestTrue(TEXT("datagrams were lost"), server.GetDroppedCount() > droppedBefore);
+	expectInOrder(TEXT("gaps and duplicates"), next, 40);
+	next += 40;
+
+	// with room for only two out of order packets the rest stay unacked until resent
+	receiver.Client.getRelayService()->setChannelLimits(0, 64, 2);
+	SendIndices(sender, next, 30);
+	PumpUntil(peers, 8.0f, [&receiver]() { return receiver.Received.Indices.Num() >= 30; });
+	expectInOrder(TEXT("full receive buffer"), next, 30);
+
+	// nothing was left unacked long enough to drop the connection
+	server.SetLossRate(0.0f);
+	Pump(peers);
+	TestTrue(TEXT("sender still connected"), sender.Client.getRelayService()->isConnected());
+
+	sender.Client.getRelayService()->disconnect();
+	receiver.Client.getRelayService()->disconnect();
+	Pump(peers);
+	server.Stop();
+	return true;
+}
+
+#endif
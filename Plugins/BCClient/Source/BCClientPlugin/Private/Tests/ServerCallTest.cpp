@@ -0,0 +1,68 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCClientPluginPrivatePCH.h"
+#include "Misc/AutomationTest.h"
+#include "ServerCall.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	FString PayloadToString(const ServerCall &servercall)
+	{
+		const TArray<uint8> &payload = servercall.getPayload();
+		FUTF8ToTCHAR converted(reinterpret_cast<const ANSICHAR *>(payload.GetData()), payload.Num());
+		return FString(converted.Length(), converted.Get());
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FServerCallSerializeTest, "BrainCloud.ServerCall.Serialize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FServerCallSerializeTest::RunTest(const FString &Parameters)
+{
+	TSharedRef<FJsonObject> data = MakeShareable(new FJsonObject());
+	data->SetStringField(TEXT("name"), TEXT("a \"quoted\" name"));
+	data->SetNumberField(TEXT("count"), 3);
+
+	ServerCall servercall(ServiceName::PlayerState, ServiceOperation::UpdateName, data);
+	servercall.serialize();
+
+	FString json = PayloadToString(servercall);
+	TSharedPtr<FJsonObject> parsed;
+	TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(json);
+	if (!TestTrue(TEXT("payload is valid json"), FJsonSerializer::Deserialize(reader, parsed) && parsed.IsValid()))
+		return false;
+
+	TestEqual(TEXT("service"), parsed->GetStringField(TEXT("service")), FString(ServiceName::PlayerState.getValue()));
+	TestEqual(TEXT("operation"), parsed->GetStringField(TEXT("operation")), FString(ServiceOperation::UpdateName.getValue()));
+	TestEqual(TEXT("data.name"), parsed->GetObjectField(TEXT("data"))->GetStringField(TEXT("name")), FString(TEXT("a \"quoted\" name")));
+	TestEqual(TEXT("data.count"), parsed->GetObjectField(TEXT("data"))->GetIntegerField(TEXT("count")), 3);
+
+	// a second serialize keeps the payload rather than writing an empty one
+	servercall.serialize();
+	TestEqual(TEXT("payload after a second serialize"), PayloadToString(servercall), json);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FServerCallNullDataTest, "BrainCloud.ServerCall.NullData", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FServerCallNullDataTest::RunTest(const FString &Parameters)
+{
+	// no data object and nothing serialized yet
+	ServerCall servercall(ServiceName::HeartBeat, ServiceOperation::Read, TArray<uint8>());
+	servercall.serialize();
+
+	FString json = PayloadToString(servercall);
+	TSharedPtr<FJsonObject> parsed;
+	TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(json);
+	if (!TestTrue(TEXT("payload is valid json"), FJsonSerializer::Deserialize(reader, parsed) && parsed.IsValid()))
+		return false;
+
+	const TSharedPtr<FJsonObject> *dataObject = nullptr;
+	TestTrue(TEXT("data is an object"), parsed->TryGetObjectField(TEXT("data"), dataObject));
+	if (dataObject != nullptr)
+		TestEqual(TEXT("data is empty"), (*dataObject)->Values.Num(), 0);
+	return true;
+}
+
+#endif
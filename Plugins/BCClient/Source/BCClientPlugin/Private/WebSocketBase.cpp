@@ -464,6 +464,7 @@ bool UWebSocketBase::SendText(const FString &data)
 
 	if (mlws != nullptr)
 	{
+		FScopeLock Lock(&mSendMutex);
 		mSendQueue.Add(data);
 		bSentMessage = true;
 	}
@@ -476,16 +477,21 @@ bool UWebSocketBase::SendText(const FString &data)
 }
 
 bool UWebSocketBase::SendData(const TArray<uint8> &data)
+{
+	return SendData(data.GetData(), data.Num());
+}
+
+bool UWebSocketBase::SendData(const uint8 *data, int32 size)
 {
 	bool bSentMessage = false;
-	int sizeOfData = data.Num();
+	int sizeOfData = size;
 #if PLATFORM_UWP
 	bSentMessage = true;
-	SendAsyncData(data.GetData()).then([this]() {
+	SendAsyncData(const_cast<uint8 *>(data)).then([this]() {
 	});
 	#if ENGINE_MAJOR_VERSION <= 4 && ENGINE_MINOR_VERSION <24
 #if PLATFORM_HTML5
-	FString parsedMessage = BrainCloudRelay::BCBytesToString(data.GetData(), data.Num());
+	FString parsedMessage = BrainCloudRelay::BCBytesToString(data, size);
 	std::string strData = TCHAR_TO_ANSI(*parsedMessage);
 	SocketSend(mWebSocketRef, strData.c_str(), (int)strData.size());
 	bSentMessage = true;
@@ -500,7 +506,9 @@ bool UWebSocketBase::SendData(const TArray<uint8> &data)
 
 	if (mlws != nullptr)
 	{
-		mSendQueueData.Add(data);
+		FScopeLock Lock(&mSendMutex);
+		mSendQueueData.Append(data, size);
+		mSendQueueDataSizes.Add(size);
 		bSentMessage = true;
 	}
 	else
@@ -519,15 +527,21 @@ void UWebSocketBase::ProcessWriteable()
 #endif
 #endif
 #else
+	FScopeLock Lock(&mSendMutex);
+
 	// write data
 	int location = LWS_PRE;
 	int sizeOfData  = 0;
+
+	// allocated once and kept, lws needs LWS_PRE bytes of its own in front
+	if (mWriteBuffer.Num() == 0)
+		mWriteBuffer.SetNumUninitialized(LWS_PRE + MAX_ECHO_PAYLOAD);
+	unsigned char *buf = mWriteBuffer.GetData();
 	
 	// default to write text, these are RTT type messages
 	// for the most part
 	if (mSendQueue.Num() > 0)
 	{
-		unsigned char *buf = (unsigned char*)FMemory::Malloc(LWS_PRE + MAX_ECHO_PAYLOAD);
 		while (mSendQueue.Num() > 0)
 		{
 			std::string strData = TCHAR_TO_ANSI(*mSendQueue[0]);
@@ -547,23 +561,28 @@ void UWebSocketBase::ProcessWriteable()
 	} 
 	// then try writing Data stream, these are Relay Requests
 	// since binary is the most optimal data sending type
-	else if (mSendQueueData.Num() > 0)
+	else if (mSendQueueDataSizes.Num() > 0)
 	{
-		unsigned char *buf = (unsigned char*)FMemory::Malloc(LWS_PRE + MAX_ECHO_PAYLOAD);
-		while (mSendQueueData.Num() > 0)
+		int32 messageCount = 0;
+		int32 offset = 0;
+		while (messageCount < mSendQueueDataSizes.Num())
 		{
-			uint8 *data = mSendQueueData[0].GetData();
-			sizeOfData = mSendQueueData[0].Num();
+			sizeOfData = mSendQueueDataSizes[messageCount];
 			
 			// we are about to go over the max send size, 
 			// keep them in the queue for later, stop processing
 			if (location + sizeOfData > MAX_ECHO_PAYLOAD)
 				break;
 
-			FMemory::Memcpy(&buf[location], data, sizeOfData);
+			FMemory::Memcpy(&buf[location], mSendQueueData.GetData() + offset, sizeOfData);
 			location += sizeOfData;
-			mSendQueueData.RemoveAt(0);	
+			offset += sizeOfData;
+			++messageCount;
 		}
+
+		// what was written comes off the front, keeping the allocations
+		mSendQueueData.RemoveAt(0, offset, false);
+		mSendQueueDataSizes.RemoveAt(0, messageCount, false);
 		lws_write(mlws, &buf[LWS_PRE], location - LWS_PRE, LWS_WRITE_BINARY);
 	} 
 #endif
@@ -571,17 +590,14 @@ void UWebSocketBase::ProcessWriteable()
 
 void UWebSocketBase::ProcessRead(const char *in, int len)
 {
-	TArray<uint8> dataArray;
-	int count = len;
-	while (count)
-	{
-		dataArray.Add(uint8(*in));
+	OnReceiveBytes.Broadcast(reinterpret_cast<const uint8 *>(in), len);
 
-		++in;
-		--count;
+	// only copied when someone wants an array of their own
+	if (OnReceiveData.IsBound())
+	{
+		TArray<uint8> dataArray(reinterpret_cast<const uint8 *>(in), len);
+		OnReceiveData.Broadcast(dataArray);
 	}
-
-	OnReceiveData.Broadcast(dataArray);
 }
 
 bool UWebSocketBase::ProcessHeader(unsigned char **p, unsigned char *end)
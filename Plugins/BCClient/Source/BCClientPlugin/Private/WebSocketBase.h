@@ -32,6 +32,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FWebSocketConnectError, const FStrin
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FWebSocketClosed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FWebSocketConnected);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FWebSocketRecieve, TArray<uint8>, data);
+// the received bytes where they sit, only valid during the broadcast
+DECLARE_MULTICAST_DELEGATE_TwoParams(FWebSocketReceiveBytes, const uint8 *, int32);
 
 #if PLATFORM_UWP
 #include <collection.h>
@@ -124,6 +126,7 @@ class BCCLIENTPLUGIN_API UWebSocketBase : public UObject
 
 	//UFUNCTION(BlueprintCallable, Category = WebSocket)
 	bool SendData(const TArray<uint8> &data);
+	bool SendData(const uint8 *data, int32 size);
 
 	UFUNCTION(BlueprintCallable, Category = WebSocket)
 	void Close();
@@ -142,6 +145,8 @@ class BCCLIENTPLUGIN_API UWebSocketBase : public UObject
 	UPROPERTY(BlueprintAssignable, Category = WebSocket)
 	FWebSocketRecieve OnReceiveData;
 
+	FWebSocketReceiveBytes OnReceiveBytes;
+
 	void Cleanlws();
 	void ProcessWriteable();
 	void ProcessRead(const char *in, int len);
@@ -164,7 +169,12 @@ class BCCLIENTPLUGIN_API UWebSocketBase : public UObject
 	struct lws *mlws;
 #endif
 
+	// sends may be queued from the game thread while the socket is serviced on the network thread
+	FCriticalSection mSendMutex;
 	TArray<FString> mSendQueue;
-	TArray<TArray<uint8>> mSendQueueData;
+	// binary messages back to back, with the size of each, reused from write to write
+	TArray<uint8> mSendQueueData;
+	TArray<int32> mSendQueueDataSizes;
+	TArray<uint8> mWriteBuffer;
 	TMap<FString, FString> mHeaderMap;
 };
@@ -20,8 +20,21 @@ class UBCBlueprintRelayCallProxyBase : public UObject, public IRelayCallback
     FBrainCloudRelayCallbackDelegate OnRelayCallback;
 
     //callbacks
+    using IRelayCallback::relayCallback;
+
     void relayCallback(const TArray<uint8>& in_data)
     {
         OnRelayCallback.Broadcast(in_data);
     }
+
+    void relayCallback(const uint8 *in_data, int32 in_size)
+    {
+        // blueprints need an array, this one is reused from packet to packet
+        m_receivedData.Reset();
+        m_receivedData.Append(in_data, in_size);
+        OnRelayCallback.Broadcast(m_receivedData);
+    }
+
+  private:
+    TArray<uint8> m_receivedData;
 };
@@ -0,0 +1,102 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Latency histogram with power of two millisecond buckets, the first bucket
+ * holds everything under 1ms and the last everything over ~16s.
+ */
+struct BCCLIENTPLUGIN_API BCLatencyHistogram
+{
+	static const int32 NumBuckets = 16;
+
+	uint32 Buckets[NumBuckets] = {};
+	uint32 Count = 0;
+	double TotalSeconds = 0.0;
+	double MaxSeconds = 0.0;
+
+	void Add(double seconds);
+	void Merge(const BCLatencyHistogram &other);
+	double GetAverage() const { return Count > 0 ? TotalSeconds / Count : 0.0; }
+
+	// upper bound of the bucket the percentile falls in, ie. 0.99 for p99
+	double GetPercentile(double percentile) const;
+
+	// upper bound in seconds of a bucket
+	static double GetBucketLimit(int32 bucket);
+};
+
+/**
+ * What was seen for one service / operation pair.
+ */
+struct BCCLIENTPLUGIN_API BCOperationMetrics
+{
+	FString Service;
+	FString Operation;
+
+	uint32 Calls = 0;
+	uint32 Errors = 0;
+	uint32 Retries = 0;
+	uint64 RequestBytes = 0;
+	uint64 ResponseBytes = 0;
+
+	// queued until its bundle was sent
+	BCLatencyHistogram QueueLatency;
+	// bundle sent until its response arrived
+	BCLatencyHistogram ServerLatency;
+	// response arrived until the callback had run
+	BCLatencyHistogram CallbackLatency;
+
+	// adds in the metrics of the same operation from another client
+	void Merge(const BCOperationMetrics &other);
+};
+
+/**
+ * Totals over every bundle sent.
+ */
+struct BCCLIENTPLUGIN_API BCBundleMetrics
+{
+	uint32 BundlesSent = 0;
+	// bundles sent again after a timeout or failure, each resend counts once
+	uint32 BundlesRetried = 0;
+	uint32 MessagesSent = 0;
+	uint64 RequestBytes = 0;
+	uint64 ResponseBytes = 0;
+	// sum of messages / max bundle messages, divide by BundlesSent for the average
+	double TotalFillRatio = 0.0;
+
+	double GetAverageFillRatio() const { return BundlesSent > 0 ? TotalFillRatio / BundlesSent : 0.0; }
+};
+
+/**
+ * Collects the comms metrics. Everything is recorded under a lock as the
+ * send and receive side may run on the comms thread, see
+ * BrainCloudClient::SINGLE_THREADED. Totals are also published to the
+ * BrainCloud stat group and the csv profiler.
+ */
+class BCCLIENTPLUGIN_API BCCommsMetrics
+{
+  public:
+	void SetEnabled(bool enabled) { _isEnabled = enabled; }
+	bool IsEnabled() const { return _isEnabled; }
+	void Reset();
+
+	void RecordBundleSent(int32 messageCount, int32 maxMessages, int32 bodyBytes);
+	void RecordSent(const FString &service, const FString &operation, double queueSeconds, int32 requestBytes);
+	void RecordBundleRetry();
+	void RecordRetry(const FString &service, const FString &operation);
+	void RecordResponse(const FString &service, const FString &operation, double serverSeconds, int32 responseBytes);
+	void RecordCallback(const FString &service, const FString &operation, double callbackSeconds, bool isError);
+
+	TArray<BCOperationMetrics> GetOperationMetrics();
+	BCBundleMetrics GetBundleMetrics();
+	FString ToJsonString();
+
+  private:
+	BCOperationMetrics &FindOrAdd(const FString &service, const FString &operation);
+
+	bool _isEnabled = false;
+	FCriticalSection _mutex;
+	TMap<FString, BCOperationMetrics> _operations;
+	BCBundleMetrics _bundles;
+};
@@ -0,0 +1,19 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * FNV-1a hash of an identifier string, usable at compile time so that
+ * ServiceName, ServiceOperation and OperationParam constants need no
+ * static initialization and compare as integers.
+ */
+constexpr uint32 BCHashIdentifier(const TCHAR *value)
+{
+	uint32 hash = 2166136261u;
+	for (; *value != 0; ++value)
+	{
+		hash ^= (uint32)*value;
+		hash *= 16777619u;
+	}
+	return hash;
+}
@@ -0,0 +1,142 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#if WITH_BC_LOCAL_DISPATCHER
+
+#include "ServiceName.h"
+#include "ServiceOperation.h"
+#include "Math/RandomStream.h"
+#include "HttpRouteHandle.h"
+#include "HttpResultCallback.h"
+
+class IHttpRouter;
+struct FHttpServerRequest;
+
+/**
+ * What the local dispatcher answers a single message with.
+ */
+struct BCCLIENTPLUGIN_API BCLocalResponse
+{
+	int32 Status = 200;
+	int32 ReasonCode = 0;
+	FString StatusMessage;
+	// json object returned as the data of a successful response
+	FString Data = TEXT("{}");
+
+	static BCLocalResponse Success(const FString &data) { BCLocalResponse response; response.Data = data; return response; }
+	static BCLocalResponse Error(int32 status, int32 reasonCode, const FString &statusMessage);
+};
+
+typedef TFunction<BCLocalResponse(const FString &service, const FString &operation, const TSharedPtr<FJsonObject> &data)> BCLocalHandler;
+
+/**
+ * A stand-in for the brainCloud dispatcher served on localhost, so the
+ * client can be exercised and measured without a network.
+ *
+ * Serves /dispatcherv2 and /uploader with the same bundle format as the
+ * server: the X-SIG header is checked against the app secret, every
+ * bundle is answered with its packetId and a resent packetId gets the
+ * response it was answered with the first time. Authentication hands out a
+ * session which the other calls must carry.
+ *
+ * Messages are answered from, in order, responses queued with
+ * QueueResponse, a handler set with SetHandler, a response set with
+ * SetResponse, and otherwise an empty success. Latency and lost responses
+ * are drawn from a seeded random stream so a run can be repeated exactly.
+ *
+ * Only built outside of shipping on desktop platforms, see
+ * WITH_BC_LOCAL_DISPATCHER. Runs on the game thread, which must be ticking
+ * for requests to be answered.
+ *
+ *	BCLocalDispatcher dispatcher(8099, TEXT("secret"));
+ *	dispatcher.Start();
+ *	client->initialize(dispatcher.GetServerUrl(), TEXT("secret"), TEXT("10000"), TEXT("1.0.0"));
+ */
+class BCCLIENTPLUGIN_API BCLocalDispatcher
+{
+  public:
+	struct ReceivedCall
+	{
+		uint64 PacketId = 0;
+		FString Service;
+		FString Operation;
+		TSharedPtr<FJsonObject> Data;
+	};
+
+	BCLocalDispatcher(uint32 port, const FString &secretKey);
+	~BCLocalDispatcher();
+
+	bool Start();
+	void Stop();
+	bool IsRunning() const { return _router.IsValid(); }
+
+	// the url to initialize the client with
+	FString GetServerUrl() const;
+
+	void SetResponse(ServiceName service, ServiceOperation operation, const BCLocalResponse &response);
+	void SetHandler(ServiceName service, ServiceOperation operation, BCLocalHandler handler);
+
+	// answers the next call to the operation only, queued responses are used in order
+	void QueueResponse(ServiceName service, ServiceOperation operation, const BCLocalResponse &response);
+	void ClearResponses();
+
+	// every bundle is answered after a delay drawn between the two
+	void SetLatency(float minSeconds, float maxSeconds);
+
+	// the fraction of bundles, 0 to 1, which are never answered so the client times out
+	void SetLossRate(float lossRate) { _lossRate = lossRate; }
+
+	// http status returned for whole bundles instead of answering them, 0 to answer normally
+	void SetBundleStatus(int32 statusCode) { _bundleStatus = statusCode; }
+	void SetSeed(int32 seed) { _random.Initialize(seed); }
+
+	const TArray<ReceivedCall> &GetReceivedCalls() const { return _receivedCalls; }
+	int32 GetBundleCount() const { return _bundleCount; }
+	int32 GetDroppedCount() const { return _droppedCount; }
+	int32 GetUploadCount() const { return _uploadCount; }
+	int64 GetUploadBytes() const { return _uploadBytes; }
+	void ClearReceived();
+
+  private:
+	bool HandleBundle(const FHttpServerRequest &request, const FHttpResultCallback &onComplete);
+	bool HandleUpload(const FHttpServerRequest &request, const FHttpResultCallback &onComplete);
+	FString AnswerBundle(const FString &body);
+	BCLocalResponse AnswerMessage(const FString &service, const FString &operation, const TSharedPtr<FJsonObject> &data);
+	bool IsSignatureValid(const FHttpServerRequest &request) const;
+	void Respond(const FHttpResultCallback &onComplete, int32 statusCode, const FString &body);
+
+	static FString MakeKey(const FString &service, const FString &operation) { return service + TEXT(".") + operation; }
+
+	uint32 _port;
+	FString _secretKey;
+	TSharedPtr<IHttpRouter> _router;
+	TArray<FHttpRouteHandle> _routes;
+
+	TMap<FString, BCLocalResponse> _responses;
+	TMap<FString, BCLocalHandler> _handlers;
+	TMap<FString, TArray<BCLocalResponse>> _queuedResponses;
+
+	float _minLatency = 0.0f;
+	float _maxLatency = 0.0f;
+	float _lossRate = 0.0f;
+	int32 _bundleStatus = 0;
+	FRandomStream _random;
+
+	FString _sessionId;
+	int32 _nextSession = 1;
+	// answers by session and packetId so a retried bundle gets the same response,
+	// the client starts its packetIds over with every session
+	TMap<TPair<FString, uint64>, FString> _answeredPackets;
+
+	// set false on Stop, delayed responses check it before completing
+	TSharedRef<bool, ESPMode::ThreadSafe> _alive;
+
+	TArray<ReceivedCall> _receivedCalls;
+	int32 _bundleCount = 0;
+	int32 _droppedCount = 0;
+	int32 _uploadCount = 0;
+	int64 _uploadBytes = 0;
+};
+
+#endif
@@ -0,0 +1,119 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#if WITH_BC_LOCAL_DISPATCHER
+
+#include "Math/RandomStream.h"
+#include "Containers/Ticker.h"
+
+class FSocket;
+class FInternetAddr;
+
+/**
+ * A stand-in for the brainCloud relay server over udp on localhost, so the
+ * relay comms can be exercised and measured without a lobby.
+ *
+ * Answers connect requests with a CONNECT system message and a net id,
+ * pings with pongs carrying its utc clock and acks reliable relay packets. Relay packets are
+ * forwarded to every connected client in their player mask, the sender
+ * included. System messages are resent until they are acked. Datagrams in
+ * either direction can be delayed or dropped, drawn from a seeded random
+ * stream so a run can be repeated exactly.
+ *
+ * Built along with BCLocalDispatcher, see WITH_BC_LOCAL_DISPATCHER. Runs on
+ * the core ticker, so the game thread must be ticking.
+ *
+ *	BCLocalRelayServer relayServer(9099);
+ *	relayServer.Start();
+ *	client->getRelayService()->connect(BCRelayConnectionType::UDP, relayServer.GetConnectOptionsJson(), callback);
+ */
+class BCCLIENTPLUGIN_API BCLocalRelayServer
+{
+  public:
+	struct ReceivedRelay
+	{
+		int32 NetId = 0;
+		uint16 ReliableHeader = 0;
+		// as the client packed it, see BrainCloudRelayComms::sendRelay
+		uint64 PlayerMask = 0;
+		TArray<uint8> Data;
+	};
+
+	BCLocalRelayServer(uint32 port);
+	~BCLocalRelayServer();
+
+	bool Start();
+	void Stop();
+	bool IsRunning() const { return _socket != nullptr; }
+
+	// the options to connect the relay with
+	FString GetConnectOptionsJson() const;
+
+	// every datagram is delayed by a time drawn between the two
+	void SetLatency(float minSeconds, float maxSeconds);
+
+	// the fraction of datagrams, 0 to 1, dropped in each direction
+	void SetLossRate(float lossRate) { _lossRate = lossRate; }
+	void SetSeed(int32 seed) { _random.Initialize(seed); }
+
+	const TArray<ReceivedRelay> &GetReceivedRelays() const { return _receivedRelays; }
+	int32 GetConnectedCount() const { return _peers.Num(); }
+	int32 GetPingCount() const { return _pingCount; }
+	int32 GetAckCount() const { return _ackCount; }
+	int32 GetDroppedCount() const { return _droppedCount; }
+	void ClearReceived();
+
+  private:
+	struct Peer
+	{
+		Peer(TSharedRef<FInternetAddr> addr) : Addr(addr) {}
+
+		TSharedRef<FInternetAddr> Addr;
+		int32 NetId = 0;
+		FString ProfileId;
+		uint16 NextRSMGId = 0;
+		// system messages not yet acked, by rsmg packet id
+		TMap<uint16, TArray<uint8>> UnackedRSMG;
+	};
+
+	struct DelayedDatagram
+	{
+		DelayedDatagram(double sendTime, TSharedRef<FInternetAddr> addr, TArray<uint8> &&data) : SendTime(sendTime), Addr(addr), Data(MoveTemp(data)) {}
+
+		double SendTime;
+		TSharedRef<FInternetAddr> Addr;
+		TArray<uint8> Data;
+	};
+
+	bool Tick(float deltaTime);
+	void HandleDatagram(const TSharedRef<FInternetAddr> &from, const uint8 *data, int32 size);
+	void HandleConnect(const TSharedRef<FInternetAddr> &from, const uint8 *payload, int32 size);
+	void HandleRelay(Peer &sender, const uint8 *payload, int32 size);
+	void SendRSMG(Peer &peer, const FString &json);
+	void Send(const TSharedRef<FInternetAddr> &to, uint8 controlByte, const uint8 *payload, int32 size);
+	void SendNow(const FInternetAddr &to, const TArray<uint8> &datagram);
+	Peer *FindPeer(const FInternetAddr &addr);
+	bool ShouldDrop();
+
+	uint32 _port;
+	FSocket *_socket = nullptr;
+	FDelegateHandle _tickHandle;
+	TArray<uint8> _recvBuffer;
+
+	TArray<Peer> _peers;
+	TArray<DelayedDatagram> _delayed;
+	double _lastResendTime = 0.0;
+
+	float _minLatency = 0.0f;
+	float _maxLatency = 0.0f;
+	float _lossRate = 0.0f;
+	FRandomStream _random;
+
+	TArray<ReceivedRelay> _receivedRelays;
+	int32 _pingCount = 0;
+	int32 _ackCount = 0;
+	int32 _droppedCount = 0;
+};
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "BCRelayStats.generated.h"
+
+/**
+ * Connection quality of the relay, see BrainCloudRelay::getStats.
+ *
+ * Round trips come from the relay pings, so they are refreshed once per ping
+ * interval. Rates and loss cover roughly the last second.
+ */
+USTRUCT(BlueprintType, Category = "BrainCloud")
+struct FBC_RelayStats
+{
+    GENERATED_USTRUCT_BODY()
+
+    // smoothed round trip, in milliseconds
+    UPROPERTY(BlueprintReadOnly)
+    float SmoothedRtt = 0.0f;
+
+    // mean deviation of the round trip from SmoothedRtt, in milliseconds
+    UPROPERTY(BlueprintReadOnly)
+    float RttVariance = 0.0f;
+
+    // mean difference between consecutive round trips, in milliseconds
+    UPROPERTY(BlueprintReadOnly)
+    float Jitter = 0.0f;
+
+    // 0 to 1, from unanswered pings and gaps in the packet ids received over udp
+    UPROPERTY(BlueprintReadOnly)
+    float LossRate = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float BytesSentPerSecond = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float BytesReceivedPerSecond = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float PacketsSentPerSecond = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float PacketsReceivedPerSecond = 0.0f;
+
+    // server clock minus the local utc clock, in milliseconds, when HasClockOffset
+    UPROPERTY(BlueprintReadOnly)
+    float ClockOffset = 0.0f;
+
+    // only when the relay server puts its clock in its pongs
+    UPROPERTY(BlueprintReadOnly)
+    bool HasClockOffset = false;
+};
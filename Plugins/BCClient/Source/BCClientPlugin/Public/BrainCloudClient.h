@@ -43,10 +43,15 @@
 #include "BrainCloudAppStore.h"
 #include "BrainCloudRelay.h"
 #include "BrainCloudTimeUtils.h"
+#include "ServiceName.h"
+#include "ServiceOperation.h"
+#include "ServerCall.h"
+#include "BCCommsMetrics.h"
 
 class BrainCloudComms;
 class BrainCloudRTTComms;
 class BrainCloudRelayComms;
+class BCCommsThread;
 class ServerCall;
 class IEventCallback;
 class IRewardCallback;
@@ -105,6 +110,13 @@ class BCCLIENTPLUGIN_API BrainCloudClient
 
   public:
 	/** Public constants */
+
+	/**
+	* When false, initialize() starts a worker thread which builds, sends and
+	* parses requests and services the rtt and relay sockets. Callbacks are
+	* still only invoked from runCallbacks. Must be set before initialize.
+	* Defaults to true.
+	*/
 	static bool SINGLE_THREADED;
 
 	BrainCloudClient();
@@ -404,6 +416,77 @@ class BCCLIENTPLUGIN_API BrainCloudClient
 	*/
 	void setErrorCallbackOn202Status(bool isError);
 
+	/**
+	* Sets how many request bundles may be waiting on the server at the same
+	* time. With the default of 1 a bundle is only sent once the previous one
+	* has been fully reported. Larger values let new bundles go out while a
+	* slow call is still outstanding; callbacks are still run in the order the
+	* bundles were sent. Authentication is never pipelined.
+	*
+	* @param maxPacketsInFlight The number of outstanding bundles, minimum 1
+	*/
+	void setMaxPacketsInFlight(int32 maxPacketsInFlight);
+
+	/**
+	* Derives request timeouts from the measured round trip time to the
+	* server instead of the fixed packet timeout table, which then only acts
+	* as the upper limit. Retries wait a randomized, growing delay so clients
+	* don't all retry together after an outage. Authentication keeps using
+	* the authentication packet timeout. Off by default.
+	*
+	* @param enabled True to use adaptive timeouts
+	*/
+	void enableAdaptiveTimeouts(bool enabled);
+
+	/**
+	* Holds queued calls back for a short while so calls made over several
+	* frames go out as one bundle. A bundle is sent as soon as either limit
+	* is reached, when it is full (see setMaxBundleBytes and the app's max
+	* bundle messages), or when insertEndOfMessageBundleMarker closes it.
+	* Authentication is never held back. Both limits default to 0, which
+	* sends queued calls right away.
+	*
+	* @param seconds How long the oldest queued call may wait
+	* @param frames How many frames the oldest queued call may wait
+	*/
+	void setBundleWindow(float seconds, int32 frames = 0);
+
+	/**
+	* Caps the size of the messages in a bundle, a single larger message is
+	* still sent on its own. 0, the default, means no cap.
+	*
+	* @param maxBundleBytes The most serialized message bytes per bundle
+	*/
+	void setMaxBundleBytes(int32 maxBundleBytes);
+
+	/**
+	* Sets the lane calls to a service are queued in. Bundles are filled
+	* from CRITICAL calls first, then INTERACTIVE, then BACKGROUND.
+	* Authentication is always CRITICAL. By default authentication and
+	* heartbeat are CRITICAL, data stream is BACKGROUND and everything else
+	* is INTERACTIVE.
+	*
+	* @param serviceName The service to set the priority of
+	* @param priority The lane for calls to the service
+	*/
+	void setServicePriority(ServiceName serviceName, eBCCallPriority priority);
+
+	/**
+	* BACKGROUND calls which have been queued longer than this are bundled
+	* ahead of INTERACTIVE ones, so a steady stream of interactive calls can't
+	* hold them back forever. Defaults to 5 seconds, 0 turns this off.
+	*
+	* @param seconds The most a background call should wait
+	*/
+	void setBackgroundMaxAge(float seconds);
+
+	/**
+	* Returns the number of request bundles which may be outstanding at once
+	*
+	* @returns The size of the in flight window
+	*/
+	int32 getMaxPacketsInFlight();
+
 	/**
 	* Returns the low transfer rate timeout in secs
 	*
@@ -440,6 +523,32 @@ class BCCLIENTPLUGIN_API BrainCloudClient
 	*/
 	void setUploadLowTransferRateThreshold(int32 bytesPerSec);
 
+	/**
+	* Sets how many file uploads may run at once, the others wait their turn
+	* in the order they were prepared. By default this is 0, no limit.
+	*
+	* @param maxUploads The most uploads running at once
+	*/
+	void setMaxConcurrentUploads(int32 maxUploads);
+
+	/**
+	* Sets the upload rate, across all uploads, above which no more uploads
+	* are started. Uploads already running are not slowed down, so use it
+	* along with setMaxConcurrentUploads. By default this is 0, no limit.
+	*
+	* @param bytesPerSec The upload rate limit in bytes/sec
+	*/
+	void setUploadMaxBytesPerSecond(int32 bytesPerSec);
+
+	/**
+	* Sets how many times an upload which failed on the network or timed
+	* out is sent again before the failure is reported. Uploads are sent
+	* again from the start. By default this is 2.
+	*
+	* @param maxRetries The number of retries
+	*/
+	void setUploadMaxRetries(int32 maxRetries);
+
 	/**
 	* Enables the message caching upon network error, which is disabled by default.
 	* Once enabled, if a client side network error is encountered
@@ -484,6 +593,155 @@ class BCCLIENTPLUGIN_API BrainCloudClient
 	*/
 	void flushCachedMessages(bool sendApiErrorCallbacks);
 
+	/**
+	* Keeps calls registered with addDurableOperation in a journal on disk
+	* until the server has answered them. Calls which are still unanswered
+	* when the app is closed, or which are dropped by resetCommunication or a
+	* network error, are sent again in their original order the next time the
+	* same profile authenticates. Replayed calls have no callback.
+	*
+	* Calls dumped by flushCachedMessages are removed from the journal.
+	*
+	* @param enabled True to journal durable calls
+	*/
+	void enableOfflineJournal(bool enabled);
+
+	/**
+	* Marks a service operation as durable, see enableOfflineJournal.
+	*
+	* @param serviceName The service of the call
+	* @param serviceOperation The operation of the call
+	*/
+	void addDurableOperation(ServiceName serviceName, ServiceOperation serviceOperation);
+
+	/**
+	* Sets the most the offline journal will hold, durable calls beyond it
+	* are still sent but are not journaled. Defaults to 1MB.
+	*
+	* @param maxBytes The size limit of the journal
+	*/
+	void setOfflineJournalMaxSize(int32 maxBytes);
+
+	/**
+	* Records, per service and operation, how long calls wait in the queue,
+	* for the server and for their callback, along with the bytes sent and
+	* received, retries and errors. Bundle totals are also published to the
+	* "stat BrainCloud" group and the csv profiler. Off by default.
+	*
+	* @param enabled True to record metrics
+	*/
+	void enableMetrics(bool enabled);
+
+	/**
+	* Returns what has been recorded for each service and operation
+	* since metrics were enabled or last reset.
+	*/
+	TArray<BCOperationMetrics> getOperationMetrics();
+
+	/**
+	* Returns the totals of the bundles sent since metrics were enabled
+	* or last reset.
+	*/
+	BCBundleMetrics getBundleMetrics();
+
+	/**
+	* Returns the recorded metrics as a json string, with the p50, p90 and
+	* p99 latencies of each operation in milliseconds.
+	*/
+	FString getMetricsJson();
+
+	/**
+	* Clears the recorded metrics.
+	*/
+	void resetMetrics();
+
+	/**
+	* Writes every request bundle sent, with its headers, and the response
+	* it got back, with timings, to a file. The capture can be fed back with
+	* startPacketReplay. Replaces any capture already running. Signatures,
+	* credentials and session and profile ids are redacted, a replayed
+	* authentication hands out REDACTED as both.
+	*
+	* @param path The file to write the capture to
+	* @returns False if the file could not be created
+	*/
+	bool startPacketCapture(const FString &path);
+
+	/**
+	* Stops the running capture and closes its file.
+	*/
+	void stopPacketCapture();
+
+	/**
+	* Answers the bundles sent with the responses of a capture, in the
+	* order they were captured, instead of sending them to the server. The
+	* calls must be made in the same order as when the capture was taken.
+	*
+	* @param path The file written by startPacketCapture
+	* @param speed How much faster than captured the responses come back,
+	* 0 answers every bundle on the next update
+	* @returns False if the capture could not be read
+	*/
+	bool startPacketReplay(const FString &path, float speed = 1.0f);
+
+	/**
+	* Stops the replay, bundles go to the server again.
+	*/
+	void stopPacketReplay();
+
+	/**
+	* Starts recording warm up calls. Until endWarmUpCalls, the service calls
+	* made are not sent but kept, and a copy of each is sent after every
+	* authentication in the same bundle, saving the round trips of the calls
+	* made on every login. Only the service, operation and data of each call
+	* are kept, the callbacks given with them are never called. Responses go
+	* to the callback set with registerWarmUpCallback and, when cached, to
+	* getWarmUpResponse. Calls past the bundle's message or byte limit are
+	* left out.
+	*
+	* Only the calls made from the thread which began recording are
+	* recorded, calls from other threads and the heartbeat are sent as
+	* usual. Calls should be recorded from the game thread, before
+	* authenticating.
+	*
+	* @param cacheResponses True to keep the latest response of each warm up
+	* call, see getWarmUpResponse
+	*/
+	void beginWarmUpCalls(bool cacheResponses = false);
+
+	/**
+	* Stops recording warm up calls, service calls are sent again.
+	*/
+	void endWarmUpCalls();
+
+	/**
+	* Removes the recorded warm up calls and their cached responses.
+	*/
+	void clearWarmUpCalls();
+
+	/**
+	* Sets the callback the responses to warm up calls go to. It must stay
+	* valid until deregistered, for as long as authentications can be sent.
+	*
+	* @param callback The callback handler, its serverCallback and serverError
+	* are called with the service and operation of each warm up call
+	*/
+	void registerWarmUpCallback(IServerCallback *callback);
+
+	/**
+	* Deregisters the warm up callback.
+	*/
+	void deregisterWarmUpCallback();
+
+	/**
+	* Returns the latest response to a warm up call, empty if none has been
+	* received or responses are not cached.
+	*
+	* @param serviceName The service of the call
+	* @param serviceOperation The operation of the call
+	*/
+	FString getWarmUpResponse(ServiceName serviceName, ServiceOperation serviceOperation);
+
 	/**
 	* Inserts a marker which will tell the brainCloud comms layer
 	* to close the message bundle off at this point. Any messages queued
@@ -566,6 +824,11 @@ class BCCLIENTPLUGIN_API BrainCloudClient
 
 	BrainCloudTimeUtils *_brainCloudTimeUtils = nullptr;
 
+	friend class BCCommsThread;
+	bool _isCommsThreaded = false;
+	void startCommsThread();
+	void stopCommsThread();
+
 	static FString s_brainCloudClientVersion;
 
 	FString _appId = "";
@@ -1,6 +1,7 @@
 // Copyright 2018 bitHeads, Inc. All Rights Reserved.
 
 #pragma once
+#include "BCRelayStats.h"
 enum class BCRelayConnectionType : uint8;
 class BrainCloudClient;
 class BrainCloudRelayComms;
@@ -40,7 +41,7 @@ public:
 	/** 
  	* Start off a connection, based off connection type to brainClouds Relay Servers.  
 	* Connect options come in from "ROOM_ASSIGNED" | "ROOM_READY" lobby callback
-	* @param in_connectionType 
+	* @param in_connectionType WEBSOCKET or UDP, TCP is not supported yet
     * @param in_options
     * 	     in_options["ssl"] = false;
     * 	     in_options["host"] = "168.0.1.192";
@@ -84,6 +85,19 @@ public:
  	*/
 	void send(const TArray<uint8> &in_data, const uint64 in_target, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
 
+	/**
+	* Send bytes from any buffer, without building an array of them first.
+	* The bytes are copied once into a pooled packet, so the buffer can be
+	* reused as soon as this returns.
+	* @param in_data : start of the message to be sent
+	* @param in_size : number of bytes to send
+	* @param to_netId : the net id to send to, RelayComms.TO_ALL_PLAYERS to relay to all
+	* @param in_reliable : send this reliably or not
+	* @param in_ordered : received this ordered or not
+	* @param in_channel : 0,1,2,3 (max of four channels)
+	*/
+	void send(const uint8 *in_data, int32 in_size, const uint64 in_target, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
+
 	/**
 	 * Send a packet to any players by using a mask
 	 *
@@ -94,6 +108,7 @@ public:
 	 * @param channel One of: (CHANNEL_HIGH_PRIORITY_1, CHANNEL_HIGH_PRIORITY_2, CHANNEL_NORMAL_PRIORITY, CHANNEL_LOW_PRIORITY)
 	 */
 	void sendToPlayers(const TArray<uint8> &in_data, const uint64 in_playerMask, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
+	void sendToPlayers(const uint8 *in_data, int32 in_size, const uint64 in_playerMask, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
 
 	/**
 	 * Send a packet to all except yourself
@@ -104,12 +119,70 @@ public:
 	 * @param channel One of: (CHANNEL_HIGH_PRIORITY_1, CHANNEL_HIGH_PRIORITY_2, CHANNEL_NORMAL_PRIORITY, CHANNEL_LOW_PRIORITY)
 	 */
 	void sendToAll(const TArray<uint8> &in_data, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
+	void sendToAll(const uint8 *in_data, int32 in_size, bool in_reliable = true, bool in_ordered = true, int in_channel = 0);
 
 	/** 
  	* Set the ping interval.
  	*/
 	void setPingInterval(float in_interval);
 
+	/**
+	* Sets the reliability limits of a channel, which apply over UDP only.
+	* Reliable packets beyond the send window wait until earlier ones are
+	* acknowledged, up to as many again, after which they are dropped.
+	* Ordered packets received ahead of a missing one are held, up to the
+	* receive buffer, until it arrives. Both default to 64.
+	*
+	* @param in_channel : 0,1,2,3
+	* @param in_sendWindow : reliable packets in flight at once
+	* @param in_receiveBuffer : out of order packets held per sender
+	*/
+	void setChannelLimits(int in_channel, int in_sendWindow, int in_receiveBuffer);
+
+	/**
+	* Pack small messages to the same players, on the same channel and with
+	* the same reliability, into one packet per tick instead of one each.
+	* Batches go out at the end of RunCallbacks, or on flush, so a message
+	* sent after RunCallbacks waits for the next tick. Messages too big to
+	* share a packet are sent right away, after what was batched before them.
+	* While enabled, received batches are unpacked and the data callback sees
+	* each message on its own; while disabled nothing received is unpacked.
+	* Every player in the lobby must enable it together. A message which
+	* starts like a batch is always sent framed as a batch of one, so it is
+	* never split by mistake.
+	*
+	* @param in_enabled : batch or not, disabling flushes what is waiting
+	* @param in_maxBatchSize : bytes of messages packed together, 1024 by
+	* default, which is also the most a relay packet carries
+	*/
+	void enableSendBatching(bool in_enabled, int in_maxBatchSize = 1024);
+
+	/**
+	* Send whatever has been batched now, rather than at the end of RunCallbacks.
+	*/
+	void flush();
+
+	/**
+	* Connection quality: smoothed round trip, its variance and jitter, loss,
+	* traffic in each direction and, when the server provides it, the offset
+	* of the server's clock. Refreshed about once a second while connected,
+	* reset on disconnect.
+	*/
+	FBC_RelayStats getStats() const;
+
+	/**
+	* Allocations made by the relay for sending, and their total size: the
+	* packet buffers, and the arrays and maps they pass through on the way
+	* out (batches, reliable packets waiting on their ack, packet ids and
+	* the buffer pool). Buffers are pooled and the containers keep their
+	* size, so once the first few packets are out these stay put however
+	* much is sent. This holds for UDP only: allocations made by the socket
+	* itself are not included, and neither is the growth of the websocket's
+	* own send queue when connected over TCP or WebSocket.
+	*/
+	int64 getSendAllocationCount() const;
+	int64 getSendAllocatedBytes() const;
+
 	/** 
  	* Convert an array of bytes to a TCHAR
  	* @param In byte array values to convert
@@ -758,6 +758,20 @@ class BCCLIENTPLUGIN_API UBrainCloudWrapper : public UObject, public IServerCall
      */
     bool getAlwaysAllowProfileSwitch();
 
+    /**
+     * When enabled, the session of the last anonymous authentication is saved
+     * and authenticateAnonymous reuses it while it has not expired, instead of
+     * waiting on a round trip to the server. The callback is answered right
+     * away with the saved profile id and isResumedSession set to true.
+     *
+     * Should the server no longer accept the session, the wrapper
+     * authenticates again and resends the calls which were rejected.
+     * By default, this value is false.
+     *
+     * @param enabled Whether saved sessions are resumed
+     */
+    void enableSessionResume(bool enabled) { _sessionResumeEnabled = enabled; }
+
     /**
 	* Set the wrapper name
 	* @return String used to distinguish saved wrapper data
@@ -794,7 +808,18 @@ class BCCLIENTPLUGIN_API UBrainCloudWrapper : public UObject, public IServerCall
     bool _alwaysAllowProfileSwitch = true;
     bool _createdWithClient = false;
 
+    bool _sessionResumeEnabled = false;
+    FString _storedSessionId;
+    FDateTime _storedSessionExpiresAt;
+    int32 _storedSessionExpirySeconds = 0;
+    int32 _storedMaxBundleMsgs = 0;
+    int32 _storedMaxKillCount = 0;
+    // the expiry last written to the save slot
+    FDateTime _savedSessionExpiresAt;
+
     void initializeIdentity(bool isAnonymousAuth = false);
+    bool resumeSession(IServerCallback *callback);
+    void updateStoredSession();
     void reauthenticate();
     void getIdentitiesCallback(IServerCallback *success);
 
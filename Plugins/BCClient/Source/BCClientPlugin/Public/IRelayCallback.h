@@ -2,10 +2,24 @@
 
 #pragma once
 
+/**
+ * A class overriding only one of the overloads should bring in the other with
+ * using IRelayCallback::relayCallback; so it isn't hidden.
+ */
 class BCCLIENTPLUGIN_API IRelayCallback
 {
   public:
     /**
      */
     virtual void relayCallback(const TArray<uint8>& jsonData) = 0;
+
+    /**
+     * The received bytes where they sit, read-only and valid only until this
+     * returns. Override this one to read packets without a copy, by default
+     * the bytes are copied into an array for the one above.
+     */
+    virtual void relayCallback(const uint8 *in_data, int32 in_size)
+    {
+        relayCallback(TArray<uint8>(in_data, in_size));
+    }
 };
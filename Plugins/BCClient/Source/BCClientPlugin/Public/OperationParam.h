@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include "BCIdentifierHash.h"
+#include <atomic>
+
 class BCCLIENTPLUGIN_API OperationParam
 {
   public:
@@ -515,15 +518,26 @@ class BCCLIENTPLUGIN_API OperationParam
 	static const OperationParam CustomEntityServiceDataJson;
 	static const OperationParam CustomEntityServiceDeleteCriteria;
 
-	FString getValue() const { return _value; }
+	const TCHAR *getValue() const { return _value; }
+	int32 getLength() const { return _length; }
+	// the name as an FString, for the FJsonObject field functions; made on first use and kept
+	const FString &getKey() const;
 
-	bool operator==(const OperationParam &s) const;
-	void operator=(const OperationParam &s);
+	bool operator==(const OperationParam &s) const
+	{
+		return _hash == s._hash && (_value == s._value || FCString::Strcmp(_value, s._value) == 0);
+	}
 
 	static bool isOptionalParamValid(const FString &param);
 
   private:
-	FString _value;
-
-	OperationParam(const FString &value);
+	const TCHAR *_value;
+	int32 _length;
+	uint32 _hash;
+	mutable std::atomic<FString *> _key;
+
+	template <int32 N>
+	constexpr OperationParam(const TCHAR (&value)[N]) : _value(value), _length(N - 1), _hash(BCHashIdentifier(value)), _key(nullptr) {}
+	// the constants are copy initialized, a copy makes its own key
+	constexpr OperationParam(const OperationParam &other) : _value(other._value), _length(other._length), _hash(other._hash), _key(nullptr) {}
 };
\ No newline at end of file
@@ -6,6 +6,18 @@
 #include "ServiceName.h"
 #include "ServiceOperation.h"
 #include "OperationParam.h"
+#include "Templates/Atomic.h"
+
+/**
+ * Lanes of the message queue, bundles are filled from the highest lane
+ * first. See BrainCloudClient::setServicePriority.
+ */
+enum class eBCCallPriority : uint8
+{
+	CRITICAL,
+	INTERACTIVE,
+	BACKGROUND
+};
 
 /**
  * This is a data structure representing a single message to send to the
@@ -16,19 +28,51 @@ class BCCLIENTPLUGIN_API ServerCall
 
   public:
 	ServerCall(ServiceName serviceName, ServiceOperation serviceOperation, TSharedRef<FJsonObject> data, IServerCallback *callback = nullptr);
+	// a call serialized in an earlier session, see BCOfflineJournal
+	ServerCall(ServiceName serviceName, ServiceOperation serviceOperation, const TArray<uint8> &payload, IServerCallback *callback = nullptr);
 	virtual ~ServerCall();
 
 	IServerCallback *getCallback() const { return _callback; }
-	TSharedRef<FJsonObject> getPayload();
+	const TArray<uint8> &getPayload() const { return _payload; }
+	void serialize();
 	ServiceOperation getOperation() const { return _operation; }
 	ServiceName getService() const { return _service; }
 	bool getIsEndOfBundle() const { return _isEndOfBundle; }
 	void setIsEndOfBundle(bool isEndOfBundle) { _isEndOfBundle = isEndOfBundle; }
+	uint64 getJournalId() const { return _journalId; }
+	eBCCallPriority getPriority() const { return _priority; }
+	bool hasPriority() const { return _hasPriority; }
+	void setPriority(eBCCallPriority priority) { _priority = priority; _hasPriority = true; }
+	uint64 getQueueSequence() const { return _queueSequence; }
+	void setQueueSequence(uint64 queueSequence) { _queueSequence = queueSequence; }
+	double getQueuedTime() const { return _queuedTime; }
+	void setQueuedTime(double queuedTime) { _queuedTime = queuedTime; }
+	double getSentTime() const { return _sentTime; }
+	void setSentTime(double sentTime) { _sentTime = sentTime; }
+	void setJournalId(uint64 journalId) { _journalId = journalId; }
+	bool getIsWarmUp() const { return _isWarmUp; }
+	void setIsWarmUp(bool isWarmUp) { _isWarmUp = isWarmUp; }
 
   private:
+	friend class BCSubmissionQueue;
+
 	IServerCallback *_callback;
 	TSharedPtr<FJsonObject> _data;
+	// utf8 json of the message, filled in by serialize
+	TArray<uint8> _payload;
 	ServiceOperation _operation;
 	ServiceName _service;
 	bool _isEndOfBundle = false;
+	uint64 _journalId = 0;
+	eBCCallPriority _priority = eBCCallPriority::INTERACTIVE;
+	// set explicitly rather than from the service defaults
+	bool _hasPriority = false;
+	// order the call entered the lanes in, across all of them; 0 for calls from an earlier session
+	uint64 _queueSequence = 0;
+	double _queuedTime = 0.0;
+	double _sentTime = 0.0;
+	// sent along with an authentication, see BrainCloudClient::beginWarmUpCalls
+	bool _isWarmUp = false;
+	// link used while the call waits in BCSubmissionQueue
+	TAtomic<ServerCall *> _nextSubmitted{nullptr};
 };
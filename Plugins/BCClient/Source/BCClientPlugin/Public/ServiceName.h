@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "BCIdentifierHash.h"
+
 class BCCLIENTPLUGIN_API ServiceName
 {
 public:
@@ -64,14 +66,20 @@ public:
   // RS
   static const ServiceName Relay;
 
-  FString getValue() const { return _value; }
+  const TCHAR *getValue() const { return _value; }
+  int32 getLength() const { return _length; }
 
-  bool operator==(const ServiceName &s) const;
-  bool operator!=(const ServiceName &s) const;
-  void operator=(const ServiceName &s);
+  bool operator==(const ServiceName &s) const
+  {
+    return _hash == s._hash && (_value == s._value || FCString::Strcmp(_value, s._value) == 0);
+  }
+  bool operator!=(const ServiceName &s) const { return !(*this == s); }
 
 private:
-  ServiceName(const FString &value);
+  template <int32 N>
+  constexpr ServiceName(const TCHAR (&value)[N]) : _value(value), _length(N - 1), _hash(BCHashIdentifier(value)) {}
 
-  FString _value;
+  const TCHAR *_value;
+  int32 _length;
+  uint32 _hash;
 };
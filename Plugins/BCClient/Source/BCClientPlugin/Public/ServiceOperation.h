@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "BCIdentifierHash.h"
+
 class BCCLIENTPLUGIN_API ServiceOperation
 {
   public:
@@ -479,13 +481,19 @@ class BCCLIENTPLUGIN_API ServiceOperation
 	static const ServiceOperation PublishUserItemToBlackchain;
 	static const ServiceOperation RefreshBlockchainUserItems;
 
-	FString getValue() const { return _value; }
+	const TCHAR *getValue() const { return _value; }
+	int32 getLength() const { return _length; }
 
-	bool operator==(const ServiceOperation &s) const;
-	void operator=(const ServiceOperation &s);
+	bool operator==(const ServiceOperation &s) const
+	{
+		return _hash == s._hash && (_value == s._value || FCString::Strcmp(_value, s._value) == 0);
+	}
 
   private:
-	ServiceOperation(const FString &operation);
+	template <int32 N>
+	constexpr ServiceOperation(const TCHAR (&value)[N]) : _value(value), _length(N - 1), _hash(BCHashIdentifier(value)) {}
 
-	FString _value;
+	const TCHAR *_value;
+	int32 _length;
+	uint32 _hash;
 };
\ No newline at end of file
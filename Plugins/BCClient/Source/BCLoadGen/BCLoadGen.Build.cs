@@ -0,0 +1,26 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+using System.IO;
+using UnrealBuildTool;
+
+public class BCLoadGen : ModuleRules
+{
+#if WITH_FORWARDED_MODULE_RULES_CTOR
+    public BCLoadGen(ReadOnlyTargetRules Target) : base(Target)
+#else
+    public BCLoadGen(TargetInfo Target)
+#endif
+    {
+        PrivatePCHHeaderFile = "Private/BCLoadGenPrivatePCH.h";
+
+        PrivateDependencyModuleNames.AddRange(
+            new string[] {
+                "Core",
+                "CoreUObject",
+                "Engine",
+                "Json",
+                "BCClientPlugin"
+            }
+        );
+    }
+}
@@ -0,0 +1,39 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "BCLoadGenCommandlet.generated.h"
+
+/**
+ * Runs many simulated brainCloud clients in one process and reports the
+ * throughput and latency they saw, for capacity planning of server scripts.
+ *
+ * Every client authenticates anonymously, then repeatedly increments a
+ * user statistic, reads its user state and, given a -leaderboard, reads a
+ * page of it, pausing -think seconds between calls.
+ *
+ *	UE4Editor-Cmd.exe BCSubsystem -run=BCLoadGen -url=https://api.braincloudservers.com/dispatcherv2 -appid=12345 -secret=... -clients=500
+ *
+ * Options:
+ *	-url=, -appid=, -secret=	the app to run against
+ *	-local[=port]			run against a BCLocalDispatcher started in process instead
+ *	-clients=100			number of simulated clients
+ *	-duration=60			seconds to run for once every client has started
+ *	-rampup=10			seconds over which the clients are started
+ *	-think=1.0			seconds each client waits between calls
+ *	-leaderboard=			leaderboard to read pages of
+ *	-rtt				also enable rtt on every client
+ *	-singlethreaded			update each client's comms from the commandlet loop
+ *				instead of the shared comms thread
+ *	-report=			write the results as json to this file
+ */
+UCLASS()
+class UBCLoadGenCommandlet : public UCommandlet
+{
+    GENERATED_UCLASS_BODY()
+
+    // UCommandlet interface
+    virtual int32 Main(const FString &Params) override;
+    // End of UCommandlet interface
+};
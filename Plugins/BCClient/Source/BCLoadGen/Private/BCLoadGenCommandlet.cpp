@@ -0,0 +1,306 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCLoadGenCommandlet.h"
+#include "BCLoadGenPrivatePCH.h"
+#include "Containers/Ticker.h"
+#include "Misc/FileHelper.h"
+#include "BrainCloudClient.h"
+#include "IServerCallback.h"
+#include "BCCommsMetrics.h"
+#include "BCLocalDispatcher.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBCLoadGen, Log, All);
+
+namespace
+{
+	struct LoadGenConfig
+	{
+		FString ServerUrl;
+		FString AppId;
+		FString SecretKey;
+		int32 Clients = 100;
+		float Duration = 60.0f;
+		float RampUp = 10.0f;
+		float ThinkTime = 1.0f;
+		FString LeaderboardId;
+		bool EnableRtt = false;
+	};
+
+	/**
+	 * One simulated player, walks through its script one call at a time.
+	 */
+	class BCSimulatedClient : public IServerCallback
+	{
+	  public:
+		BCSimulatedClient(const LoadGenConfig &config, int32 index) : _config(config)
+		{
+			Client = new BrainCloudClient();
+			Client->initialize(config.ServerUrl, config.SecretKey, config.AppId, TEXT("1.0.0"));
+			Client->enableMetrics(true);
+			_anonymousId = FString::Printf(TEXT("loadgen-%d-%s"), index, *FGuid::NewGuid().ToString());
+		}
+
+		virtual ~BCSimulatedClient()
+		{
+			delete Client;
+		}
+
+		void Start()
+		{
+			_isStarted = true;
+			Client->initializeIdentity(TEXT(""), _anonymousId);
+			Client->getAuthenticationService()->authenticateAnonymous(true, this);
+			_isWaiting = true;
+		}
+
+		void Tick(double now, bool isStopping)
+		{
+			if (!_isStarted)
+				return;
+
+			Client->runCallbacks();
+
+			if (_isWaiting || isStopping || !_isAuthenticated || now < _nextCallTime)
+				return;
+
+			_isWaiting = true;
+			switch (_step++ % 3)
+			{
+			case 0:
+				Client->getPlayerStatisticsService()->incrementUserStats(TEXT("{\"loadGenCalls\":1}"), this);
+				break;
+			case 1:
+				Client->getPlayerStateService()->readUserState(this);
+				break;
+			default:
+				if (_config.LeaderboardId.IsEmpty())
+					_isWaiting = false;
+				else
+					Client->getLeaderboardService()->getGlobalLeaderboardPage(_config.LeaderboardId, ESortOrder::HIGH_TO_LOW, 0, 9, this);
+				break;
+			}
+		}
+
+		bool IsStarted() const { return _isStarted; }
+		bool IsIdle() const { return !_isWaiting; }
+
+		// IServerCallback
+		virtual void serverCallback(ServiceName serviceName, ServiceOperation serviceOperation, const FString &jsonData) override
+		{
+			// the rtt connection runs alongside the scripted calls
+			if (serviceName == ServiceName::RTTRegistration)
+				return;
+
+			if (serviceName == ServiceName::AuthenticateV2)
+			{
+				_isAuthenticated = true;
+				if (_config.EnableRtt)
+					Client->getRTTService()->enableRTT(BCRTTConnectionType::WEBSOCKET, this);
+			}
+			OnCallDone();
+		}
+
+		virtual void serverError(ServiceName serviceName, ServiceOperation serviceOperation, int32 statusCode, int32 reasonCode, const FString &jsonError) override
+		{
+			if (serviceName == ServiceName::RTTRegistration)
+				return;
+
+			OnCallDone();
+		}
+
+		BrainCloudClient *Client;
+
+	  private:
+		void OnCallDone()
+		{
+			_isWaiting = false;
+			_nextCallTime = FPlatformTime::Seconds() + _config.ThinkTime;
+		}
+
+		const LoadGenConfig &_config;
+		FString _anonymousId;
+		bool _isStarted = false;
+		bool _isAuthenticated = false;
+		bool _isWaiting = false;
+		int32 _step = 0;
+		double _nextCallTime = 0.0;
+	};
+
+	TSharedRef<FJsonObject> HistogramToReport(const BCLatencyHistogram &histogram)
+	{
+		TSharedRef<FJsonObject> json = MakeShareable(new FJsonObject());
+		json->SetNumberField(TEXT("p50Ms"), histogram.GetPercentile(0.5) * 1000.0);
+		json->SetNumberField(TEXT("p90Ms"), histogram.GetPercentile(0.9) * 1000.0);
+		json->SetNumberField(TEXT("p99Ms"), histogram.GetPercentile(0.99) * 1000.0);
+		json->SetNumberField(TEXT("maxMs"), histogram.MaxSeconds * 1000.0);
+		return json;
+	}
+}
+
+UBCLoadGenCommandlet::UBCLoadGenCommandlet(const FObjectInitializer &ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UBCLoadGenCommandlet::Main(const FString &Params)
+{
+	LoadGenConfig config;
+	FParse::Value(*Params, TEXT("url="), config.ServerUrl);
+	FParse::Value(*Params, TEXT("appid="), config.AppId);
+	FParse::Value(*Params, TEXT("secret="), config.SecretKey);
+	FParse::Value(*Params, TEXT("clients="), config.Clients);
+	FParse::Value(*Params, TEXT("duration="), config.Duration);
+	FParse::Value(*Params, TEXT("rampup="), config.RampUp);
+	FParse::Value(*Params, TEXT("think="), config.ThinkTime);
+	FParse::Value(*Params, TEXT("leaderboard="), config.LeaderboardId);
+	config.EnableRtt = FParse::Param(*Params, TEXT("rtt"));
+
+	FString reportPath;
+	FParse::Value(*Params, TEXT("report="), reportPath);
+
+	// every client's comms run on the one shared comms thread, the loop below only
+	// runs their callbacks, unless asked to service them from the loop itself
+	BrainCloudClient::SINGLE_THREADED = FParse::Param(*Params, TEXT("singlethreaded"));
+
+#if WITH_BC_LOCAL_DISPATCHER
+	TUniquePtr<BCLocalDispatcher> dispatcher;
+	uint32 port = 8099;
+	bool useLocal = FParse::Value(*Params, TEXT("local="), port) || FParse::Param(*Params, TEXT("local"));
+	if (useLocal)
+	{
+		if (config.AppId.IsEmpty())
+			config.AppId = TEXT("10000");
+		if (config.SecretKey.IsEmpty())
+			config.SecretKey = TEXT("loadgen-secret");
+
+		dispatcher = MakeUnique<BCLocalDispatcher>(port, config.SecretKey);
+		if (!dispatcher->Start())
+			return 1;
+		config.ServerUrl = dispatcher->GetServerUrl();
+	}
+#endif
+
+	if (config.ServerUrl.IsEmpty() || config.AppId.IsEmpty() || config.SecretKey.IsEmpty() || config.Clients <= 0)
+	{
+		UE_LOG(LogBCLoadGen, Error, TEXT("Usage: -run=BCLoadGen -url=<dispatcher url> -appid=<app id> -secret=<secret> [-clients=100] [-duration=60] [-rampup=10] [-think=1.0] [-leaderboard=<id>] [-rtt] [-singlethreaded] [-local[=port]] [-report=<file>]"));
+		return 1;
+	}
+
+	UE_LOG(LogBCLoadGen, Display, TEXT("Starting %d clients against %s"), config.Clients, *config.ServerUrl);
+
+	TArray<TUniquePtr<BCSimulatedClient>> clients;
+	for (int32 i = 0; i < config.Clients; ++i)
+		clients.Add(MakeUnique<BCSimulatedClient>(config, i));
+
+	double startTime = FPlatformTime::Seconds();
+	double stopTime = startTime + config.RampUp + config.Duration;
+	// calls still out when the run ends are given this long to come back
+	double drainTime = stopTime + 30.0;
+	double lastTime = startTime;
+	double lastProgress = startTime;
+
+	while (true)
+	{
+		double now = FPlatformTime::Seconds();
+		bool isStopping = now >= stopTime;
+
+		// ticks the http manager, and the local dispatcher when there is one
+		FTicker::GetCoreTicker().Tick((float)(now - lastTime));
+		lastTime = now;
+
+		bool isIdle = true;
+		for (int32 i = 0; i < clients.Num(); ++i)
+		{
+			BCSimulatedClient &client = *clients[i];
+			if (!client.IsStarted() && !isStopping && now - startTime >= config.RampUp * i / clients.Num())
+				client.Start();
+
+			client.Tick(now, isStopping);
+			isIdle &= client.IsIdle();
+		}
+
+		if ((isStopping && isIdle) || now >= drainTime)
+			break;
+
+		if (now - lastProgress >= 10.0)
+		{
+			lastProgress = now;
+			UE_LOG(LogBCLoadGen, Display, TEXT("%.0fs elapsed"), now - startTime);
+		}
+
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	double elapsed = FPlatformTime::Seconds() - startTime;
+
+	TMap<FString, BCOperationMetrics> totals;
+	BCBundleMetrics bundles;
+	for (const TUniquePtr<BCSimulatedClient> &client : clients)
+	{
+		for (const BCOperationMetrics &metrics : client->Client->getOperationMetrics())
+		{
+			BCOperationMetrics &total = totals.FindOrAdd(metrics.Service + TEXT(".") + metrics.Operation);
+			total.Service = metrics.Service;
+			total.Operation = metrics.Operation;
+			total.Merge(metrics);
+		}
+
+		BCBundleMetrics clientBundles = client->Client->getBundleMetrics();
+		bundles.BundlesSent += clientBundles.BundlesSent;
+		bundles.MessagesSent += clientBundles.MessagesSent;
+		bundles.RequestBytes += clientBundles.RequestBytes;
+		bundles.ResponseBytes += clientBundles.ResponseBytes;
+	}
+	clients.Empty();
+
+	UE_LOG(LogBCLoadGen, Display, TEXT("%d clients, %.1fs, %u bundles (%.1f/s), %u messages (%.1f/s)"),
+		config.Clients, elapsed, bundles.BundlesSent, bundles.BundlesSent / elapsed, bundles.MessagesSent, bundles.MessagesSent / elapsed);
+
+	TArray<TSharedPtr<FJsonValue>> operationsJson;
+	for (const TPair<FString, BCOperationMetrics> &pair : totals)
+	{
+		const BCOperationMetrics &total = pair.Value;
+		UE_LOG(LogBCLoadGen, Display, TEXT("%-48s calls %7u  errors %5u  retries %5u  %7.1f/s  p50 %7.1fms  p90 %7.1fms  p99 %7.1fms  max %7.1fms"),
+			*pair.Key, total.Calls, total.Errors, total.Retries, total.Calls / elapsed,
+			total.ServerLatency.GetPercentile(0.5) * 1000.0, total.ServerLatency.GetPercentile(0.9) * 1000.0,
+			total.ServerLatency.GetPercentile(0.99) * 1000.0, total.ServerLatency.MaxSeconds * 1000.0);
+
+		TSharedRef<FJsonObject> json = MakeShareable(new FJsonObject());
+		json->SetStringField(TEXT("service"), total.Service);
+		json->SetStringField(TEXT("operation"), total.Operation);
+		json->SetNumberField(TEXT("calls"), total.Calls);
+		json->SetNumberField(TEXT("errors"), total.Errors);
+		json->SetNumberField(TEXT("retries"), total.Retries);
+		json->SetNumberField(TEXT("callsPerSecond"), total.Calls / elapsed);
+		json->SetObjectField(TEXT("serverLatency"), HistogramToReport(total.ServerLatency));
+		json->SetObjectField(TEXT("queueLatency"), HistogramToReport(total.QueueLatency));
+		operationsJson.Add(MakeShareable(new FJsonValueObject(json)));
+	}
+
+	if (!reportPath.IsEmpty())
+	{
+		TSharedRef<FJsonObject> report = MakeShareable(new FJsonObject());
+		report->SetNumberField(TEXT("clients"), config.Clients);
+		report->SetNumberField(TEXT("seconds"), elapsed);
+		report->SetNumberField(TEXT("bundlesSent"), bundles.BundlesSent);
+		report->SetNumberField(TEXT("messagesSent"), bundles.MessagesSent);
+		report->SetNumberField(TEXT("requestBytes"), (double)bundles.RequestBytes);
+		report->SetNumberField(TEXT("responseBytes"), (double)bundles.ResponseBytes);
+		report->SetArrayField(TEXT("operations"), operationsJson);
+
+		FString reportJson;
+		TSharedRef<TJsonWriter<>> writer = TJsonWriterFactory<>::Create(&reportJson);
+		FJsonSerializer::Serialize(report, writer);
+		FFileHelper::SaveStringToFile(reportJson, *reportPath);
+	}
+
+#if WITH_BC_LOCAL_DISPATCHER
+	if (dispatcher.IsValid())
+		dispatcher->Stop();
+#endif
+	return 0;
+}
@@ -0,0 +1,6 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#include "BCLoadGenPrivatePCH.h"
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, BCLoadGen);
@@ -0,0 +1,6 @@
+// Copyright 2018 bitHeads, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Engine.h"
+#include "Json.h"